@@ -0,0 +1,287 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// @brief namespace for common
+namespace common {
+
+/// @brief concept for executors that run a body over a range of indices,
+///        e.g. ThreadPool or SerialExecutor
+template <typename T>
+concept Executor = requires(T executor,
+                            const std::function<void(std::size_t)>& body) {
+  executor.parallelFor(std::size_t{}, body);
+};
+
+/// @brief executor that runs everything on the calling thread
+class SerialExecutor {
+public:
+  /// @brief method to run the body for every index in [0, count)
+  /// @param count number of indices to run the body for
+  /// @param body the body to run, it accepts the index as a parameter
+  /// @note the body is called as it is, not through a std::function, so
+  ///       that serial runs allocate nothing whatever the body captures
+  static void parallelFor(std::size_t count, const auto& body) {
+    for (std::size_t index{0U}; index < count; ++index) {
+      body(index);
+    }
+  }
+};
+
+/// @brief class definition for a work-stealing thread pool, where each worker
+///        owns a queue of tasks that it pops from its back, and when it runs
+///        out of tasks, it steals from the front of the other queues
+class ThreadPool {
+  /// @brief type alias for the tasks run by the pool
+  using Task = std::function<void()>;
+
+  /// @brief queue of tasks owned by a worker
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+public:
+  /// @brief parametrized constructor that starts the workers of the pool
+  /// @param numberOfThreads number of workers, at least one is started
+  explicit ThreadPool(std::size_t numberOfThreads =
+                          std::thread::hardware_concurrency()) {
+    numberOfThreads = std::max(numberOfThreads, std::size_t{1U});
+
+    m_queues.reserve(numberOfThreads);
+    for (std::size_t i{0U}; i < numberOfThreads; ++i) {
+      m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    m_workers.reserve(numberOfThreads);
+    for (std::size_t i{0U}; i < numberOfThreads; ++i) {
+      m_workers.emplace_back([this, i] { workerLoop(i); });
+    }
+  }
+
+  /// @brief destructor that lets the workers finish the queued tasks, then
+  ///        joins them
+  ~ThreadPool() {
+    {
+      const std::scoped_lock lock{m_wakeMutex};
+      m_stopping = true;
+    }
+    m_wakeUp.notify_all();
+
+    for (auto& worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+  auto operator=(ThreadPool&&) -> ThreadPool& = delete;
+
+  /// @brief method returning a pool shared by whoever does not bring its own,
+  ///        started on first use with a worker per hardware thread
+  /// @return reference to the shared pool
+  static auto shared() -> ThreadPool& {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  /// @brief a method to show the number of workers of the pool
+  /// @return the number of workers
+  [[nodiscard]] auto size() const noexcept -> std::size_t {
+    return m_workers.size();
+  }
+
+  /// @brief a method to submit a task to the pool
+  /// @param task the task to be run by one of the workers
+  /// @note tasks submitted from a worker go to its own queue, otherwise they
+  ///       are distributed round-robin over the queues
+  void submit(Task task) {
+    const auto queueIndex{
+        tCurrentPool == this
+            ? tCurrentWorker
+            : m_nextQueue.fetch_add(1U, std::memory_order_relaxed) %
+                  m_queues.size()};
+    {
+      auto& queue{*m_queues[queueIndex]};
+      const std::scoped_lock lock{queue.mutex};
+      queue.tasks.push_back(std::move(task));
+    }
+
+    {
+      const std::scoped_lock lock{m_wakeMutex};
+      ++m_pendingTasks;
+    }
+    m_wakeUp.notify_one();
+  }
+
+  /// @brief method to run the body for every index in [0, count) over the
+  ///        workers of the pool and the calling thread, then wait for all of
+  ///        them to finish
+  /// @param count number of indices to run the body for
+  /// @param body the body to run, it accepts the index as a parameter
+  /// @note indices are claimed dynamically one by one, and since the calling
+  ///       thread claims them as well, it never waits for an index that
+  ///       nobody is running, so nesting calls from within a body is fine
+  /// @throw the first exception thrown by the body, if any
+  void parallelFor(std::size_t count,
+                   const std::function<void(std::size_t)>& body) {
+    if (count == 0U) {
+      return;
+    }
+
+    // shared with the helper tasks, since they might start after returning
+    const auto state{std::make_shared<ParallelForState>(count, body)};
+    const auto helpers{std::min(count - 1U, size())};
+    for (std::size_t i{0U}; i < helpers; ++i) {
+      submit([state] { state->run(); });
+    }
+
+    state->run();
+    state->wait();
+  }
+
+private:
+  /// @brief state of a parallelFor call shared by the threads running it
+  struct ParallelForState {
+    ParallelForState(std::size_t count,
+                     const std::function<void(std::size_t)>& body)
+        : m_count{count}, m_body{body} {}
+
+    /// @brief claims and runs indices till none is left
+    void run() {
+      for (auto index{m_nextIndex.fetch_add(1U)}; index < m_count;
+           index = m_nextIndex.fetch_add(1U)) {
+        try {
+          m_body(index);
+        } catch (...) {
+          const std::scoped_lock lock{m_mutex};
+          if (!m_exception) {
+            m_exception = std::current_exception();
+          }
+        }
+
+        const std::scoped_lock lock{m_mutex};
+        if (++m_completed == m_count) {
+          m_done.notify_all();
+        }
+      }
+    }
+
+    /// @brief waits for all indices to complete
+    void wait() {
+      std::unique_lock lock{m_mutex};
+      m_done.wait(lock, [this] { return m_completed == m_count; });
+      if (m_exception) {
+        std::rethrow_exception(m_exception);
+      }
+    }
+
+  private:
+    std::size_t m_count;
+    std::function<void(std::size_t)> m_body;
+    std::atomic<std::size_t> m_nextIndex{0U};
+    std::size_t m_completed{0U};
+    std::exception_ptr m_exception;
+    std::mutex m_mutex;
+    std::condition_variable m_done;
+  };
+
+  /// @brief queues of tasks, one per worker
+  std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+
+  /// @brief the workers of the pool
+  std::vector<std::thread> m_workers;
+
+  /// @brief index of the queue the next task from outside the pool goes to
+  std::atomic<std::size_t> m_nextQueue{0U};
+
+  /// @brief mutex guarding the number of pending tasks and stopping flag
+  std::mutex m_wakeMutex;
+
+  /// @brief condition variable idle workers wait on
+  std::condition_variable m_wakeUp;
+
+  /// @brief number of tasks submitted but not taken by a worker yet
+  std::size_t m_pendingTasks{0U};
+
+  /// @brief flag set on destruction to stop the workers
+  bool m_stopping{false};
+
+  /// @brief the pool the current thread is a worker of, if any
+  static inline thread_local const ThreadPool* tCurrentPool{nullptr};
+
+  /// @brief index of the current thread among the workers of tCurrentPool
+  static inline thread_local std::size_t tCurrentWorker{0U};
+
+  /// @brief helper method to take a task, from the back of the own queue
+  ///        first, then from the front of the others
+  /// @param ownIndex index of the worker looking for a task
+  /// @return the task if any was found
+  auto takeTask(std::size_t ownIndex) -> std::optional<Task> {
+    const auto numberOfQueues{m_queues.size()};
+    for (std::size_t offset{0U}; offset < numberOfQueues; ++offset) {
+      auto& queue{*m_queues[(ownIndex + offset) % numberOfQueues]};
+      const std::scoped_lock lock{queue.mutex};
+      if (queue.tasks.empty()) {
+        continue;
+      }
+
+      Task task;
+      if (offset == 0U) {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+      } else {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+      }
+
+      return task;
+    }
+
+    return std::nullopt;
+  }
+
+  /// @brief the loop run by each worker
+  /// @param ownIndex index of the worker
+  void workerLoop(std::size_t ownIndex) {
+    tCurrentPool = this;
+    tCurrentWorker = ownIndex;
+
+    while (true) {
+      {
+        std::unique_lock lock{m_wakeMutex};
+        m_wakeUp.wait(lock,
+                      [this] { return m_stopping || m_pendingTasks > 0U; });
+        if (m_pendingTasks == 0U) {  // stopping, and nothing left to run
+          return;
+        }
+        --m_pendingTasks;
+      }
+
+      // a task is reserved for this worker by the decrement above, but another
+      // worker might steal the one it was about to reach, hence the retry
+      auto task{takeTask(ownIndex)};
+      while (!task) {
+        std::this_thread::yield();
+        task = takeTask(ownIndex);
+      }
+
+      (*task)();
+    }
+  }
+};
+
+}  // namespace common
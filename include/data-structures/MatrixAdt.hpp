@@ -1,17 +1,31 @@
 #pragma once
 
+#include <cstddef>
+#include <format>
+#include <functional>
 #include <initializer_list>
 #include <memory>
+#include <span>
 #include <string>
+#include <type_traits>
 #include <utility>
 
+#include "common/ThreadPool.hpp"
 #include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixExpressions.hpp"
+#include "data-structures/matrix-types/MatrixPower.hpp"
+#include "data-structures/matrix-types/MatrixProducts.hpp"
 
 // NOLINTBEGIN
 // Matrices Types supported
+#include "data-structures/matrix-types/BandedMatrix.hpp"
 #include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
 #include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
 #include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SparseMatrix.hpp"
+#include "data-structures/matrix-types/SymmetricMatrix.hpp"
+#include "data-structures/matrix-types/UpperTriangularMatrix.hpp"
 // NOLINTEND
 
 /// @brief namespace for data structures implemented
@@ -42,15 +56,167 @@ public:
       : m_matrixImpl{std::make_unique<MatrixT>(
             std::forward<std::initializer_list<Args>>(args)...)} {}
 
-  /// @brief multiplication operator that multiplies MatrixAdt type
-  ///        by another and returns the result in a new object
+  /// @brief constructor evaluating a lazy expression, built by the arithmetic
+  ///        operators of MatrixAdt, in a single pass into the new object
+  /// @tparam Expression type of the expression
+  /// @param expression the expression to evaluate
+  template <typename Expression>
+    requires matrix_types::MatrixExpression<Expression>
+  explicit MatrixAdt(Expression&& expression)
+      : m_matrixImpl{std::make_unique<MatrixT>(expression.materialize())} {}
+
+  /// @brief multiplication method that multiplies MatrixAdt type by another
+  ///        on the given executor, e.g. a common::ThreadPool shared by several
+  ///        products, and returns the result in a new object
   /// @param otherMatrix the other operand
+  /// @param executor executor to run the multiplication on
   /// @return the product of both matrices stored in a new obj
-  auto operator*(const auto& otherMatrix) const {
-    auto result{(*m_matrixImpl) * (*(otherMatrix.m_matrixImpl))};
+  /// @note matrices types without a parallel multiplication, i.e. having
+  ///       no multiply() method, multiply on the calling thread
+  auto multiply(const auto& otherMatrix,
+                common::Executor auto& executor) const {
+    const auto& matrix{*m_matrixImpl};
+    const auto& other{*(otherMatrix.m_matrixImpl)};
+
+    if constexpr (requires { matrix.multiply(other, executor); }) {
+      auto result{matrix.multiply(other, executor)};
+      return MatrixAdt<decltype(result)>{std::move(result)};
+    } else {
+      auto result{matrix * other};
+      return MatrixAdt<decltype(result)>{std::move(result)};
+    }
+  }
+
+  /// @brief method to compute the Kronecker product of the wrapped matrix by
+  ///        another MatrixAdt, see matrix_types::kronecker()
+  /// @param otherMatrix the other operand
+  /// @return the Kronecker product of both matrices stored in a new obj, of
+  ///         the structure both matrices share, e.g. diagonal
+  auto kronecker(const auto& otherMatrix) const {
+    auto result{matrix_types::kronecker(*m_matrixImpl,
+                                        *(otherMatrix.m_matrixImpl))};
     return MatrixAdt<decltype(result)>{std::move(result)};
   }
 
+  /// @brief method to compute the element-wise, i.e. Hadamard, product of
+  ///        the wrapped matrix by another MatrixAdt, see
+  ///        matrix_types::hadamard()
+  /// @param otherMatrix the other operand
+  /// @return the element-wise product of both matrices stored in a new obj,
+  ///         of the structure of either matrix, e.g. lower triangular
+  /// @throw std::invalid_argument if dimensions are not the same
+  auto hadamard(const auto& otherMatrix) const {
+    auto result{matrix_types::hadamard(*m_matrixImpl,
+                                       *(otherMatrix.m_matrixImpl))};
+    return MatrixAdt<decltype(result)>{std::move(result)};
+  }
+
+  /// @brief method to multiply the wrapped matrix by a vector and to
+  ///        accumulate the scaled product into another vector,
+  ///        y = alpha * A * x + beta * y (GEMV)
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  void multiplyVector(
+      typename MatrixT::value_type alpha,
+      std::span<const typename MatrixT::value_type> vector,
+      typename MatrixT::value_type beta,
+      std::span<typename MatrixT::value_type> result) const {
+    m_matrixImpl->multiplyVector(alpha, vector, beta, result);
+  }
+
+  /// @brief overload of the method above that runs on the given executor
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @param executor executor to run the multiplication on
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  /// @note matrices types without a parallel product run it on the calling
+  ///       thread
+  void multiplyVector(
+      typename MatrixT::value_type alpha,
+      std::span<const typename MatrixT::value_type> vector,
+      typename MatrixT::value_type beta,
+      std::span<typename MatrixT::value_type> result,
+      common::Executor auto& executor) const {
+    const auto& matrix{*m_matrixImpl};
+
+    if constexpr (requires {
+                    matrix.multiplyVector(alpha, vector, beta, result,
+                                          executor);
+                  }) {
+      matrix.multiplyVector(alpha, vector, beta, result, executor);
+    } else {
+      matrix.multiplyVector(alpha, vector, beta, result);
+    }
+  }
+
+  /// @brief function to raise a MatrixAdt to a natural power by repeated
+  ///        squaring, see matrix_types::pow()
+  /// @param matrix the matrix to be raised
+  /// @param exponent the power to raise the matrix to, zero giving identity
+  /// @return the matrix to the power of exponent stored in a new obj
+  friend auto pow(const MatrixAdt& matrix, std::size_t exponent) -> MatrixAdt
+    requires matrix_types::matrix_common::SquarePowerable<MatrixT>
+  {
+    return MatrixAdt{matrix_types::pow(*matrix.m_matrixImpl, exponent)};
+  }
+
+  /// @brief compound addition operator, adding another MatrixAdt, or the
+  ///        result of an expression, to the wrapped matrix in place
+  /// @param other the MatrixAdt or the expression to add
+  /// @return reference to this object
+  /// @note element-wise expressions are added to dense matrices in a single
+  ///       pass, without evaluating them first
+  auto operator+=(const matrix_types::ExpressionOperand auto& other)
+      -> MatrixAdt& {
+    return combine<std::plus<>>(toExpression(other), "add");
+  }
+
+  /// @brief compound subtraction operator, subtracting another MatrixAdt, or
+  ///        the result of an expression, from the wrapped matrix in place
+  /// @param other the MatrixAdt or the expression to subtract
+  /// @return reference to this object
+  /// @note element-wise expressions are subtracted from dense matrices in a
+  ///       single pass, without evaluating them first
+  auto operator-=(const matrix_types::ExpressionOperand auto& other)
+      -> MatrixAdt& {
+    return combine<std::minus<>>(toExpression(other), "subtract");
+  }
+
+  /// @brief compound multiplication operator, multiplying the wrapped matrix
+  ///        by another MatrixAdt, or by the result of an expression, in place
+  /// @param other the MatrixAdt or the expression to multiply by
+  /// @return reference to this object
+  /// @note the product must be of the type of the wrapped matrix. An
+  ///       expression is evaluated first, since the product overwrites what
+  ///       it reads, into a buffer reused across calls, see
+  ///       matrix_types::materializeBuffered()
+  auto operator*=(const matrix_types::ExpressionOperand auto& other)
+      -> MatrixAdt& {
+    *m_matrixImpl *= matrix_types::materializeBuffered(toExpression(other));
+    return *this;
+  }
+
+  /// @brief compound multiplication operator by a scalar
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this object
+  auto operator*=(const typename MatrixT::value_type& factor) -> MatrixAdt& {
+    return scale(factor);
+  }
+
+  /// @brief method to multiply all elements of the wrapped matrix by a scalar
+  ///        in place
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this object
+  auto scale(const typename MatrixT::value_type& factor) -> MatrixAdt& {
+    m_matrixImpl->scale(factor);
+    return *this;
+  }
+
   /// @brief method to display elements of the instantiated matrix
   /// @return stringified format of the instantiated matrix elements
   [[nodiscard]] constexpr auto display() const noexcept -> std::string {
@@ -70,11 +236,98 @@ private:
       : m_matrixImpl{std::make_unique<MatrixT>(std::forward<MatrixT>(matrix))} {
   }
 
+  /// @brief helper method to combine an expression into the wrapped matrix
+  ///        in place, element by element when it is dense and the expression
+  ///        element-wise, otherwise by its own compound operator
+  /// @tparam Operation std::plus<> or std::minus<>
+  /// @param expression the expression combined
+  /// @param operation name of the operation, used in error messages
+  /// @return reference to this object
+  /// @throw std::invalid_argument if dimensions are not the same
+  template <typename Operation>
+  auto combine(const auto& expression, const char* operation) -> MatrixAdt& {
+    using ExpressionType = std::remove_cvref_t<decltype(expression)>;
+
+    // leaves refer to a matrix, which the wrapped one combines without any
+    // copy, skipping its structural zeros
+    if constexpr (matrix_types::kHasDenseRowsV<MatrixT> &&
+                  matrix_types::kIsElementwiseV<ExpressionType> &&
+                  !std::is_reference_v<decltype(expression.materialize())>) {
+      matrix_types::matrix_common::combineDense<Operation>(
+          *m_matrixImpl, expression, operation);
+    } else if constexpr (std::is_same_v<Operation, std::plus<>>) {
+      *m_matrixImpl += matrix_types::materializeBuffered(expression);
+    } else {
+      *m_matrixImpl -= matrix_types::materializeBuffered(expression);
+    }
+
+    return *this;
+  }
+
+  /// @brief function to turn a MatrixAdt into an operand of an expression,
+  ///        referring to the wrapped matrix without any copy
+  /// @param matrix the MatrixAdt outliving the expression
+  /// @return leaf expression referring to the wrapped matrix
+  friend constexpr auto toExpression(const MatrixAdt& matrix) noexcept {
+    return matrix_types::TerminalExpression<MatrixT>{*matrix.m_matrixImpl};
+  }
+
+  /// @brief deleted overload of the function above for const temporaries,
+  ///        which could neither be referred to, as they are destroyed before
+  ///        the expression, nor moved from
+  friend auto toExpression(const MatrixAdt&&) = delete;
+
+  /// @brief function to turn a temporary MatrixAdt into an operand of an
+  ///        expression, taking the ownership of the wrapped matrix
+  /// @param matrix the temporary MatrixAdt
+  /// @return leaf expression owning the wrapped matrix
+  /// @throw std::bad_alloc if the shared ownership cannot be allocated
+  friend auto toExpression(MatrixAdt&& matrix) {
+    return matrix_types::TerminalExpression<MatrixT>{
+        std::move(matrix.m_matrixImpl)};
+  }
+
   /// @brief friending with other matrices types to access m_matrixImpl
   /// @tparam OtherMatrixT the other matrix that is constrainted
   ///         to MatrixAdtConcept
   template <matrix_types::MatrixAdtConcept OtherMatrixT>
   friend class MatrixAdt;
+
+  /// @brief friending with the formatter to access m_matrixImpl
+  friend struct std::formatter<MatrixAdt, char>;
 };
 
-}  // namespace data_structures
\ No newline at end of file
+/// @brief deduction guide to wrap the result of an expression in a MatrixAdt
+///        of the matrix type the expression evaluates to
+/// @tparam Expression type of the expression
+template <typename Expression>
+  requires matrix_types::MatrixExpression<Expression>
+MatrixAdt(Expression&&) -> MatrixAdt<std::remove_cvref_t<
+    decltype(std::declval<Expression>().materialize())>>;
+
+// arithmetic of MatrixAdt builds lazy expressions
+using matrix_types::evaluate;
+using matrix_types::multiplyChain;
+using matrix_types::transpose;
+using matrix_types::operator+;
+using matrix_types::operator-;
+using matrix_types::operator*;
+
+}  // namespace data_structures
+
+/// @brief formatter of MatrixAdt, formatting the wrapped matrix as its own
+///        formatter does, see matrix_common::MatrixFormatter
+/// @tparam MatrixT type of the wrapped matrix
+template <data_structures::matrix_types::MatrixAdtConcept MatrixT>
+struct std::formatter<data_structures::MatrixAdt<MatrixT>, char>
+    : std::formatter<MatrixT, char> {
+  /// @brief method to format a MatrixAdt
+  /// @param matrix the MatrixAdt to be formatted
+  /// @param context the format context to write the matrix to
+  /// @return iterator past the written matrix
+  auto format(const data_structures::MatrixAdt<MatrixT>& matrix,
+              auto& context) const {
+    return std::formatter<MatrixT, char>::format(*matrix.m_matrixImpl,
+                                                 context);
+  }
+};
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <format>
+#include <stdexcept>
+#include <type_traits>
+
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief helper function to multiply two matrices with the given
+///        accumulation policy, whose elements may be of different types
+///        when the policy converts them, e.g. WidenedAccumulation
+/// @tparam Accumulation accumulation policy
+/// @param firstMatrix first operand of matrices multiplication
+/// @param secondMatrix second operand of matrices multiplication
+/// @param executor optional executor to run the multiplication on
+/// @return NormalMatrix of the accumulator type of the policy when both
+///         operands are statically sized, a DynamicMatrix of it otherwise
+/// @throw std::invalid_argument if dimensions are not compatible
+template <typename Accumulation>
+static auto multiplyAccumulated(const auto& firstMatrix,
+                                const auto& secondMatrix,
+                                common::Executor auto&... executor) {
+  static_assert(sizeof...(executor) <= 1U, "Only one executor is accepted");
+
+  using FirstMatrixType = std::remove_cvref_t<decltype(firstMatrix)>;
+  using SecondMatrixType = std::remove_cvref_t<decltype(secondMatrix)>;
+  using accumulator_type = Accumulation::template accumulator_type<
+      typename FirstMatrixType::value_type>;
+
+  if constexpr (StaticallySized<FirstMatrixType> &&
+                StaticallySized<SecondMatrixType>) {
+    constexpr auto kRows{FirstMatrixType::dimensions().kRows};
+    constexpr auto kColumns{SecondMatrixType::dimensions().kColumns};
+
+    std::array<std::array<accumulator_type, kColumns>, kRows> resultElements;
+    multiplyRowsByColumns<Accumulation>(firstMatrix, secondMatrix,
+                                        resultElements, executor...);
+
+    return NormalMatrix<kRows, kColumns, accumulator_type>{resultElements};
+  } else {
+    if (numberOfColumns(firstMatrix) != numberOfRows(secondMatrix)) {
+      throw std::invalid_argument(
+          std::format("Cannot multiply [{}*{}] matrix by [{}*{}] matrix",
+                      numberOfRows(firstMatrix), numberOfColumns(firstMatrix),
+                      numberOfRows(secondMatrix),
+                      numberOfColumns(secondMatrix)));
+    }
+
+    DynamicMatrix<accumulator_type> result(numberOfRows(firstMatrix),
+                                           numberOfColumns(secondMatrix));
+    multiplyRowsByColumns<Accumulation>(firstMatrix, secondMatrix, result,
+                                        executor...);
+
+    return result;
+  }
+}
+
+}  // namespace matrix_common
+
+/// @brief function to multiply two matrices of any types, the sums of
+///        products being accumulated as the given policy tells, e.g. widened
+///        to a larger type, saturated or checked for overflow
+/// @tparam Accumulation accumulation policy, one of WrappingAccumulation,
+///         WidenedAccumulation, SaturatingAccumulation and
+///         CheckedAccumulation
+/// @param firstMatrix first operand of matrices multiplication
+/// @param secondMatrix second operand of matrices multiplication
+/// @param executor optional executor to run the multiplication on, otherwise
+///        it runs as the products of operator* do
+/// @return NormalMatrix of the accumulator type of the policy when both
+///         operands are statically sized, a DynamicMatrix of it otherwise
+/// @throw std::invalid_argument if dimensions are not compatible
+/// @throw std::overflow_error with CheckedAccumulation, if an element of the
+///        product overflows
+/// @note saturating and checked products are computed by the vectorized
+///       kernels, unchecked, whenever the largest elements of both operands
+///       prove that no element can overflow, which is the common case
+template <typename Accumulation>
+auto multiply(const auto& firstMatrix, const auto& secondMatrix,
+              common::Executor auto&... executor) {
+  static_assert(
+      std::is_same_v<
+          typename std::remove_cvref_t<decltype(secondMatrix)>::value_type,
+          typename std::remove_cvref_t<decltype(firstMatrix)>::value_type>,
+      "Element types are not the same");
+
+  return matrix_common::multiplyAccumulated<Accumulation>(
+      firstMatrix, secondMatrix, executor...);
+}
+
+}  // namespace data_structures::matrix_types
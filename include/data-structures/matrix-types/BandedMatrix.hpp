@@ -0,0 +1,511 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <format>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixFormat.hpp"
+#include "data-structures/matrix-types/MatrixViews.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief concept for the banded matrices whose band fits within a number of
+///        diagonals on each side of the main one
+/// @tparam MatrixT the type in question
+/// @tparam LOWER number of diagonals allowed below the main one
+/// @tparam UPPER number of diagonals allowed above the main one
+template <typename MatrixT, std::size_t LOWER, std::size_t UPPER>
+concept BandedWithin = requires {
+  requires MatrixT::bandwidths().first <= LOWER;
+  requires MatrixT::bandwidths().second <= UPPER;
+};
+
+}  // namespace matrix_common
+
+/// @brief definition of class representing banded Matrix, whose non-zero
+///        elements all lie within a number of diagonals around the main one
+/// @tparam N number of rows and columns of the matrix
+/// @tparam LOWER number of diagonals stored below the main one
+/// @tparam UPPER number of diagonals stored above the main one
+/// @tparam T type of elements of matrix, default is std::size_t
+/// @note each row is stored in a slot of LOWER + UPPER + 1 elements, its
+///       element at column j being at j + LOWER - i, so both rows and columns
+///       are read at a constant stride, slots of the first and last rows
+///       being padded with zeros, as are the ones of a band wider than the
+///       matrix
+template <common::NaturalNumber auto N, std::size_t LOWER, std::size_t UPPER,
+          typename T = std::size_t>
+class BandedMatrix {
+public:
+  /// @brief to handle when passing empty list
+  constexpr BandedMatrix() = default;
+
+  /// @brief constructor that accepts multiple braced init lists
+  /// @tparam ...Rows parameter pack for the braced init lists passed
+  /// @param ...rows parameter pack passes to fill the elements of the band,
+  ///        each row starting from its first column within the band
+  /// @note when passing a row shorter than the band, the remaining elements
+  ///       till the end of the band are set to zero, while when passing a
+  ///       row longer, extra elements are ignored
+  template <typename... Rows>
+  constexpr explicit BandedMatrix(std::initializer_list<Rows>&&... rows) {
+    static_assert(sizeof...(rows) <= N);
+
+    std::size_t rowIndex{0U};
+    for (const auto& row : {rows...}) {
+      const auto length{
+          std::min(row.size(), lastColumn(rowIndex) - firstColumn(rowIndex))};
+      std::copy_n(row.begin(), length,
+                  rowOrigin(rowIndex) + firstColumn(rowIndex));
+      ++rowIndex;
+    }
+  }
+
+  /// @brief converting constructor from any other square matrix type of the
+  ///        same size, e.g. to store a dense matrix found banded in the band
+  /// @param matrix the matrix to copy the band of
+  /// @note elements off the band are dropped, so isBanded() of the matrix
+  ///       tells whether the conversion is lossless
+  template <typename MatrixT>
+    requires(!std::is_same_v<MatrixT, BandedMatrix> &&
+             std::is_same_v<typename MatrixT::value_type, T> &&
+             matrix_common::StaticallySized<MatrixT>)
+  constexpr explicit BandedMatrix(const MatrixT& matrix) {
+    static_assert(MatrixT::dimensions().kRows == N &&
+                      MatrixT::dimensions().kColumns == N,
+                  "Dimensions are not the same");
+
+    for (std::size_t rowIndex{0U}; rowIndex < N; ++rowIndex) {
+      const auto first{firstColumn(rowIndex)};
+      matrix.rowView(rowIndex).copyTo(first, lastColumn(rowIndex),
+                                      rowOrigin(rowIndex) + first);
+    }
+  }
+
+  /// @brief a constexpr method to return the [n*m] dimensions of the matrix
+  /// @return a MatrixDimension object representing [n*m] dimensions
+  static constexpr auto dimensions() noexcept {
+    return matrix_common::MatrixDimensions<N, N>{};
+  }
+
+  /// @brief a constexpr method to return the number of diagonals stored on
+  ///        each side of the main one
+  /// @return a pair of the numbers of diagonals below and above the main one
+  static constexpr auto bandwidths() noexcept {
+    return std::pair<std::size_t, std::size_t>{LOWER, UPPER};
+  }
+
+  /// @brief method to return the row in matrix at a given index
+  /// @param index at which row should be returned
+  /// @return the row at the given index
+  constexpr auto row(std::size_t index) const {
+    std::array<T, N> result;
+    rowView(index).copyTo(result.begin());
+
+    return result;
+  }
+
+  /// @brief method to return the column at the given index
+  /// @param index at which column should be returned
+  /// @return the column at the given index
+  constexpr auto column(std::size_t index) const {
+    std::array<T, N> result;
+    columnView(index).copyTo(result.begin());
+
+    return result;
+  }
+
+  /// @brief method to return a view of the row at a given index, reading
+  ///        directly from the stored band
+  /// @param index at which row should be viewed
+  /// @return view of the row, its elements off the band are zeros
+  /// @note no range checking is done here
+  constexpr auto rowView(std::size_t index) const noexcept {
+    const auto first{firstColumn(index)};
+    return LineView<T>{rowOrigin(index) + first, N,
+                       {first, lastColumn(index), 1U}};
+  }
+
+  /// @brief method to return a view of the column at a given index, reading
+  ///        directly from the stored band
+  /// @param index at which column should be viewed
+  /// @return view of the column, its elements off the band are zeros
+  /// @note no range checking is done here
+  constexpr auto columnView(std::size_t index) const noexcept {
+    const auto first{index > UPPER ? index - UPPER : 0U};
+    return LineView<T>{rowOrigin(first) + index, N,
+                       {first, std::min(index + LOWER + 1U, std::size_t{N}),
+                        kSlotWidth - 1U}};
+  }
+
+  /// @brief method that returns RowsIterator to traverse through each row
+  /// @return RowsIterator object pointing to first row, yielding views
+  constexpr auto rows() const noexcept {
+    return matrix_common::RowsIterator<BandedMatrix>(*this);
+  }
+
+  /// @brief method that returns ColumnsIterator to traverse through
+  ///        each column
+  /// @return ColumnsIterator object pointing to first column, yielding views
+  constexpr auto columns() const noexcept {
+    return matrix_common::ColumnsIterator<BandedMatrix>(*this);
+  }
+
+  /// @brief generic multiplication operator
+  /// @param otherMatrix the second operand of multiplication
+  /// @return BandedMatrix when multiplied by another banded matrix, with the
+  ///         bandwidths of both summed up, NormalMatrix otherwise
+  /// @note large products run in parallel, see
+  ///       matrix_common::parallelThreshold()
+  auto operator*(const auto& otherMatrix) const {
+    return multiply(otherMatrix);
+  }
+
+  /// @brief generic multiplication method that optionally accepts the
+  ///        executor to run on, e.g. a common::ThreadPool shared by several
+  ///        products
+  /// @param otherMatrix the second operand of multiplication
+  /// @param executor optional executor to run the multiplication on
+  /// @return BandedMatrix when multiplied by another banded matrix, with the
+  ///         bandwidths of both summed up, NormalMatrix otherwise
+  /// @note only the band of this matrix is walked, and the band of the other
+  ///       one too if banded, so the product of banded matrices costs
+  ///       O(N * bandwidth * other bandwidth)
+  auto multiply(const auto& otherMatrix,
+                common::Executor auto&... executor) const {
+    static_assert(sizeof...(executor) <= 1U, "Only one executor is accepted");
+
+    using OtherMatrixType = std::remove_cvref_t<decltype(otherMatrix)>;
+
+    static_assert(
+        std::is_same_v<typename OtherMatrixType::value_type, value_type>,
+        "Element types are not the same");
+
+    if constexpr (!matrix_common::StaticallySized<OtherMatrixType>) {
+      // dimensions of the result are only known at runtime
+      return multiplyToDynamicMatrix(*this, otherMatrix, executor...);
+    } else {
+      // assert dimensons are compatible
+      static_assert(N == otherMatrix.dimensions().kRows);
+
+      if constexpr (requires { OtherMatrixType::bandwidths(); }) {
+        // product of banded matrices is banded, its bandwidths being the
+        // sums of theirs, so it is accumulated directly into the band
+        constexpr auto kOtherBandwidths{OtherMatrixType::bandwidths()};
+        constexpr auto kLast{std::size_t{N} - 1U};
+        BandedMatrix<N, std::min(LOWER + kOtherBandwidths.first, kLast),
+                     std::min(UPPER + kOtherBandwidths.second, kLast), T>
+            result{};
+        matrix_common::multiplyStoredElements(
+            *this, otherMatrix,
+            [&result](std::size_t rowIndex) {
+              return result.rowOrigin(rowIndex);
+            },
+            executor...);
+
+        return result;
+      } else {
+        constexpr auto kNoOfOtherMatrixColumns{
+            otherMatrix.dimensions().kColumns};
+        std::array<std::array<value_type, kNoOfOtherMatrixColumns>, N>
+            resultElements{};
+
+        // only the band of this matrix is walked
+        matrix_common::multiplyStoredElements(
+            *this, otherMatrix,
+            [&resultElements](std::size_t rowIndex) {
+              return resultElements[rowIndex].data();
+            },
+            executor...);
+
+        return NormalMatrix<N, kNoOfOtherMatrixColumns, T>{resultElements};
+      }
+    }
+  }
+
+  /// @brief method to multiply the matrix by a vector
+  /// @param vector the vector to multiply by
+  /// @return the product of the matrix by the vector
+  /// @note it is the GEMV below with alpha of one and beta of zero
+  auto multiplyVector(const std::array<T, N>& vector) const
+      -> std::array<T, N> {
+    std::array<T, N> result{};
+    multiplyVector(T{1}, std::span<const T>{vector}, T{}, std::span<T>{result});
+    return result;
+  }
+
+  /// @brief compound addition operator, adding a banded matrix of a band as
+  ///        narrow as this one, or a diagonal matrix, to this one in place
+  /// @tparam OtherMatrixT type of the other matrix
+  /// @param otherMatrix the matrix to add
+  /// @return reference to this matrix
+  template <typename OtherMatrixT>
+    requires((std::is_same_v<typename OtherMatrixT::value_type, T> &&
+              OtherMatrixT::dimensions().kRows == N &&
+              matrix_common::BandedWithin<OtherMatrixT, LOWER, UPPER>) ||
+             std::is_same_v<OtherMatrixT, DiagonalMatrix<N, T>>)
+  auto operator+=(const OtherMatrixT& otherMatrix) -> BandedMatrix& {
+    return accumulate(otherMatrix, T{1});
+  }
+
+  /// @brief compound subtraction operator, subtracting a banded matrix of a
+  ///        band as narrow as this one, or a diagonal matrix, from this one
+  ///        in place
+  /// @tparam OtherMatrixT type of the other matrix
+  /// @param otherMatrix the matrix to subtract
+  /// @return reference to this matrix
+  template <typename OtherMatrixT>
+    requires((std::is_same_v<typename OtherMatrixT::value_type, T> &&
+              OtherMatrixT::dimensions().kRows == N &&
+              matrix_common::BandedWithin<OtherMatrixT, LOWER, UPPER>) ||
+             std::is_same_v<OtherMatrixT, DiagonalMatrix<N, T>>)
+  auto operator-=(const OtherMatrixT& otherMatrix) -> BandedMatrix& {
+    return accumulate(otherMatrix, T{} - T{1});
+  }
+
+  /// @brief compound multiplication operator by a scalar
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  constexpr auto operator*=(const T& factor) noexcept -> BandedMatrix& {
+    return scale(factor);
+  }
+
+  /// @brief method to multiply all elements by a scalar in place
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  /// @note only the band is touched, its padding staying zeros
+  constexpr auto scale(const T& factor) noexcept -> BandedMatrix& {
+    for (auto& element : m_elements) {
+      element *= factor;
+    }
+
+    return *this;
+  }
+
+  /// @brief method to check whether matrix is symmetric or not
+  /// @return true if it's symmetric, false otherwise
+  /// @note only the band is compared, elements of the wider side of the band
+  ///       without a mirror within the narrower one must be zeros
+  constexpr auto isSymmetric() const noexcept -> bool {
+    constexpr auto kWidest{std::max(LOWER, UPPER)};
+
+    for (std::size_t rowIndex{0U}; rowIndex < N; ++rowIndex) {
+      const auto row{rowView(rowIndex)};
+      const auto last{std::min(rowIndex + kWidest + 1U, std::size_t{N})};
+      for (auto j{rowIndex + 1U}; j < last; ++j) {
+        if (row[j] != rowView(j)[rowIndex]) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  /// @brief method to check whether all elements are zeros beyond a number of
+  ///        diagonals on both sides of the main one
+  /// @param bandwidth number of diagonals allowed on each side
+  /// @return true if no element of the band is non-zero beyond them
+  constexpr auto isBanded(std::size_t bandwidth) const noexcept -> bool {
+    if (bandwidth >= LOWER && bandwidth >= UPPER) {
+      return true;
+    }
+
+    for (std::size_t rowIndex{0U}; rowIndex < N; ++rowIndex) {
+      const auto* const row{rowOrigin(rowIndex)};
+      for (auto j{firstColumn(rowIndex)}; j < lastColumn(rowIndex); ++j) {
+        const auto distance{j > rowIndex ? j - rowIndex : rowIndex - j};
+        if (distance > bandwidth && row[j] != T{}) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  /// @brief method to check whether all elements off the diagonal are zeros
+  /// @return true if the band holds only its main diagonal
+  constexpr auto isDiagonal() const noexcept -> bool { return isBanded(0U); }
+
+  /// @brief method to check whether all elements above the diagonal are zeros
+  /// @return true if no element of the band above the diagonal is non-zero
+  constexpr auto isLowerTriangular() const noexcept -> bool {
+    for (std::size_t rowIndex{0U}; rowIndex < N; ++rowIndex) {
+      const auto* const row{rowOrigin(rowIndex)};
+      if (!std::all_of(row + rowIndex + 1U, row + lastColumn(rowIndex),
+                       [](const T& element) { return element == T{}; })) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /// @brief method to multiply the matrix by a vector and to accumulate the
+  ///        scaled product into another vector, y = alpha * A * x + beta * y
+  ///        (GEMV), on the given executor
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @param executor executor to run blocks of rows on
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  /// @note only the band of each row is multiplied by x; x and y must not
+  ///       overlap
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result,
+                      common::Executor auto& executor) const {
+    matrix_common::checkGemvLengths(*this, vector.size(), result.size());
+    matrix_common::multiplyRowsByVector(
+        alpha, beta, result,
+        [this, vector](std::size_t rowIndex) {
+          const auto first{firstColumn(rowIndex)};
+          return simd_kernels::dot(rowOrigin(rowIndex) + first,
+                                   vector.data() + first,
+                                   lastColumn(rowIndex) - first);
+        },
+        executor);
+  }
+
+  /// @brief overload of the method above that runs serially, unless the
+  ///        product has as many multiply-adds as parallelThreshold(), then
+  ///        it runs over common::ThreadPool::shared()
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result) const {
+    matrix_common::runMatrixVectorProduct(
+        std::size_t{N} * (LOWER + UPPER + 1U), [&](auto& executor) {
+          multiplyVector(alpha, vector, beta, result, executor);
+        });
+  }
+
+  /// @brief method to display elements of the matrix
+  /// @return elements surrounded by matrix symbol
+  [[nodiscard]] constexpr auto display() const noexcept -> std::string {
+    std::string result;
+    formatMatrixTo(std::back_inserter(result), *this);
+
+    return result;
+  }
+
+  /// @brief type alias for T, used for assertions
+  using value_type = T;
+
+private:
+  /// @brief banded matrices of other bandwidths, whose products are written
+  ///        directly into the band of the result
+  template <common::NaturalNumber auto, std::size_t, std::size_t, typename>
+  friend class BandedMatrix;
+
+  /// @brief number of elements stored per row
+  static constexpr std::size_t kSlotWidth{LOWER + UPPER + 1U};
+
+  /// @brief elements of the band, row by row
+  std::array<T, N * kSlotWidth> m_elements{};
+
+  /// @brief helper constexpr method to return the first column of a row
+  ///        within the band
+  /// @param rowIndex index of the row
+  /// @return the first column stored
+  static constexpr auto firstColumn(std::size_t rowIndex) noexcept
+      -> std::size_t {
+    return rowIndex > LOWER ? rowIndex - LOWER : 0U;
+  }
+
+  /// @brief helper constexpr method to return past the last column of a row
+  ///        within the band
+  /// @param rowIndex index of the row
+  /// @return past the last column stored
+  static constexpr auto lastColumn(std::size_t rowIndex) noexcept
+      -> std::size_t {
+    return std::min(rowIndex + UPPER + 1U, std::size_t{N});
+  }
+
+  /// @brief helper method to return the pointer at which the element of the
+  ///        first column of a row would be stored, so that the elements of
+  ///        the band are addressed by their column
+  /// @param rowIndex index of the row
+  /// @return pointer to the, maybe not stored, element of the first column
+  /// @note only the elements within the band may be dereferenced
+  constexpr auto rowOrigin(std::size_t rowIndex) const noexcept -> const T* {
+    return m_elements.data() + (rowIndex * kSlotWidth) + LOWER - rowIndex;
+  }
+
+  /// @brief non-const overload of the method above
+  constexpr auto rowOrigin(std::size_t rowIndex) noexcept -> T* {
+    return m_elements.data() + (rowIndex * kSlotWidth) + LOWER - rowIndex;
+  }
+
+  /// @brief helper method to add another matrix scaled by a factor to this
+  ///        one in place
+  /// @param otherMatrix the matrix to add
+  /// @param factor factor to scale the other matrix by
+  /// @return reference to this matrix
+  auto accumulate(const auto& otherMatrix, const T& factor) -> BandedMatrix& {
+    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(otherMatrix)>,
+                                 BandedMatrix>) {
+      // both bands are stored the same, hence added in one pass
+      simd_kernels::multiplyAdd(std::array<T, 1U>{factor},
+                                otherMatrix.m_elements.data(),
+                                std::array<T*, 1U>{m_elements.data()},
+                                m_elements.size());
+    } else {
+      matrix_common::accumulateStoredRows(
+          otherMatrix, factor,
+          [this](std::size_t rowIndex) { return rowOrigin(rowIndex); });
+    }
+
+    return *this;
+  }
+};
+
+/// @brief type alias for tridiagonal matrices, i.e. banded ones with a single
+///        diagonal on each side of the main one
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix, default is std::size_t
+template <common::NaturalNumber auto N, typename T = std::size_t>
+using TridiagonalMatrix = BandedMatrix<N, 1U, 1U, T>;
+
+/// @brief derive in a non-intrusive way of the MatrixAdt type
+/// @tparam N number of rows and columns of the matrix
+/// @tparam LOWER number of diagonals stored below the main one
+/// @tparam UPPER number of diagonals stored above the main one
+/// @tparam T type of elements of matrix
+template <common::NaturalNumber auto N, std::size_t LOWER, std::size_t UPPER,
+          typename T>
+class IsMatrixAdt<BandedMatrix<N, LOWER, UPPER, T>> : public std::true_type {};
+
+/// @brief banded matrix stores only the band of each row
+/// @tparam N number of rows and columns of the matrix
+/// @tparam LOWER number of diagonals stored below the main one
+/// @tparam UPPER number of diagonals stored above the main one
+/// @tparam T type of elements of matrix
+template <common::NaturalNumber auto N, std::size_t LOWER, std::size_t UPPER,
+          typename T>
+class HasPackedRows<BandedMatrix<N, LOWER, UPPER, T>>
+    : public std::true_type {};
+
+}  // namespace data_structures::matrix_types
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <format>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief number of matrices of a batch interleaved together, a multiple of
+///        the lanes of every vector register, so that each lane holds an
+///        element of a different matrix
+static constexpr std::size_t kBatchLanes{32U};
+
+/// @brief number of groups of kBatchLanes matrices multiplied by a single
+///        task, sharing the interleaved buffers
+static constexpr std::size_t kBatchGroupsPerTask{8U};
+
+/// @brief helper function to interleave a group of matrices, so that the
+///        elements at the same position of all of them are contiguous
+/// @param matrices the matrices of the group, at most kBatchLanes
+/// @param interleaved buffer of kBatchLanes times the elements of a matrix,
+///        element (i, j) of matrix m being stored at
+///        ((i * COLUMNS) + j) * kBatchLanes + m
+template <typename MatrixT>
+static void interleaveBatch(std::span<const MatrixT> matrices,
+                            typename MatrixT::value_type* interleaved) {
+  constexpr auto kRows{MatrixT::dimensions().kRows};
+  constexpr auto kColumns{MatrixT::dimensions().kColumns};
+
+  for (std::size_t m{0U}; m < matrices.size(); ++m) {
+    for (std::size_t i{0U}; i < kRows; ++i) {
+      const auto* const row{matrices[m].rowData(i)};
+      for (std::size_t j{0U}; j < kColumns; ++j) {
+        interleaved[(((i * kColumns) + j) * kBatchLanes) + m] = row[j];
+      }
+    }
+  }
+}
+
+/// @brief helper function to scatter interleaved elements back into a group
+///        of matrices, the inverse of interleaveBatch()
+/// @param interleaved buffer the elements are interleaved in
+/// @param matrices the matrices of the group, at most kBatchLanes
+template <typename MatrixT>
+static void deinterleaveBatch(const typename MatrixT::value_type* interleaved,
+                              std::span<MatrixT> matrices) {
+  constexpr auto kRows{MatrixT::dimensions().kRows};
+  constexpr auto kColumns{MatrixT::dimensions().kColumns};
+
+  for (std::size_t m{0U}; m < matrices.size(); ++m) {
+    for (std::size_t i{0U}; i < kRows; ++i) {
+      auto* const row{matrices[m].rowData(i)};
+      for (std::size_t j{0U}; j < kColumns; ++j) {
+        row[j] = interleaved[(((i * kColumns) + j) * kBatchLanes) + m];
+      }
+    }
+  }
+}
+
+/// @brief helper function to multiply a group of interleaved matrices by
+///        another, lane by lane
+/// @tparam ROWS number of rows of the first matrices
+/// @tparam INNER number of columns of the first matrices
+/// @tparam COLUMNS number of columns of the second matrices
+/// @tparam T type of elements of matrices
+/// @param first the interleaved first operands
+/// @param second the interleaved second operands
+/// @param result buffer to hold the interleaved products
+/// @param lanes number of matrices of the group
+/// @note every step is an element-wise multiply-add over the lanes, so that
+///       a single vector instruction advances the products of several
+///       matrices, whatever their size is
+template <std::size_t ROWS, std::size_t INNER, std::size_t COLUMNS,
+          typename T>
+static void multiplyInterleaved(const T* first, const T* second, T* result,
+                                std::size_t lanes) {
+  std::fill_n(result, ROWS * COLUMNS * kBatchLanes, T{});
+
+  for (std::size_t i{0U}; i < ROWS; ++i) {
+    for (std::size_t k{0U}; k < INNER; ++k) {
+      const auto* const factors{first + (((i * INNER) + k) * kBatchLanes)};
+      for (std::size_t j{0U}; j < COLUMNS; ++j) {
+        simd_kernels::multiplyAddElementwise(
+            factors, second + (((k * COLUMNS) + j) * kBatchLanes),
+            result + (((i * COLUMNS) + j) * kBatchLanes), lanes);
+      }
+    }
+  }
+}
+
+}  // namespace matrix_common
+
+/// @brief function to multiply a batch of small matrices by another, pair by
+///        pair, e.g. thousands of 4x4 transforms, on the given executor
+/// @param first contiguous range of the first operands, e.g. a std::span of
+///        NormalMatrix
+/// @param second contiguous range of the second operands, one per first one
+/// @param result contiguous range of NormalMatrix to hold the products, one
+///        per first operand
+/// @param executor executor to run groups of matrices on
+/// @throw std::invalid_argument if the ranges are not of the same size
+/// @note matrices are interleaved by groups of kBatchLanes, structure of
+///       arrays, so that the lanes of the vectorized kernels span different
+///       matrices instead of the few elements of a row. Each product is
+///       computed in the same order as NormalMatrix::multiply(), hence the
+///       same results
+void multiplyBatched(const std::ranges::contiguous_range auto& first,
+                     const std::ranges::contiguous_range auto& second,
+                     std::ranges::contiguous_range auto&& result,
+                     common::Executor auto& executor) {
+  using FirstMatrixType =
+      std::ranges::range_value_t<std::remove_cvref_t<decltype(first)>>;
+  using SecondMatrixType =
+      std::ranges::range_value_t<std::remove_cvref_t<decltype(second)>>;
+  using ResultMatrixType =
+      std::ranges::range_value_t<std::remove_cvref_t<decltype(result)>>;
+
+  // type alias for element type in in either of both matrices
+  using value_type = FirstMatrixType::value_type;  // or SecondMatrixType
+
+  static_assert(
+      std::is_same_v<typename SecondMatrixType::value_type, value_type> &&
+          std::is_same_v<typename ResultMatrixType::value_type, value_type>,
+      "Element types are not the same");
+
+  constexpr std::size_t kRows{FirstMatrixType::dimensions().kRows};
+  constexpr std::size_t kInner{FirstMatrixType::dimensions().kColumns};
+  constexpr std::size_t kColumns{SecondMatrixType::dimensions().kColumns};
+  static_assert(SecondMatrixType::dimensions().kRows == kInner);
+  static_assert(ResultMatrixType::dimensions().kRows == kRows &&
+                ResultMatrixType::dimensions().kColumns == kColumns);
+
+  constexpr auto kLanes{matrix_common::kBatchLanes};
+  constexpr auto kGroupsPerTask{matrix_common::kBatchGroupsPerTask};
+
+  const std::span<const FirstMatrixType> firstMatrices{first};
+  const std::span<const SecondMatrixType> secondMatrices{second};
+  const std::span<ResultMatrixType> resultMatrices{result};
+  const auto batchSize{firstMatrices.size()};
+
+  if (secondMatrices.size() != batchSize ||
+      resultMatrices.size() != batchSize) {
+    throw std::invalid_argument(std::format(
+        "Cannot multiply batches of {} and {} matrices into {} products",
+        batchSize, secondMatrices.size(), resultMatrices.size()));
+  }
+
+  const auto groups{(batchSize + kLanes - 1U) / kLanes};
+  executor.parallelFor(
+      (groups + kGroupsPerTask - 1U) / kGroupsPerTask,
+      [firstMatrices, secondMatrices, resultMatrices,
+       batchSize](std::size_t task) {
+        constexpr auto kFirstSize{kRows * kInner * kLanes};
+        constexpr auto kSecondSize{kInner * kColumns * kLanes};
+
+        // allocated once per task, all of its groups reuse it
+        matrix_common::Workspace<value_type> interleaved(
+            kFirstSize + kSecondSize + (kRows * kColumns * kLanes));
+        auto* const interleavedFirst{interleaved.data()};
+        auto* const interleavedSecond{interleavedFirst + kFirstSize};
+        auto* const interleavedResult{interleavedSecond + kSecondSize};
+
+        const auto taskBegin{task * kGroupsPerTask * kLanes};
+        const auto taskEnd{
+            std::min(taskBegin + (kGroupsPerTask * kLanes), batchSize)};
+        for (auto offset{taskBegin}; offset < taskEnd; offset += kLanes) {
+          const auto lanes{
+              std::min(matrix_common::kBatchLanes, taskEnd - offset)};
+
+          matrix_common::interleaveBatch(
+              firstMatrices.subspan(offset, lanes), interleavedFirst);
+          matrix_common::interleaveBatch(
+              secondMatrices.subspan(offset, lanes), interleavedSecond);
+          matrix_common::multiplyInterleaved<kRows, kInner, kColumns>(
+              interleavedFirst, interleavedSecond, interleavedResult, lanes);
+          matrix_common::deinterleaveBatch(
+              interleavedResult, resultMatrices.subspan(offset, lanes));
+        }
+      });
+}
+
+/// @brief overload of the function above that runs serially, unless the
+///        multiply-adds of the whole batch are as many as
+///        parallelThreshold(), then it runs over common::ThreadPool::shared()
+/// @param first contiguous range of the first operands, e.g. a std::span of
+///        NormalMatrix
+/// @param second contiguous range of the second operands, one per first one
+/// @param result contiguous range of NormalMatrix to hold the products, one
+///        per first operand
+/// @throw std::invalid_argument if the ranges are not of the same size
+void multiplyBatched(const std::ranges::contiguous_range auto& first,
+                     const std::ranges::contiguous_range auto& second,
+                     std::ranges::contiguous_range auto&& result) {
+  using FirstMatrixType =
+      std::ranges::range_value_t<std::remove_cvref_t<decltype(first)>>;
+  using SecondMatrixType =
+      std::ranges::range_value_t<std::remove_cvref_t<decltype(second)>>;
+
+  const auto multiplyAdds{std::ranges::size(first) *
+                          FirstMatrixType::dimensions().kRows *
+                          FirstMatrixType::dimensions().kColumns *
+                          SecondMatrixType::dimensions().kColumns};
+
+  if (multiplyAdds <
+      matrix_common::parallelThreshold().load(std::memory_order_relaxed)) {
+    common::SerialExecutor executor;
+    multiplyBatched(first, second, result, executor);
+  } else {
+    multiplyBatched(first, second, result, common::ThreadPool::shared());
+  }
+}
+
+}  // namespace data_structures::matrix_types
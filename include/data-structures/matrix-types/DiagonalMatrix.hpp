@@ -4,13 +4,20 @@
 #include <concepts>
 #include <cstddef>
 #include <format>
+#include <iterator>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 
 #include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
 #include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixFormat.hpp"
+#include "data-structures/matrix-types/MatrixViews.hpp"
 #include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
 
 /// @brief namespace for matrices types
 namespace data_structures::matrix_types {
@@ -31,6 +38,25 @@ public:
   constexpr explicit DiagonalMatrix(Elems&&... elems)
       : m_elements{std::forward<Elems>(elems)...} {}
 
+  /// @brief converting constructor from any other square matrix type of the
+  ///        same size, e.g. to store a dense matrix found diagonal
+  /// @param matrix the matrix to copy the diagonal of
+  /// @note elements off the diagonal are dropped, so isDiagonal() of the
+  ///       matrix tells whether the conversion is lossless
+  template <typename MatrixT>
+    requires(!std::is_same_v<MatrixT, DiagonalMatrix> &&
+             std::is_same_v<typename MatrixT::value_type, T> &&
+             matrix_common::StaticallySized<MatrixT>)
+  constexpr explicit DiagonalMatrix(const MatrixT& matrix) {
+    static_assert(MatrixT::dimensions().kRows == N &&
+                      MatrixT::dimensions().kColumns == N,
+                  "Dimensions are not the same");
+
+    for (std::size_t index{0U}; index < N; ++index) {
+      m_elements[index] = matrix.rowView(index)[index];
+    }
+  }
+
   /// @brief a constexpr method to return the [n*m] dimensions of the matrix
   /// @return a MatrixDimension object representing [n*m] dimensions
   static constexpr auto dimensions() noexcept {
@@ -46,8 +72,8 @@ public:
           std::format("Rows must be within the range: 0 - {}", N - 1));
     }
 
-    std::array<T, N> row{};
-    row[index] = m_elements[index];
+    std::array<T, N> row;
+    rowView(index).copyTo(row.begin());
 
     return row;
   }
@@ -60,10 +86,45 @@ public:
     return row(index);
   }
 
+  /// @brief method to return a view of the row at a given index, reading
+  ///        directly from the diagonal elements
+  /// @param index at which row should be viewed
+  /// @return view of the row, all its elements but the diagonal are zeros
+  /// @note no range checking is done here
+  constexpr auto rowView(std::size_t index) const noexcept {
+    return LineView<T>{m_elements.data() + index, N, {index, index + 1U, 1U}};
+  }
+
+  /// @brief method to return a view of the column at a given index
+  /// @param index at which column should be viewed
+  /// @return view of the column, all its elements but the diagonal are zeros
+  /// @note no range checking is done here
+  constexpr auto columnView(std::size_t index) const noexcept {
+    // by defintion of diagonal matrix, rows and columns are the same
+    return rowView(index);
+  }
+
+  /// @brief method that returns RowsIterator to traverse through each row
+  /// @return RowsIterator object pointing to first row, yielding views
+  constexpr auto rows() const noexcept {
+    return matrix_common::RowsIterator<DiagonalMatrix>(*this);
+  }
+
+  /// @brief method that returns ColumnsIterator to traverse through
+  ///        each column
+  /// @return ColumnsIterator object pointing to first column, yielding views
+  constexpr auto columns() const noexcept {
+    return matrix_common::ColumnsIterator<DiagonalMatrix>(*this);
+  }
+
   /// @brief multiplication operator that multiplies diagonal Matrix with
-  ///        another and returns a result in NormalMatrix type
+  ///        another, keeping the structure of the other matrix when possible
   /// @param otherMatrix
-  /// @return the product of both matrices represented by NormalMatrix
+  /// @return DiagonalMatrix when multiplied by another diagonal matrix,
+  ///         LowerTriangularMatrix when multiplied by a lower triangular one,
+  ///         NormalMatrix otherwise
+  /// @note multiplying by a diagonal matrix only scales the rows of the other
+  ///       matrix, so only the stored elements of the other one are touched
   auto operator*(const auto& otherMatrix) const {
     // assert both types are the same
     using OtherMatrixType =
@@ -73,34 +134,117 @@ public:
         std::is_same_v<typename OtherMatrixType::value_type, value_type>,
         "Element types are not the same");
 
-    // assert dimensons are compatible
-    static_assert(N == otherMatrix.dimensions().kRows);
+    if constexpr (!matrix_common::StaticallySized<OtherMatrixType>) {
+      // dimensions of the result are only known at runtime
+      return multiplyToDynamicMatrix(*this, otherMatrix);
+    } else {
+      // assert dimensons are compatible
+      static_assert(N == otherMatrix.dimensions().kRows);
+
+      constexpr auto kNoOfOtherMatrixColumns{otherMatrix.dimensions().kColumns};
+
+      if constexpr (std::is_same_v<OtherMatrixType, DiagonalMatrix>) {
+        // product of diagonal matrices is their element-wise product
+        ElementsType resultElements{};
+        simd_kernels::multiplyAddElementwise(
+            m_elements.data(), otherMatrix.m_elements.data(),
+            resultElements.data(), N);
+
+        return DiagonalMatrix{resultElements};
+      } else if constexpr (std::is_same_v<OtherMatrixType,
+                                          LowerTriangularMatrix<N, T>>) {
+        // scaling rows of lower triangular matrix keeps it lower triangular
+        typename OtherMatrixType::PackedElementsType resultElements{};
+        matrix_common::multiplyStoredElements(
+            *this, otherMatrix, [&resultElements](std::size_t rowIndex) {
+              return resultElements.data() +
+                     matrix_common::numberOfTriangleElements(rowIndex);
+            });
+
+        return OtherMatrixType{resultElements};
+      } else if constexpr (kNoOfOtherMatrixColumns == 1U &&
+                           requires { otherMatrix.rowData(0U); }) {
+        // a column vector is scaled element-wise, its elements are
+        // contiguous in the storage of the other matrix
+        ElementsType column{};
+        simd_kernels::multiplyAddElementwise(
+            m_elements.data(), otherMatrix.rowData(0U), column.data(), N);
+
+        // rows of the result are single elements, each one its own array
+        std::array<std::array<value_type, 1U>, N> resultElements;
+        for (std::size_t i{0U}; i < N; ++i) {
+          resultElements[i][0U] = column[i];
+        }
+
+        return NormalMatrix<N, 1U, T>{resultElements};
+      } else {
+        std::array<std::array<value_type, kNoOfOtherMatrixColumns>, N>
+            resultElements{};  // or use OtherMatrixType::value_type, since
+                               // assertion should've passed above
+
+        // an optimized way of diagonal matrix multiplication, each row of the
+        // other matrix is scaled by the corresponding diagonal element
+        matrix_common::multiplyStoredElements(
+            *this, otherMatrix, [&resultElements](std::size_t rowIndex) {
+              return resultElements[rowIndex].data();
+            });
+
+        return NormalMatrix<N, kNoOfOtherMatrixColumns, T>{resultElements};
+      }
+    }
+  }
+
+  /// @brief compound addition operator, adding another diagonal matrix to
+  ///        this one in place
+  /// @param otherMatrix the matrix to add
+  /// @return reference to this matrix
+  auto operator+=(const DiagonalMatrix& otherMatrix) -> DiagonalMatrix& {
+    simd_kernels::multiplyAdd(std::array<T, 1U>{T{1}},
+                              otherMatrix.m_elements.data(),
+                              std::array<T*, 1U>{m_elements.data()}, N);
+    return *this;
+  }
+
+  /// @brief compound subtraction operator, subtracting another diagonal
+  ///        matrix from this one in place
+  /// @param otherMatrix the matrix to subtract
+  /// @return reference to this matrix
+  auto operator-=(const DiagonalMatrix& otherMatrix) -> DiagonalMatrix& {
+    simd_kernels::multiplyAdd(std::array<T, 1U>{T{} - T{1}},
+                              otherMatrix.m_elements.data(),
+                              std::array<T*, 1U>{m_elements.data()}, N);
+    return *this;
+  }
 
-    constexpr auto kNoOfOtherMatrixColumns{otherMatrix.dimensions().kColumns};
-    std::array<std::array<value_type, kNoOfOtherMatrixColumns>, N>
-        resultElements;  // or use OtherMatrixType::value_type, since
-                         // assertion should've passed above
+  /// @brief compound multiplication operator by another diagonal matrix,
+  ///        i.e. an element-wise product of both diagonals in place
+  /// @param otherMatrix the second operand of multiplication
+  /// @return reference to this matrix
+  constexpr auto operator*=(const DiagonalMatrix& otherMatrix) noexcept
+      -> DiagonalMatrix& {
+    for (std::size_t i{0U}; i < N; ++i) {
+      m_elements[i] *= otherMatrix.m_elements[i];
+    }
 
-    std::for_each(
-        resultElements.begin(), resultElements.end(),
-        [resultBegin = resultElements.begin(), &elements = m_elements,
-         &otherMatrix](auto& resultRow) {
-          const auto rowIndex{
-              static_cast<std::size_t>(std::distance(resultBegin, &resultRow))};
-          auto otherMatrixRow{otherMatrix.row(rowIndex)};
+    return *this;
+  }
 
-          auto elemIndex{0U};
-          std::generate(  // an optimized way of diagonal matrix multiplication
-              otherMatrixRow.begin(), otherMatrixRow.end(),
-              [&otherMatrixRow, &rowIndex,
-               &diagonalElement = elements[rowIndex], &elemIndex]() {
-                return otherMatrixRow[elemIndex++] * diagonalElement;
-              });
+  /// @brief compound multiplication operator by a scalar
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  constexpr auto operator*=(const T& factor) noexcept -> DiagonalMatrix& {
+    return scale(factor);
+  }
 
-          resultRow = otherMatrixRow;  // after multiplying by diagonal element
-        });
+  /// @brief method to multiply all elements by a scalar in place
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  constexpr auto scale(const T& factor) noexcept -> DiagonalMatrix& {
+    for (auto& element : m_elements) {
+      element *= factor;
+    }
 
-    return NormalMatrix<N, kNoOfOtherMatrixColumns>{resultElements};
+    return *this;
   }
 
   /// @brief method to check whether matrix type is symmetric or not
@@ -108,25 +252,55 @@ public:
   /// @note for diagonal matrix, this is always true
   constexpr auto isSymmetric() const noexcept { return true; }
 
-  /// @brief method to display elements of the matrix
-  /// @return elements surrounded by matrix symbol
-  [[nodiscard]] constexpr auto display() const -> std::string {
-    const auto stringifyRow{[&diagonalElements = m_elements](const auto& row) {
-      constexpr auto kRowLength{N};
+  /// @brief method to check whether all elements are zeros beyond a number of
+  ///        diagonals on both sides of the main one
+  /// @return true
+  /// @note for diagonal matrix, this is always true
+  constexpr auto isBanded(std::size_t /*bandwidth*/) const noexcept {
+    return true;
+  }
 
-      std::string result;
-      for (std::size_t i{0U}; i < kRowLength; ++i) {
-        result += std::to_string(row[i]) + (i == kRowLength - 1U ? "" : " ");
-      }
+  /// @brief method to check whether all elements off the diagonal are zeros
+  /// @return true
+  /// @note for diagonal matrix, this is always true
+  constexpr auto isDiagonal() const noexcept { return true; }
 
-      return std::string{std::format("|{}|", result)};
-    }};
+  /// @brief method to check whether all elements above the diagonal are zeros
+  /// @return true
+  /// @note for diagonal matrix, this is always true
+  constexpr auto isLowerTriangular() const noexcept { return true; }
 
-    constexpr auto kNumberOfRows{N};
-    std::string result;
-    for (std::size_t i{0U}; i < kNumberOfRows; ++i) {
-      result += stringifyRow(row(i)) + (i == kNumberOfRows - 1U ? "" : "\n");
+  /// @brief method to multiply the matrix by a vector and to accumulate the
+  ///        scaled product into another vector, y = alpha * A * x + beta * y
+  ///        (GEMV)
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  /// @note only the diagonal is multiplied by x, element-wise, on the
+  ///       vectorized kernel when alpha is one, e.g. to apply a Jacobi
+  ///       preconditioner; x and y must not overlap
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result) const {
+    matrix_common::checkGemvLengths(*this, vector.size(), result.size());
+    matrix_common::scaleAccumulated(beta, result);
+
+    if (alpha == T{1}) {
+      simd_kernels::multiplyAddElementwise(m_elements.data(), vector.data(),
+                                           result.data(), N);
+    } else {
+      for (std::size_t i{0U}; i < N; ++i) {
+        result[i] += alpha * (m_elements[i] * vector[i]);
+      }
     }
+  }
+
+  /// @brief method to display elements of the matrix
+  /// @return elements surrounded by matrix symbol
+  [[nodiscard]] constexpr auto display() const -> std::string {
+    std::string result;
+    formatMatrixTo(std::back_inserter(result), *this);
 
     return result;
   }
@@ -136,8 +310,16 @@ public:
 
 private:
   /// @brief diagonal elements of the matrix
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
-  const std::array<T, N> m_elements{};
+  std::array<T, N> m_elements{};
+
+  /// @brief type alias for the diagonal elements of the matrix
+  using ElementsType = std::array<T, N>;
+
+  /// @brief constructor that takes the diagonal elements as an array
+  /// @param elements diagonal elements of the matrix
+  /// @note currently only needed in multiplication
+  constexpr explicit DiagonalMatrix(const ElementsType& elements)
+      : m_elements{elements} {}
 };
 
 /// @brief derive in a non-intrusive way of the MatrixAdt type
@@ -0,0 +1,462 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <format>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/FastMultiplication.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixFormat.hpp"
+#include "data-structures/matrix-types/MatrixViews.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief definition of class representing a matrix whose dimensions are
+///        only known at runtime, its elements are stored contiguously row by
+///        row on the heap, aligned to a cache line
+/// @tparam T type of elements of matrix, default is std::size_t
+template <typename T = std::size_t>
+class DynamicMatrix {
+public:
+  /// @brief alignment in bytes of the storage of the elements
+  static constexpr std::size_t kAlignment{64U};
+
+  /// @brief to handle when passing empty list, resulting in [0*0] matrix
+  DynamicMatrix() = default;
+
+  /// @brief constructor of a matrix of the given dimensions, with all
+  ///        elements set to zero
+  /// @param rows number of rows of the matrix
+  /// @param columns number of columns of the matrix
+  /// @throw std::invalid_argument if the number of elements overflows
+  /// @note use parentheses with this constructor, since braces are taken by
+  ///       the one accepting braced init lists
+  DynamicMatrix(std::size_t rows, std::size_t columns)
+      : m_rows{rows},
+        m_columns{columns},
+        m_elements(matrix_common::checkedSizeProduct(rows, columns)) {}
+
+  /// @brief constructor that accepts multiple braced init lists
+  /// @tparam ...Rows parameter pack for the braced init lists passed
+  /// @param ...rows parameter pack passes to fill the elements of the matrix
+  /// @note the number of columns is the length of the longest row passed, and
+  ///       the remaining elements of shorter rows are set to zero
+  template <typename... Rows>
+  explicit DynamicMatrix(std::initializer_list<Rows>&&... rows)
+      : DynamicMatrix(sizeof...(rows),
+                      std::max({std::size_t{0U}, rows.size()...})) {
+    std::size_t rowIndex{0U};
+    (std::copy(rows.begin(), rows.end(), rowData(rowIndex++)), ...);
+  }
+
+  /// @brief converting constructor from any other matrix type, e.g. to
+  ///        densify a sparse matrix
+  /// @param matrix the matrix to copy the elements of
+  template <typename MatrixT>
+    requires(!std::is_same_v<MatrixT, DynamicMatrix> &&
+             std::is_same_v<typename MatrixT::value_type, T>)
+  explicit DynamicMatrix(const MatrixT& matrix)
+      : DynamicMatrix(matrix_common::numberOfRows(matrix),
+                      matrix_common::numberOfColumns(matrix)) {
+    for (std::size_t rowIndex{0U}; rowIndex < m_rows; ++rowIndex) {
+      matrix.rowView(rowIndex).copyTo(rowData(rowIndex));
+    }
+  }
+
+  /// @brief a method to return the [n*m] dimensions of the matrix
+  /// @return a DynamicDimensions object representing [n*m] dimensions
+  [[nodiscard]] constexpr auto dimensions() const noexcept {
+    return matrix_common::DynamicDimensions{m_rows, m_columns};
+  }
+
+  /// @brief method to return pointer to the first element of a row
+  /// @param index index of the row
+  /// @return pointer to the first element of the row at the given index
+  /// @note no range checking is done here
+  [[nodiscard]] auto rowData(std::size_t index) noexcept -> T* {
+    return m_elements.data() + (index * m_columns);
+  }
+
+  /// @brief const overload of the method above
+  [[nodiscard]] auto rowData(std::size_t index) const noexcept -> const T* {
+    return m_elements.data() + (index * m_columns);
+  }
+
+  /// @brief method to return the row in matrix at a given index
+  /// @param index at which row should be returned
+  /// @return non-owning view of the row at the given index
+  auto row(std::size_t index) const -> std::span<const T> {
+    if (m_rows == 0U) {
+      throw std::out_of_range("Matrix has no rows");
+    }
+    if (index >= m_rows) {
+      throw std::out_of_range(
+          std::format("Rows must be within the range: 0 - {}", m_rows - 1U));
+    }
+
+    return {rowData(index), m_columns};
+  }
+
+  /// @brief method to return the column at the given index
+  /// @param index order of the column in the matrix
+  /// @return the column at the given index
+  auto column(std::size_t index) const -> std::vector<T> {
+    if (m_columns == 0U) {
+      throw std::out_of_range("Matrix has no columns");
+    }
+    if (index >= m_columns) {
+      throw std::out_of_range(std::format(
+          "Columns must be within the range: 0 - {}", m_columns - 1U));
+    }
+
+    std::vector<T> column(m_rows);
+    columnView(index).copyTo(column.begin());
+
+    return column;
+  }
+
+  /// @brief method to return a view of the row at a given index, reading
+  ///        directly from the elements of the matrix
+  /// @param index at which row should be viewed
+  /// @return contiguous view of the row at the given index
+  /// @note no range checking is done here
+  [[nodiscard]] auto rowView(std::size_t index) const noexcept {
+    return LineView<T>{rowData(index), m_columns, {0U, m_columns, 1U}};
+  }
+
+  /// @brief method to return a view of the column at a given index, reading
+  ///        directly from the elements of the matrix
+  /// @param index at which column should be viewed
+  /// @return view of the column at the given index, strided by a row
+  /// @note no range checking is done here
+  [[nodiscard]] auto columnView(std::size_t index) const noexcept {
+    return LineView<T>{m_elements.data() + index, m_rows,
+                       {0U, m_rows, m_columns}};
+  }
+
+  /// @brief method that returns RowsIterator to traverse through each row
+  /// @return RowsIterator object pointing to first row, yielding views
+  [[nodiscard]] auto rows() const noexcept {
+    return matrix_common::RowsIterator<DynamicMatrix>(*this);
+  }
+
+  /// @brief method that returns ColumnsIterator to traverse through
+  ///        each column
+  /// @return ColumnsIterator object pointing to first column, yielding views
+  [[nodiscard]] auto columns() const noexcept {
+    return matrix_common::ColumnsIterator<DynamicMatrix>(*this);
+  }
+
+  /// @brief generic multiplication operator
+  /// @param otherMatrix the second operand of multiplication
+  /// @return DynamicMatrix containing the result of the multiplication
+  /// @throw std::invalid_argument if dimensions are not compatible
+  auto operator*(const auto& otherMatrix) const {
+    return multiply(otherMatrix);
+  }
+
+  /// @brief generic multiplication method that optionally accepts the
+  ///        executor to run on, e.g. a common::ThreadPool shared by several
+  ///        products
+  /// @param otherMatrix the second operand of multiplication
+  /// @param executor optional executor to run the multiplication on
+  /// @return DynamicMatrix containing the result of the multiplication
+  /// @throw std::invalid_argument if dimensions are not compatible
+  auto multiply(const auto& otherMatrix,
+                common::Executor auto&... executor) const {
+    return multiplyToDynamicMatrix(*this, otherMatrix, executor...);
+  }
+
+  /// @brief compound addition operator, adding another matrix of the same
+  ///        dimensions to this one in place
+  /// @param otherMatrix the matrix to add, of any matrix type
+  /// @return reference to this matrix
+  /// @throw std::invalid_argument if dimensions are not the same
+  auto operator+=(const auto& otherMatrix) -> DynamicMatrix& {
+    return accumulate(otherMatrix, T{1}, "add");
+  }
+
+  /// @brief compound subtraction operator, subtracting another matrix of the
+  ///        same dimensions from this one in place
+  /// @param otherMatrix the matrix to subtract, of any matrix type
+  /// @return reference to this matrix
+  /// @throw std::invalid_argument if dimensions are not the same
+  auto operator-=(const auto& otherMatrix) -> DynamicMatrix& {
+    return accumulate(otherMatrix, T{} - T{1}, "subtract");
+  }
+
+  /// @brief compound multiplication operator by another matrix
+  /// @tparam OtherMatrixT type of the other matrix
+  /// @param otherMatrix the second operand of multiplication
+  /// @return reference to this matrix, whose number of columns becomes the
+  ///         one of the other matrix
+  /// @throw std::invalid_argument if dimensions are not compatible
+  /// @note a product by a square matrix is written over the current storage,
+  ///       both operands being packed first in
+  ///       matrix_common::threadWorkspace(), so repeated products allocate
+  ///       nothing once it has grown. Other products change the number of
+  ///       columns, hence are computed into a new storage replacing this one
+  template <MatrixAdtConcept OtherMatrixT>
+  auto operator*=(const OtherMatrixT& otherMatrix) -> DynamicMatrix& {
+    if (matrix_common::numberOfRows(otherMatrix) != m_columns ||
+        matrix_common::numberOfColumns(otherMatrix) != m_columns) {
+      *this = multiply(otherMatrix);
+    } else {
+      matrix_common::multiplyInto(*this, otherMatrix, *this,
+                                  matrix_common::threadWorkspace<T>());
+    }
+
+    return *this;
+  }
+
+  /// @brief compound multiplication operator by a scalar
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  auto operator*=(const T& factor) noexcept -> DynamicMatrix& {
+    return scale(factor);
+  }
+
+  /// @brief method to multiply all elements by a scalar in place
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  auto scale(const T& factor) noexcept -> DynamicMatrix& {
+    for (auto& element : m_elements) {
+      element *= factor;
+    }
+
+    return *this;
+  }
+
+  /// @brief method to change the dimensions of the matrix, with all elements
+  ///        set to zero
+  /// @param rows number of rows of the matrix
+  /// @param columns number of columns of the matrix
+  /// @throw std::invalid_argument if the number of elements overflows
+  /// @note the storage is only reallocated when it is too small, so that a
+  ///       matrix reused for results of the same size allocates once
+  void resize(std::size_t rows, std::size_t columns) {
+    m_elements.assign(matrix_common::checkedSizeProduct(rows, columns), T{});
+    m_rows = rows;
+    m_columns = columns;
+  }
+
+  /// @brief method to return the transpose of the matrix
+  /// @return new [m*n] matrix holding the transpose of this [n*m] one
+  /// @note the transpose is blocked recursively down to tiles fitting in
+  ///       cache, and each tile is transposed with SIMD shuffles
+  [[nodiscard]] auto transpose() const -> DynamicMatrix {
+    DynamicMatrix result(m_columns, m_rows);
+    matrix_common::transposeRecursive(m_elements.data(), m_columns,
+                                      result.m_elements.data(), m_rows, m_rows,
+                                      m_columns);
+
+    return result;
+  }
+
+  /// @brief method to transpose the matrix in place
+  /// @return reference to this matrix
+  /// @note only square matrices are transposed without a new storage
+  auto transposeInPlace() -> DynamicMatrix& {
+    if (m_rows != m_columns) {
+      *this = transpose();
+    } else {
+      matrix_common::transposeSquareInPlace(m_elements.data(), m_columns,
+                                            m_rows);
+    }
+
+    return *this;
+  }
+
+  /// @brief method to check whether matrix type is symmetric or not
+  /// @return true if matrix is symmetric, false otherwise
+  /// @note it compares rows against transposed tiles of the mirrored rows
+  ///       instead of walking columns, and stops at the first mismatch
+  [[nodiscard]] auto isSymmetric() const noexcept -> bool {
+    return m_rows == m_columns &&
+           matrix_common::isSymmetricSquare(m_elements.data(), m_columns,
+                                            m_rows);
+  }
+
+  /// @brief method to check whether all elements are zeros beyond a number of
+  ///        diagonals on both sides of the main one
+  /// @param bandwidth number of diagonals allowed on each side
+  /// @return true if matrix is square and banded, false otherwise
+  /// @note it reads rows in place and stops at the first element off the band
+  [[nodiscard]] auto isBanded(std::size_t bandwidth) const noexcept -> bool {
+    return m_rows == m_columns &&
+           matrix_common::isZeroOutsideBand(m_elements.data(), m_columns,
+                                            m_rows, bandwidth, bandwidth);
+  }
+
+  /// @brief method to check whether all elements off the diagonal are zeros
+  /// @return true if matrix is square and diagonal, false otherwise
+  [[nodiscard]] auto isDiagonal() const noexcept -> bool {
+    return isBanded(0U);
+  }
+
+  /// @brief method to check whether all elements above the diagonal are zeros
+  /// @return true if matrix is square and lower triangular, false otherwise
+  [[nodiscard]] auto isLowerTriangular() const noexcept -> bool {
+    return m_rows == m_columns &&
+           matrix_common::isZeroOutsideBand(m_elements.data(), m_columns,
+                                            m_rows, m_rows, 0U);
+  }
+
+  /// @brief method to multiply the matrix by a vector and to accumulate the
+  ///        scaled product into another vector, y = alpha * A * x + beta * y
+  ///        (GEMV), on the given executor
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @param executor executor to run blocks of rows on
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  /// @note each row is multiplied by x on the vectorized dot product kernel;
+  ///       x and y must not overlap
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result,
+                      common::Executor auto& executor) const {
+    matrix_common::checkGemvLengths(*this, vector.size(), result.size());
+    matrix_common::multiplyRowsByVector(
+        alpha, beta, result,
+        [this, vector](std::size_t rowIndex) {
+          return simd_kernels::dot(rowData(rowIndex), vector.data(),
+                                   m_columns);
+        },
+        executor);
+  }
+
+  /// @brief overload of the method above that runs serially, unless the
+  ///        product has as many multiply-adds as parallelThreshold(), then
+  ///        it runs over common::ThreadPool::shared()
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result) const {
+    matrix_common::runMatrixVectorProduct(
+        m_rows * m_columns, [&](auto& executor) {
+          multiplyVector(alpha, vector, beta, result, executor);
+        });
+  }
+
+  /// @brief method to display elements of the matrix
+  /// @return elements surrounded by matrix symbol
+  [[nodiscard]] auto display() const -> std::string {
+    std::string result;
+    formatMatrixTo(std::back_inserter(result), *this);
+
+    return result;
+  }
+
+  /// @brief type alias for T, used for assertions
+  using value_type = T;
+
+private:
+  /// @brief number of rows of the matrix
+  std::size_t m_rows{0U};
+
+  /// @brief number of columns of the matrix
+  std::size_t m_columns{0U};
+
+  /// @brief elements of the matrix stored row by row
+  std::vector<T, matrix_common::AlignedAllocator<T, kAlignment>> m_elements;
+
+  /// @brief helper method to add another matrix scaled by a factor to this
+  ///        one in place
+  /// @param otherMatrix the matrix to add
+  /// @param factor factor to scale the other matrix by
+  /// @param operation name of the operation, used in error messages
+  /// @return reference to this matrix
+  /// @throw std::invalid_argument if dimensions are not the same
+  auto accumulate(const auto& otherMatrix, const T& factor,
+                  const char* operation) -> DynamicMatrix& {
+    using OtherMatrixType = std::remove_cvref_t<decltype(otherMatrix)>;
+
+    static_assert(
+        std::is_same_v<typename OtherMatrixType::value_type, value_type>,
+        "Element types are not the same");
+    matrix_common::checkSameDimensions(*this, otherMatrix, operation);
+
+    if constexpr (std::is_same_v<OtherMatrixType, DynamicMatrix>) {
+      // both are stored the same, hence added in one pass
+      simd_kernels::multiplyAdd(std::array<T, 1U>{factor},
+                                otherMatrix.m_elements.data(),
+                                std::array<T*, 1U>{m_elements.data()},
+                                m_elements.size());
+    } else {
+      matrix_common::accumulateStoredRows(
+          otherMatrix, factor,
+          [this](std::size_t rowIndex) { return rowData(rowIndex); });
+    }
+
+    return *this;
+  }
+};
+
+/// @brief function to multiply any two matrices types, of which at least one
+///        is not statically sized, the result is hence a DynamicMatrix
+/// @param firstMatrix first operand of matrices multiplication
+/// @param secondMatrix second operand of matrices multiplication
+/// @param executor optional executor to run the multiplication on
+/// @return DynamicMatrix containing the result of the multiplication
+/// @throw std::invalid_argument if dimensions are not compatible
+auto multiplyToDynamicMatrix(const auto& firstMatrix, const auto& secondMatrix,
+                             common::Executor auto&... executor) {
+  static_assert(sizeof...(executor) <= 1U, "Only one executor is accepted");
+
+  // assert both types are the same
+  using FirstMatrixType = std::remove_cvref_t<decltype(firstMatrix)>;
+  using SecondMatrixType = std::remove_cvref_t<decltype(secondMatrix)>;
+  using value_type = FirstMatrixType::value_type;
+
+  static_assert(
+      std::is_same_v<typename SecondMatrixType::value_type, value_type>,
+      "Element types are not the same");
+
+  // check dimensons are compatible
+  if (matrix_common::numberOfColumns(firstMatrix) !=
+      matrix_common::numberOfRows(secondMatrix)) {
+    throw std::invalid_argument(std::format(
+        "Cannot multiply [{}*{}] matrix by [{}*{}] matrix",
+        matrix_common::numberOfRows(firstMatrix),
+        matrix_common::numberOfColumns(firstMatrix),
+        matrix_common::numberOfRows(secondMatrix),
+        matrix_common::numberOfColumns(secondMatrix)));
+  }
+
+  DynamicMatrix<value_type> result(
+      matrix_common::numberOfRows(firstMatrix),
+      matrix_common::numberOfColumns(secondMatrix));
+  matrix_common::multiplyRowsByColumns(firstMatrix, secondMatrix, result,
+                                       executor...);
+
+  return result;
+}
+
+/// @brief derive in a non-intrusive way of the MatrixAdt type
+/// @tparam T type of elements of matrix
+template <typename T>
+class IsMatrixAdt<DynamicMatrix<T>> : public std::true_type {};
+
+/// @brief dynamic matrix stores all elements of each row contiguously
+/// @tparam T type of elements of matrix
+template <typename T>
+class HasDenseRows<DynamicMatrix<T>> : public std::true_type {};
+
+}  // namespace data_structures::matrix_types
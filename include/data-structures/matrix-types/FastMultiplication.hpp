@@ -0,0 +1,362 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixViews.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief dimension of square products from which on they recurse by
+///        Strassen-Winograd, down to blocks smaller than it that are
+///        multiplied by the blocked classical kernel
+/// @return reference to the crossover, that can be tuned at runtime
+/// @note the recursion trades an eighth of the multiply-adds of each level
+///       for block additions, which only pays off once blocks no longer fit
+///       in cache, hence the large default
+inline auto strassenThreshold() noexcept -> std::atomic<std::size_t>& {
+  static std::atomic<std::size_t> threshold{std::size_t{512U}};
+  return threshold;
+}
+
+/// @brief non-owning view of a block of a row-major buffer, with rows
+///        stride elements apart, modeling enough of a matrix type to be
+///        packed and multiplied by the blocked classical kernel
+/// @tparam T type of elements, const for read only blocks
+template <typename T>
+struct StridedBlock {
+  /// @brief pointer to the first element of the block
+  T* data;
+
+  /// @brief number of rows, and columns, of the square block
+  std::size_t size;
+
+  /// @brief distance between the first elements of two consecutive rows
+  std::size_t stride;
+
+  /// @brief method to return the dimensions of the block
+  [[nodiscard]] constexpr auto dimensions() const noexcept {
+    return DynamicDimensions{size, size};
+  }
+
+  /// @brief method to return pointer to the first element of a row
+  [[nodiscard]] constexpr auto rowData(std::size_t index) const noexcept {
+    return data + (index * stride);
+  }
+
+  /// @brief conversion to a read only view of the same block
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  constexpr operator StridedBlock<const T>() const noexcept
+    requires(!std::is_const_v<T>)
+  {
+    return {data, size, stride};
+  }
+
+  /// @brief method to return a view of a row, contiguous in the buffer
+  [[nodiscard]] constexpr auto rowView(std::size_t index) const noexcept {
+    return LineView<std::remove_const_t<T>>{rowData(index), size,
+                                            {0U, size, 1U}};
+  }
+};
+
+/// @brief helper function to combine two square blocks element by element
+///        into a third one, which may be either of them
+/// @param first first block combined
+/// @param second second block combined
+/// @param result block written
+/// @param operation the element-wise operation, e.g. std::plus
+template <typename T>
+static void combineBlocks(StridedBlock<const T> first,
+                          StridedBlock<const T> second, StridedBlock<T> result,
+                          auto operation) {
+  for (std::size_t rowIndex{0U}; rowIndex < result.size; ++rowIndex) {
+    std::transform(first.rowData(rowIndex),
+                   first.rowData(rowIndex) + result.size,
+                   second.rowData(rowIndex), result.rowData(rowIndex),
+                   operation);
+  }
+}
+
+/// @brief helper function to multiply square blocks by Strassen-Winograd,
+///        computing their 7 half products in the order that needs only two
+///        temporary blocks per level, following Douglas et al. (1994)
+/// @param first first operand of the product
+/// @param second second operand of the product
+/// @param result block overwritten by the product
+/// @param leaf size of the blocks multiplied by the classical kernel
+/// @param scratch temporaries of this level, followed by the deeper ones
+/// @param packed buffer of 2 leaf^2 elements the leaf operands are packed in
+/// @param executor executor to run blocks of kRowsBlock rows of the leaf
+///        products on
+/// @note sizes above the leaf are expected to halve evenly down to it, the
+///       top level being padded so
+template <typename T>
+static void multiplyWinograd(StridedBlock<const T> first,
+                             StridedBlock<const T> second,
+                             StridedBlock<T> result, std::size_t leaf,
+                             T* scratch, T* packed,
+                             common::Executor auto& executor) {
+  const auto size{result.size};
+
+  if (size <= leaf) {
+    // blocked classical kernel, packing into the same buffer every time
+    packRows(first, packed);
+    packColumnPanels(second, packed + (size * size));
+
+    constexpr auto kRowsBlock{GemmBlocking::kRowsBlock};
+    const T* const packedFirst{packed};
+    const T* const packedSecond{packed + (size * size)};
+    executor.parallelFor(
+        (size + kRowsBlock - 1U) / kRowsBlock,
+        [packedFirst, packedSecond, size, &result](std::size_t block) {
+          const auto rowBegin{block * kRowsBlock};
+          multiplyPackedRows(packedFirst, packedSecond, size, size, result,
+                             rowBegin, std::min(rowBegin + kRowsBlock, size));
+        });
+    return;
+  }
+
+  const auto half{size / 2U};
+  const auto quadrant{[half](auto block, std::size_t row, std::size_t column) {
+    return decltype(block){block.rowData(row * half) + (column * half), half,
+                           block.stride};
+  }};
+  const auto a11{quadrant(first, 0U, 0U)};
+  const auto a12{quadrant(first, 0U, 1U)};
+  const auto a21{quadrant(first, 1U, 0U)};
+  const auto a22{quadrant(first, 1U, 1U)};
+  const auto b11{quadrant(second, 0U, 0U)};
+  const auto b12{quadrant(second, 0U, 1U)};
+  const auto b21{quadrant(second, 1U, 0U)};
+  const auto b22{quadrant(second, 1U, 1U)};
+  const auto c11{quadrant(result, 0U, 0U)};
+  const auto c12{quadrant(result, 0U, 1U)};
+  const auto c21{quadrant(result, 1U, 0U)};
+  const auto c22{quadrant(result, 1U, 1U)};
+
+  // two temporaries of this level, the next levels using the rest
+  const StridedBlock<T> x{scratch, half, half};
+  const StridedBlock<T> y{scratch + (half * half), half, half};
+  T* const deeperScratch{scratch + (2U * half * half)};
+
+  const auto multiply{[leaf, deeperScratch, packed, &executor](
+                          StridedBlock<const T> left,
+                          StridedBlock<const T> right,
+                          StridedBlock<T> product) {
+    multiplyWinograd(left, right, product, leaf, deeperScratch, packed,
+                     executor);
+  }};
+  const auto add{[](StridedBlock<const T> left, StridedBlock<const T> right,
+                    StridedBlock<T> sum) {
+    combineBlocks(left, right, sum, std::plus<>{});
+  }};
+  const auto subtract{[](StridedBlock<const T> left,
+                         StridedBlock<const T> right,
+                         StridedBlock<T> difference) {
+    combineBlocks(left, right, difference, std::minus<>{});
+  }};
+
+  subtract(a11, a21, x);    // S3 = A11 - A21
+  subtract(b22, b12, y);    // T3 = B22 - B12
+  multiply(x, y, c21);      // P7 = S3 T3
+  add(a21, a22, x);         // S1 = A21 + A22
+  subtract(b12, b11, y);    // T1 = B12 - B11
+  multiply(x, y, c22);      // P5 = S1 T1
+  subtract(x, a11, x);      // S2 = S1 - A11
+  subtract(b22, y, y);      // T2 = B22 - T1
+  multiply(x, y, c12);      // P6 = S2 T2
+  subtract(a12, x, x);      // S4 = A12 - S2
+  multiply(x, b22, c11);    // P3 = S4 B22
+  multiply(a11, b11, x);    // P1 = A11 B11
+  add(x, c12, c12);         // U2 = P1 + P6
+  add(c12, c21, c21);       // U3 = U2 + P7
+  add(c12, c22, c12);       // U4 = U2 + P5
+  add(c21, c22, c22);       // U7 = U3 + P5
+  add(c12, c11, c12);       // U5 = U4 + P3
+  subtract(y, b21, y);      // T4 = T2 - B21
+  multiply(a22, y, c11);    // P4 = A22 T4
+  subtract(c21, c11, c21);  // U6 = U3 - P4
+  multiply(a12, b21, c11);  // P2 = A12 B21
+  add(x, c11, c11);         // U1 = P1 + P2
+}
+
+/// @brief function to multiply square matrices by Strassen-Winograd, the
+///        operands being padded to a size that halves evenly down to blocks
+///        smaller than strassenThreshold()
+/// @param firstMatrix first operand of matrices multiplication
+/// @param secondMatrix second operand of matrices multiplication
+/// @param productResult an array of arrays the hold the result elements, or
+///        a matrix type having rowData(index) like DynamicMatrix
+/// @param executor executor to run blocks of kRowsBlock rows of the leaf
+///        products on
+/// @param workspace Workspace the scratch arena is carved out of, grown if
+///        needed
+/// @note the padded operands, the result and the temporaries of all levels
+///       are carved out of a single scratch arena, about 3.7 times the size
+///       of an operand, so no allocation takes place during the recursion.
+///       Results of floating point products may differ from the classical
+///       ones by rounding
+static void multiplyStrassenWinograd(const auto& firstMatrix,
+                                     const auto& secondMatrix,
+                                     auto& productResult,
+                                     common::Executor auto& executor,
+                                     auto& workspace) {
+  using value_type = std::remove_cvref_t<decltype(firstMatrix)>::value_type;
+
+  const auto size{numberOfRows(firstMatrix)};
+  const auto threshold{
+      std::max(strassenThreshold().load(std::memory_order_relaxed),
+               std::size_t{2U})};
+
+  // halve until below the crossover, the leaf size rounding up to whole
+  // cache lines, so that the quadrants of every level stay aligned
+  constexpr auto kLineElements{
+      std::max(kWorkspaceAlignment / sizeof(value_type), std::size_t{1U})};
+  std::size_t levels{0U};
+  auto leaf{size};
+  while (leaf >= threshold) {
+    leaf = (leaf + 1U) / 2U;
+    ++levels;
+  }
+  if (levels > 0U) {
+    leaf = (leaf + kLineElements - 1U) / kLineElements * kLineElements;
+  }
+  const auto padded{leaf << levels};
+
+  // operands and result, then two temporaries per level, then the packed
+  // operands of the leaves
+  auto scratchSize{3U * padded * padded};
+  for (auto half{padded / 2U}; half >= leaf; half /= 2U) {
+    scratchSize += 2U * half * half;
+  }
+  scratchSize += 2U * leaf * leaf;
+  workspace.resize(scratchSize);
+  value_type* const arena{workspace.data()};
+
+  // the padding of the operands must be zero, whatever a reused workspace
+  // held before
+  std::fill_n(arena, 2U * padded * padded, value_type{});
+  const StridedBlock<value_type> first{arena, padded, padded};
+  const StridedBlock<value_type> second{first.data + (padded * padded), padded,
+                                        padded};
+  const StridedBlock<value_type> result{second.data + (padded * padded),
+                                        padded, padded};
+  for (std::size_t rowIndex{0U}; rowIndex < size; ++rowIndex) {
+    firstMatrix.rowView(rowIndex).copyTo(first.rowData(rowIndex));
+    secondMatrix.rowView(rowIndex).copyTo(second.rowData(rowIndex));
+  }
+
+  value_type* const scratch{result.data + (padded * padded)};
+  multiplyWinograd<value_type>(first, second, result, leaf, scratch,
+                               arena + scratchSize - (2U * leaf * leaf),
+                               executor);
+
+  for (std::size_t rowIndex{0U}; rowIndex < size; ++rowIndex) {
+    std::copy_n(result.rowData(rowIndex), size,
+                resultRowData(productResult, rowIndex));
+  }
+}
+
+/// @brief overload of the function above carving its scratch arena out of the
+///        workspace of the calling thread
+/// @param firstMatrix first operand of matrices multiplication
+/// @param secondMatrix second operand of matrices multiplication
+/// @param productResult an array of arrays the hold the result elements, or
+///        a matrix type having rowData(index) like DynamicMatrix
+/// @param executor executor to run blocks of kRowsBlock rows of the leaf
+///        products on
+/// @note the arena of threadWorkspace() only grows, so repeated products
+///       like operator* allocate it once per thread rather than once per
+///       call. Callers keeping a workspace of their own, like pow(), pass it
+///       through multiplyInto() instead
+static void multiplyStrassenWinograd(const auto& firstMatrix,
+                                     const auto& secondMatrix,
+                                     auto& productResult,
+                                     common::Executor auto& executor) {
+  using value_type = std::remove_cvref_t<decltype(firstMatrix)>::value_type;
+
+  multiplyStrassenWinograd(firstMatrix, secondMatrix, productResult, executor,
+                           threadWorkspace<value_type>());
+}
+
+/// @brief overload of the function above that runs serially, unless the
+///        product is as large as parallelThreshold(), then it runs over
+///        common::ThreadPool::shared()
+/// @param firstMatrix first operand of matrices multiplication
+/// @param secondMatrix second operand of matrices multiplication
+/// @param productResult an array of arrays the hold the result elements, or
+///        a matrix type having rowData(index) like DynamicMatrix
+static void multiplyStrassenWinograd(const auto& firstMatrix,
+                                     const auto& secondMatrix,
+                                     auto& productResult) {
+  const auto size{numberOfRows(firstMatrix)};
+
+  if (size * size * size <
+      parallelThreshold().load(std::memory_order_relaxed)) {
+    common::SerialExecutor executor;
+    multiplyStrassenWinograd(firstMatrix, secondMatrix, productResult,
+                             executor);
+  } else {
+    multiplyStrassenWinograd(firstMatrix, secondMatrix, productResult,
+                             common::ThreadPool::shared());
+  }
+}
+
+/// @brief function to multiply matrices into a result allocated by the
+///        caller, packing the operands in a workspace that can be reused
+///        across products, as the repeated squaring of pow() does
+/// @param firstMatrix first operand of matrices multiplication
+/// @param secondMatrix second operand of matrices multiplication
+/// @param productResult a matrix type having rowData(index), which may be
+///        either operand, since both are copied into the workspace before
+///        any element of it is written
+/// @param workspace Workspace the operands are packed in, grown if needed
+/// @note square products as large as strassenThreshold() recurse by
+///       Strassen-Winograd when the elements allow it, as products of
+///       NormalMatrix do, and products run over common::ThreadPool::shared()
+///       from parallelThreshold() on
+static void multiplyInto(const auto& firstMatrix, const auto& secondMatrix,
+                         auto& productResult, auto& workspace) {
+  using value_type = std::remove_cvref_t<decltype(firstMatrix)>::value_type;
+  const auto rows{numberOfRows(firstMatrix)};
+  const auto inner{numberOfColumns(firstMatrix)};
+  const auto columns{numberOfColumns(secondMatrix)};
+
+  const auto multiply{[&](common::Executor auto& executor) {
+    if constexpr (std::floating_point<value_type> ||
+                  std::unsigned_integral<value_type>) {
+      if (rows == inner && inner == columns &&
+          rows >= strassenThreshold().load(std::memory_order_relaxed)) {
+        multiplyStrassenWinograd(firstMatrix, secondMatrix, productResult,
+                                 executor, workspace);
+        return;
+      }
+    }
+    multiplyRowsByColumns(firstMatrix, secondMatrix, productResult, executor,
+                          workspace);
+  }};
+
+  if (rows * inner * columns <
+      parallelThreshold().load(std::memory_order_relaxed)) {
+    common::SerialExecutor executor;
+    multiply(executor);
+  } else {
+    multiply(common::ThreadPool::shared());
+  }
+}
+
+}  // namespace matrix_common
+
+}  // namespace data_structures::matrix_types
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief helper function to round a float to the nearest IEEE 754
+///        half-precision number, ties to even, as F16C instructions do
+/// @param value the float in question
+/// @return the bits of the half-precision number
+static constexpr auto floatToHalfBits(float value) noexcept -> std::uint16_t {
+  const auto bits{std::bit_cast<std::uint32_t>(value)};
+  const auto sign{static_cast<std::uint16_t>((bits >> 16U) & 0x8000U)};
+  const auto magnitude{bits & 0x7FFF'FFFFU};
+
+  if (magnitude >= 0x7F80'0000U) {
+    // infinities, and quiet NaNs keeping the high bits of their payload
+    return static_cast<std::uint16_t>(
+        sign | 0x7C00U |
+        (magnitude > 0x7F80'0000U ? 0x0200U | ((magnitude >> 13U) & 0x03FFU)
+                                  : 0U));
+  }
+
+  // 65520 and above round to infinity
+  if (magnitude >= 0x477F'F000U) {
+    return static_cast<std::uint16_t>(sign | 0x7C00U);
+  }
+
+  std::uint32_t half;
+  std::uint32_t remainder;
+  std::uint32_t halfway;
+  if (magnitude >= 0x3880'0000U) {
+    // normal numbers, the exponent being rebiased from 127 to 15
+    half = (magnitude - 0x3800'0000U) >> 13U;
+    remainder = magnitude & 0x1FFFU;
+    halfway = 0x1000U;
+  } else {
+    // subnormal numbers, 2^-25 and below rounding to zero
+    if (magnitude <= 0x3300'0000U) {
+      return sign;
+    }
+
+    const auto shift{126U - (magnitude >> 23U)};
+    const auto mantissa{(magnitude & 0x007F'FFFFU) | 0x0080'0000U};
+    half = mantissa >> shift;
+    remainder = mantissa & ((1U << shift) - 1U);
+    halfway = 1U << (shift - 1U);
+  }
+
+  // a carry out of the mantissa increments the exponent, as it should
+  if (remainder > halfway || (remainder == halfway && (half & 1U) != 0U)) {
+    ++half;
+  }
+
+  return static_cast<std::uint16_t>(sign | half);
+}
+
+/// @brief helper function to convert an IEEE 754 half-precision number to
+///        the float of the same value, which is always exact
+/// @param bits the bits of the half-precision number
+/// @return the float
+static constexpr auto halfBitsToFloat(std::uint16_t bits) noexcept -> float {
+  const auto sign{(bits & 0x8000U) << 16U};
+  const auto exponent{(bits >> 10U) & 0x1FU};
+  const auto mantissa{bits & 0x03FFU};
+
+  if (exponent == 0x1FU) {
+    return std::bit_cast<float>(sign | 0x7F80'0000U | (mantissa << 13U));
+  }
+
+  if (exponent == 0U) {
+    // zeros and subnormal numbers, mantissa * 2^-24
+    const auto magnitude{static_cast<float>(mantissa) * 0x1p-24F};
+    return sign != 0U ? -magnitude : magnitude;
+  }
+
+  return std::bit_cast<float>(
+      sign | ((exponent + 112U) << 23U) | (mantissa << 13U));
+}
+
+/// @brief helper function to round a float to the nearest bfloat16 number,
+///        ties to even
+/// @param value the float in question
+/// @return the bits of the bfloat16 number, the high half of a float
+static constexpr auto floatToBFloat16Bits(float value) noexcept
+    -> std::uint16_t {
+  const auto bits{std::bit_cast<std::uint32_t>(value)};
+  if ((bits & 0x7FFF'FFFFU) > 0x7F80'0000U) {
+    // NaNs are kept quiet, as their payload may be truncated to zero
+    return static_cast<std::uint16_t>((bits >> 16U) | 0x0040U);
+  }
+
+  return static_cast<std::uint16_t>(
+      (bits + 0x7FFFU + ((bits >> 16U) & 1U)) >> 16U);
+}
+
+}  // namespace matrix_common
+
+/// @brief IEEE 754 half-precision number, meant to store the elements of
+///        large matrices in half the memory of float, arithmetic being
+///        carried out in float, which it implicitly converts to
+/// @note as for std::float16_t, conversions from float round, to nearest,
+///       and hence must be explicit
+class Float16 {
+public:
+  /// @brief default constructor of a positive zero
+  constexpr Float16() noexcept = default;
+
+  /// @brief constructor rounding a float to the nearest half-precision one
+  /// @param value the float to be rounded
+  constexpr explicit Float16(float value) noexcept
+      : m_bits{matrix_common::floatToHalfBits(value)} {}
+
+  /// @brief conversion operator to float, which is exact
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  constexpr operator float() const noexcept {
+    return matrix_common::halfBitsToFloat(m_bits);
+  }
+
+  /// @brief function to build a number from its bits
+  /// @param bits the bits of the number
+  /// @return the number
+  static constexpr auto fromBits(std::uint16_t bits) noexcept -> Float16 {
+    Float16 result;
+    result.m_bits = bits;
+    return result;
+  }
+
+  /// @brief method to return the bits of the number
+  /// @return the bits of the number
+  [[nodiscard]] constexpr auto bits() const noexcept { return m_bits; }
+
+private:
+  /// @brief sign, 5 bits of exponent and 10 of mantissa
+  std::uint16_t m_bits{};
+};
+
+/// @brief bfloat16 number, i.e. the high half of a float, meant to store the
+///        elements of large matrices in half the memory of float with the
+///        range of float, arithmetic being carried out in float, which it
+///        implicitly converts to
+/// @note as for std::bfloat16_t, conversions from float round, to nearest,
+///       and hence must be explicit
+class BFloat16 {
+public:
+  /// @brief default constructor of a positive zero
+  constexpr BFloat16() noexcept = default;
+
+  /// @brief constructor rounding a float to the nearest bfloat16 one
+  /// @param value the float to be rounded
+  constexpr explicit BFloat16(float value) noexcept
+      : m_bits{matrix_common::floatToBFloat16Bits(value)} {}
+
+  /// @brief conversion operator to float, which is exact
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  constexpr operator float() const noexcept {
+    return std::bit_cast<float>(static_cast<std::uint32_t>(m_bits) << 16U);
+  }
+
+  /// @brief function to build a number from its bits
+  /// @param bits the bits of the number
+  /// @return the number
+  static constexpr auto fromBits(std::uint16_t bits) noexcept -> BFloat16 {
+    BFloat16 result;
+    result.m_bits = bits;
+    return result;
+  }
+
+  /// @brief method to return the bits of the number
+  /// @return the bits of the number
+  [[nodiscard]] constexpr auto bits() const noexcept { return m_bits; }
+
+private:
+  /// @brief sign, 8 bits of exponent and 7 of mantissa
+  std::uint16_t m_bits{};
+};
+
+/// @brief concept for the 16-bit floating point types of elements
+template <typename T>
+concept HalfPrecision = std::same_as<T, Float16> || std::same_as<T, BFloat16>;
+
+}  // namespace data_structures::matrix_types
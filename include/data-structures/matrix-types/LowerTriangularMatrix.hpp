@@ -2,20 +2,33 @@
 
 #include <algorithm>
 #include <array>
+#include <concepts>
 #include <cstddef>
 #include <format>
 #include <initializer_list>
 #include <iterator>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 
 #include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
 #include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixFormat.hpp"
+#include "data-structures/matrix-types/MatrixViews.hpp"
 #include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
 
 /// @brief namespace for matrices types
 namespace data_structures::matrix_types {
 
+/// @brief forward declaration of diagonal matrix, which builds lower
+///        triangular matrices when multiplied by them
+template <common::NaturalNumber auto N, typename T>
+class DiagonalMatrix;
+
 /// @brief definition of class representing lower triangular Matrix
 /// @tparam N number of rows and columns of the matrix
 /// @tparam T type of elements of matrix, default is std::size_t
@@ -39,6 +52,26 @@ public:
     static_assert(sizeof...(rows) <= N);
   }
 
+  /// @brief converting constructor from any other square matrix type of the
+  ///        same size, e.g. to store a dense matrix found lower triangular in
+  ///        the packed triangle
+  /// @param matrix the matrix to copy the lower triangle of
+  /// @note elements above the diagonal are dropped, so isLowerTriangular()
+  ///       of the matrix tells whether the conversion is lossless
+  template <typename MatrixT>
+    requires(!std::is_same_v<MatrixT, LowerTriangularMatrix> &&
+             std::is_same_v<typename MatrixT::value_type, T> &&
+             matrix_common::StaticallySized<MatrixT>)
+  constexpr explicit LowerTriangularMatrix(const MatrixT& matrix) {
+    static_assert(MatrixT::dimensions().kRows == N &&
+                      MatrixT::dimensions().kColumns == N,
+                  "Dimensions are not the same");
+
+    for (std::size_t rowIndex{0U}; rowIndex < N; ++rowIndex) {
+      matrix.rowView(rowIndex).copyTo(0U, rowIndex + 1U, rowData(rowIndex));
+    }
+  }
+
   /// @brief a constexpr method to return the [n*m] dimensions of the matrix
   /// @return a MatrixDimension object representing [n*m] dimensions
   static constexpr auto dimensions() noexcept {
@@ -49,11 +82,8 @@ public:
   /// @param index at which row should be returned
   /// @return the row at the given index
   constexpr auto row(std::size_t index) const {
-    const auto rowStartPosition{numberOfTriangleElements(index)};
-    std::array<T, N> result{};
-    for (auto i{0U}; i <= index; ++i) {
-      result[i] = m_elements[rowStartPosition + i];
-    }
+    std::array<T, N> result;
+    rowView(index).copyTo(result.begin());
 
     return result;
   }
@@ -62,19 +92,125 @@ public:
   /// @param index at which column should be returned
   /// @return the column at the given index
   constexpr auto column(std::size_t index) const {
-    auto elemIndex{numberOfTriangleElements(index)};
-    std::array<T, N> result{};
-    for (auto i{index}; i < N; ++i, elemIndex += i) {
-      result[i] = m_elements[index + elemIndex];
-    }
+    std::array<T, N> result;
+    columnView(index).copyTo(result.begin());
 
     return result;
   }
 
+  /// @brief method to return a view of the row at a given index, reading
+  ///        directly from the packed triangle elements
+  /// @param index at which row should be viewed
+  /// @return view of the row, its elements past the diagonal are zeros
+  /// @note no range checking is done here
+  constexpr auto rowView(std::size_t index) const noexcept {
+    return LineView<T>{rowData(index), N, {0U, index + 1U, 1U}};
+  }
+
+  /// @brief method to return a view of the column at a given index, reading
+  ///        directly from the packed triangle elements
+  /// @param index at which column should be viewed
+  /// @return view of the column, its elements above the diagonal are zeros
+  /// @note no range checking is done here
+  constexpr auto columnView(std::size_t index) const noexcept {
+    return LineView<T, PackedLowerColumnMapping>{
+        rowData(index) + index, N, {index, N}};
+  }
+
+  /// @brief method to return pointer to the first element of a packed row,
+  ///        followed by the other index elements of the row up to the
+  ///        diagonal one
+  /// @param index index of the row
+  /// @return pointer to the first element of the row at the given index
+  /// @note no range checking is done here
+  constexpr auto rowData(std::size_t index) const noexcept -> const T* {
+    return m_elements.data() + matrix_common::numberOfTriangleElements(index);
+  }
+
+  /// @brief non-const overload of the method above
+  constexpr auto rowData(std::size_t index) noexcept -> T* {
+    return m_elements.data() + matrix_common::numberOfTriangleElements(index);
+  }
+
+  /// @brief method to solve the system L x = b by forward substitution,
+  ///        each unknown being the dot product of a packed row with the
+  ///        unknowns already solved
+  /// @param vector the right-hand side b
+  /// @return the solution x
+  /// @throw std::domain_error if an element of the diagonal is zero
+  auto solve(std::array<T, N> vector) const -> std::array<T, N>
+    requires std::floating_point<T>
+  {
+    for (std::size_t rowIndex{0U}; rowIndex < N; ++rowIndex) {
+      const auto* const row{rowData(rowIndex)};
+
+      auto sum{vector[rowIndex]};
+      for (std::size_t j{0U}; j < rowIndex; ++j) {
+        sum -= row[j] * vector[j];
+      }
+      vector[rowIndex] = sum / diagonalElement(rowIndex);
+    }
+
+    return vector;
+  }
+
+  /// @brief method to solve the system transpose(L) x = b by backward
+  ///        substitution, each unknown solved being subtracted from the ones
+  ///        left scaled by its packed row, so rows are still read in place
+  /// @param vector the right-hand side b
+  /// @return the solution x
+  /// @throw std::domain_error if an element of the diagonal is zero
+  /// @note it solves systems of upper triangular matrices stored transposed,
+  ///       e.g. the second half of a Cholesky or LU solve
+  auto solveTransposed(std::array<T, N> vector) const -> std::array<T, N>
+    requires std::floating_point<T>
+  {
+    for (auto rowIndex{std::size_t{N}}; rowIndex-- > 0U;) {
+      vector[rowIndex] /= diagonalElement(rowIndex);
+      simd_kernels::multiplyAdd(std::array<T, 1U>{T{} - vector[rowIndex]},
+                                rowData(rowIndex),
+                                std::array<T*, 1U>{vector.data()}, rowIndex);
+    }
+
+    return vector;
+  }
+
+  /// @brief method that returns RowsIterator to traverse through each row
+  /// @return RowsIterator object pointing to first row, yielding views
+  constexpr auto rows() const noexcept {
+    return matrix_common::RowsIterator<LowerTriangularMatrix>(*this);
+  }
+
+  /// @brief method that returns ColumnsIterator to traverse through
+  ///        each column
+  /// @return ColumnsIterator object pointing to first column, yielding views
+  constexpr auto columns() const noexcept {
+    return matrix_common::ColumnsIterator<LowerTriangularMatrix>(*this);
+  }
+
   /// @brief generic multiplication operator
   /// @param otherMatrix the second operand of multiplication
-  /// @return NormalMatrix containing the result of the multiplication
+  /// @return LowerTriangularMatrix when multiplied by another lower triangular
+  ///         matrix, NormalMatrix otherwise
+  /// @note large products run in parallel, see
+  ///       matrix_common::parallelThreshold()
   auto operator*(const auto& otherMatrix) const {
+    return multiply(otherMatrix);
+  }
+
+  /// @brief generic multiplication method that optionally accepts the
+  ///        executor to run on, e.g. a common::ThreadPool shared by several
+  ///        products
+  /// @param otherMatrix the second operand of multiplication
+  /// @param executor optional executor to run the multiplication on
+  /// @return LowerTriangularMatrix when multiplied by another lower triangular
+  ///         matrix, NormalMatrix otherwise
+  /// @note only the stored triangle is walked, skipping the zeros above the
+  ///       diagonal, unless the other operand is only sized at runtime
+  auto multiply(const auto& otherMatrix,
+                common::Executor auto&... executor) const {
+    static_assert(sizeof...(executor) <= 1U, "Only one executor is accepted");
+
     // assert both types are the same
     using OtherMatrixType =
         std::remove_const_t<std::remove_reference_t<decltype(otherMatrix)>>;
@@ -83,17 +219,106 @@ public:
         std::is_same_v<typename OtherMatrixType::value_type, value_type>,
         "Element types are not the same");
 
-    // assert dimensons are compatible
-    static_assert(N == otherMatrix.dimensions().kRows);
+    if constexpr (!matrix_common::StaticallySized<OtherMatrixType>) {
+      // dimensions of the result are only known at runtime
+      return multiplyToDynamicMatrix(*this, otherMatrix, executor...);
+    } else {
+      // assert dimensons are compatible
+      static_assert(N == otherMatrix.dimensions().kRows);
+
+      if constexpr (std::is_same_v<OtherMatrixType, LowerTriangularMatrix>) {
+        // product of lower triangular matrices is lower triangular, so it is
+        // accumulated directly into the packed triangle
+        PackedElementsType resultElements{};
+        matrix_common::multiplyStoredElements(
+            *this, otherMatrix,
+            [&resultElements](std::size_t rowIndex) {
+              return resultElements.data() +
+                     matrix_common::numberOfTriangleElements(rowIndex);
+            },
+            executor...);
+
+        return LowerTriangularMatrix{resultElements};
+      } else {
+        constexpr auto kNoOfOtherMatrixColumns{
+            otherMatrix.dimensions().kColumns};
+        std::array<std::array<value_type, kNoOfOtherMatrixColumns>, N>
+            resultElements{};  // or use OtherMatrixType::value_type, since
+                               // assertion should've passed above
+
+        // only the triangle of this matrix is walked
+        matrix_common::multiplyStoredElements(
+            *this, otherMatrix,
+            [&resultElements](std::size_t rowIndex) {
+              return resultElements[rowIndex].data();
+            },
+            executor...);
 
-    constexpr auto kNoOfOtherMatrixColumns{otherMatrix.dimensions().kColumns};
-    std::array<std::array<value_type, kNoOfOtherMatrixColumns>, N>
-        resultElements;  // or use OtherMatrixType::value_type, since
-                         // assertion should've passed above
+        return NormalMatrix<N, kNoOfOtherMatrixColumns, T>{resultElements};
+      }
+    }
+  }
 
-    matrix_common::multiplyRowsByColumns(*this, otherMatrix, resultElements);
+  /// @brief compound addition operator, adding another lower triangular or a
+  ///        diagonal matrix to this one in place, the only types keeping it
+  ///        lower triangular
+  /// @tparam OtherMatrixT type of the other matrix
+  /// @param otherMatrix the matrix to add
+  /// @return reference to this matrix
+  template <typename OtherMatrixT>
+    requires(std::is_same_v<OtherMatrixT, LowerTriangularMatrix> ||
+             std::is_same_v<OtherMatrixT, DiagonalMatrix<N, T>>)
+  auto operator+=(const OtherMatrixT& otherMatrix) -> LowerTriangularMatrix& {
+    return accumulate(otherMatrix, T{1});
+  }
 
-    return NormalMatrix<N, kNoOfOtherMatrixColumns>{resultElements};
+  /// @brief compound subtraction operator, subtracting another lower
+  ///        triangular or a diagonal matrix from this one in place
+  /// @tparam OtherMatrixT type of the other matrix
+  /// @param otherMatrix the matrix to subtract
+  /// @return reference to this matrix
+  template <typename OtherMatrixT>
+    requires(std::is_same_v<OtherMatrixT, LowerTriangularMatrix> ||
+             std::is_same_v<OtherMatrixT, DiagonalMatrix<N, T>>)
+  auto operator-=(const OtherMatrixT& otherMatrix) -> LowerTriangularMatrix& {
+    return accumulate(otherMatrix, T{} - T{1});
+  }
+
+  /// @brief compound multiplication operator by another lower triangular
+  ///        matrix, whose product by this one is lower triangular as well
+  /// @tparam OtherMatrixT type of the other matrix
+  /// @param otherMatrix the second operand of multiplication
+  /// @return reference to this matrix
+  /// @note the product is computed on the stack before it is assigned, since
+  ///       its elements depend on the ones it overwrites
+  template <MatrixAdtConcept OtherMatrixT>
+    requires std::is_same_v<
+        decltype(std::declval<const LowerTriangularMatrix&>() *
+                 std::declval<const OtherMatrixT&>()),
+        LowerTriangularMatrix>
+  auto operator*=(const OtherMatrixT& otherMatrix) -> LowerTriangularMatrix& {
+    *this = multiply(otherMatrix);
+    return *this;
+  }
+
+  /// @brief compound multiplication operator by a scalar
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  constexpr auto operator*=(const T& factor) noexcept
+      -> LowerTriangularMatrix& {
+    return scale(factor);
+  }
+
+  /// @brief method to multiply all elements by a scalar in place
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  /// @note only the stored triangle is touched
+  constexpr auto scale(const T& factor) noexcept -> LowerTriangularMatrix& {
+    for (auto& element : m_elements) {
+      element *= factor;
+    }
+
+    return *this;
   }
 
   /// @brief method to check whether matrix type is symmetric or not
@@ -101,26 +326,85 @@ public:
   /// @note for lower triangular matrix, this is always false
   constexpr auto isSymmetric() const noexcept { return false; }
 
-  /// @brief method to display elements of the matrix
-  /// @return elements surrounded by matrix symbol
-  [[nodiscard]] constexpr auto display() const noexcept -> std::string {
-    const auto stringifyRow{[&triangleElements = m_elements](const auto& row) {
-      constexpr auto kRowLength{N};
-      std::string result;
-      for (std::size_t i{0U}; i < kRowLength; ++i) {
-        result += std::to_string(row[i]) +
-                  // concat. space after each element except the last one
-                  (i == kRowLength - 1U ? "" : " ");
+  /// @brief method to check whether all elements are zeros beyond a number of
+  ///        diagonals on both sides of the main one
+  /// @param bandwidth number of diagonals allowed on each side
+  /// @return true if no element of the triangle is non-zero off the band
+  /// @note only the packed triangle is read, the upper one being zeros
+  constexpr auto isBanded(std::size_t bandwidth) const noexcept -> bool {
+    // a band covering every diagonal holds the whole matrix, checked first
+    // so that the bounds below cannot wrap
+    if (bandwidth >= N - 1U) {
+      return true;
+    }
+
+    const auto isZero{[](const T& element) { return element == T{}; }};
+
+    for (auto rowIndex{bandwidth + 1U}; rowIndex < N; ++rowIndex) {
+      const auto* const row{m_elements.data() +
+                            matrix_common::numberOfTriangleElements(rowIndex)};
+      if (!std::all_of(row, row + (rowIndex - bandwidth), isZero)) {
+        return false;
       }
+    }
+
+    return true;
+  }
+
+  /// @brief method to check whether all elements off the diagonal are zeros
+  /// @return true if the triangle holds only its diagonal
+  constexpr auto isDiagonal() const noexcept -> bool { return isBanded(0U); }
 
-      return std::string{std::format("|{}|", result)};
-    }};
+  /// @brief method to check whether all elements above the diagonal are zeros
+  /// @return true
+  /// @note for lower triangular matrix, this is always true
+  constexpr auto isLowerTriangular() const noexcept { return true; }
 
-    constexpr auto kNumberOfRows{N};
+  /// @brief method to multiply the matrix by a vector and to accumulate the
+  ///        scaled product into another vector, y = alpha * A * x + beta * y
+  ///        (GEMV), on the given executor
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @param executor executor to run blocks of rows on
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  /// @note only the packed triangle of each row, up to the diagonal, is
+  ///       multiplied by x; x and y must not overlap
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result,
+                      common::Executor auto& executor) const {
+    matrix_common::checkGemvLengths(*this, vector.size(), result.size());
+    matrix_common::multiplyRowsByVector(
+        alpha, beta, result,
+        [this, vector](std::size_t rowIndex) {
+          return simd_kernels::dot(rowData(rowIndex), vector.data(),
+                                   rowIndex + 1U);
+        },
+        executor);
+  }
+
+  /// @brief overload of the method above that runs serially, unless the
+  ///        product has as many multiply-adds as parallelThreshold(), then
+  ///        it runs over common::ThreadPool::shared()
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result) const {
+    matrix_common::runMatrixVectorProduct(
+        matrix_common::numberOfTriangleElements(N), [&](auto& executor) {
+          multiplyVector(alpha, vector, beta, result, executor);
+        });
+  }
+
+  /// @brief method to display elements of the matrix
+  /// @return elements surrounded by matrix symbol
+  [[nodiscard]] constexpr auto display() const noexcept -> std::string {
     std::string result;
-    for (auto i{0U}; i < kNumberOfRows; ++i) {
-      result += stringifyRow(row(i)) + (i == kNumberOfRows - 1U ? "" : "\n");
-    }
+    formatMatrixTo(std::back_inserter(result), *this);
 
     return result;
   }
@@ -129,19 +413,62 @@ public:
   using value_type = T;
 
 private:
-  /// @brief helper constexpr method to return the total number of elements in
-  ///        a lower triangle matrix of a given number of rows n
-  /// @param n number of rows of a given matrix
-  /// @return the total number of lower triangle elements in the matrix
-  static constexpr auto numberOfTriangleElements(auto n) noexcept
-      -> std::size_t {
-    // this returns the sum of {1, 2, ... , n}
-    return (n * (n + 1U)) / 2U;
+  /// @brief elements of the lower triangle in the matrix
+  std::array<T, matrix_common::numberOfTriangleElements(N)> m_elements{};
+
+  /// @brief type alias for the packed elements of the triangle
+  using PackedElementsType = decltype(m_elements);
+
+  /// @brief helper method to return an element of the diagonal, the pivot of
+  ///        the triangular solves
+  /// @param index index of the row, and column, of the element
+  /// @return the element of the diagonal
+  /// @throw std::domain_error if the element is zero
+  constexpr auto diagonalElement(std::size_t index) const -> T {
+    const auto element{rowData(index)[index]};
+    if (element == T{}) {
+      throw std::domain_error(std::format(
+          "Cannot solve a singular system, diagonal element {} is zero",
+          index));
+    }
+
+    return element;
   }
 
-  /// @brief elements of the lower triangle in the matrix
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
-  const std::array<T, numberOfTriangleElements(N)> m_elements{};
+  /// @brief helper method to add another matrix scaled by a factor to this
+  ///        one in place
+  /// @param otherMatrix the matrix to add
+  /// @param factor factor to scale the other matrix by
+  /// @return reference to this matrix
+  auto accumulate(const auto& otherMatrix, const T& factor)
+      -> LowerTriangularMatrix& {
+    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(otherMatrix)>,
+                                 LowerTriangularMatrix>) {
+      // both triangles are packed the same, hence added in one pass
+      simd_kernels::multiplyAdd(std::array<T, 1U>{factor},
+                                otherMatrix.m_elements.data(),
+                                std::array<T*, 1U>{m_elements.data()},
+                                m_elements.size());
+    } else {
+      matrix_common::accumulateStoredRows(
+          otherMatrix, factor, [this](std::size_t rowIndex) {
+            return rowData(rowIndex);
+          });
+    }
+
+    return *this;
+  }
+
+  /// @brief constructor that takes the packed triangle elements directly
+  /// @param elements elements of the triangle packed row by row
+  /// @note currently only needed in multiplication
+  constexpr explicit LowerTriangularMatrix(const PackedElementsType& elements)
+      : m_elements{elements} {}
+
+  /// @brief friending with diagonal matrix to build products of both directly
+  ///        in the packed triangle
+  template <common::NaturalNumber auto M, typename U>
+  friend class DiagonalMatrix;
 
   /// @brief helper method to set the triangle elements of the matrix
   /// @tparam ...Rows
@@ -149,8 +476,7 @@ private:
   /// @return deserialized elements of the triangle
   template <typename... Rows>
   constexpr auto fillTriangleElements(auto&&... triangleSides) const noexcept {
-    std::remove_const_t<std::remove_reference_t<decltype(m_elements)>>
-        triangleElements{};
+    PackedElementsType triangleElements{};
 
     const auto setTriangleSideElements{
         [&elems = triangleElements](auto&& triangleSide, auto startPosition,
@@ -183,4 +509,10 @@ private:
 /// @tparam T type of elements of matrix
 template <common::NaturalNumber auto N, typename T>
 class IsMatrixAdt<LowerTriangularMatrix<N, T>> : public std::true_type {};
+
+/// @brief lower triangular matrix stores its rows up to the diagonal only
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix
+template <common::NaturalNumber auto N, typename T>
+class HasPackedRows<LowerTriangularMatrix<N, T>> : public std::true_type {};
 }  // namespace data_structures::matrix_types
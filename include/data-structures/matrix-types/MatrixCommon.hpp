@@ -1,20 +1,131 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
 #include <cstddef>
-#include <functional>
-#include <numeric>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <new>
+#include <ranges>
+#include <span>
+#include <stdexcept>
 #include <type_traits>
+#include <utility>
 // NOLINTNEXTLINE(misc-include-cleaner)
 #include <vector>
 
 // TODO(salah): clean up this include.
 // Personally, I hate it, but clang tidy error was driving me crazy
 #include "../../common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
 
 /// @brief namespace for matrices types
 namespace data_structures::matrix_types {
 
+/// @brief accumulation policy of the multiplication kernels keeping the sums
+///        in the type of the elements, the default one, so that unsigned
+///        integers wrap around while signed ones must not overflow
+struct WrappingAccumulation {
+  /// @brief type the elements are multiplied and accumulated in, and the
+  ///        type of the elements of the product
+  /// @tparam T type of elements of the operands
+  template <typename T>
+  using accumulator_type = T;
+
+  /// @brief whether the sums are kept within the bounds of their type
+  static constexpr bool kBounded{false};
+};
+
+/// @brief accumulation policy widening the elements before they are
+///        multiplied, e.g. std::int32_t ones to std::int64_t, so that their
+///        products and sums fit, the product being of the wide type
+/// @tparam Wide type the elements are widened to
+template <typename Wide>
+struct WidenedAccumulation {
+  /// @brief type the elements are multiplied and accumulated in, and the
+  ///        type of the elements of the product
+  /// @tparam T type of elements of the operands, which Wide must hold
+  template <typename T>
+  using accumulator_type = Wide;
+
+  /// @brief whether the sums are kept within the bounds of their type
+  static constexpr bool kBounded{false};
+};
+
+/// @brief accumulation policy of integral elements clamping every
+///        multiply-add to the bounds of their type, as saturating vector
+///        instructions do
+struct SaturatingAccumulation {
+  /// @brief type the elements are multiplied and accumulated in, and the
+  ///        type of the elements of the product
+  /// @tparam T type of elements of the operands
+  template <std::integral T>
+  using accumulator_type = T;
+
+  /// @brief whether the sums are kept within the bounds of their type
+  static constexpr bool kBounded{true};
+
+  /// @brief method to add the product of two elements to a sum
+  /// @param sum the sum accumulated so far
+  /// @param first first factor of the product
+  /// @param second second factor of the product
+  /// @return the new sum, computed exactly then clamped to the bounds of
+  ///         the type
+  template <std::integral T>
+  static constexpr auto multiplyAdd(T sum, T first, T second) noexcept -> T {
+    // wide enough for the product of any two 64-bit integers plus a third,
+    // so that an overflowing product may still be brought back by the sum
+    __extension__ typedef __int128 SignedWide;
+    __extension__ typedef unsigned __int128 UnsignedWide;
+    using Wide = std::conditional_t<std::is_signed_v<T>, SignedWide,
+                                    UnsignedWide>;
+    static_assert(sizeof(T) <= sizeof(std::int64_t));
+
+    const auto result{static_cast<Wide>(sum) +
+                      (static_cast<Wide>(first) * static_cast<Wide>(second))};
+
+    return static_cast<T>(
+        std::clamp(result, static_cast<Wide>(std::numeric_limits<T>::min()),
+                   static_cast<Wide>(std::numeric_limits<T>::max())));
+  }
+};
+
+/// @brief accumulation policy of integral elements throwing as soon as a
+///        product or a partial sum of the result overflows their type
+struct CheckedAccumulation {
+  /// @brief type the elements are multiplied and accumulated in, and the
+  ///        type of the elements of the product
+  /// @tparam T type of elements of the operands
+  template <std::integral T>
+  using accumulator_type = T;
+
+  /// @brief whether the sums are kept within the bounds of their type
+  static constexpr bool kBounded{true};
+
+  /// @brief method to add the product of two elements to a sum
+  /// @param sum the sum accumulated so far
+  /// @param first first factor of the product
+  /// @param second second factor of the product
+  /// @return the new sum
+  /// @throw std::overflow_error if the product or the sum overflows
+  template <std::integral T>
+  static constexpr auto multiplyAdd(T sum, T first, T second) -> T {
+    T product;
+    T result;
+    if (__builtin_mul_overflow(first, second, &product) ||
+        __builtin_add_overflow(sum, product, &result)) {
+      throw std::overflow_error(std::format(
+          "Product overflows: {} + {} * {} does not fit", sum, first, second));
+    }
+
+    return result;
+  }
+};
+
 /// @brief namespace for common data between matrices types
 namespace matrix_common {
 
@@ -25,49 +136,1016 @@ struct MatrixDimensions {
   static constexpr auto kColumns{COLUMNS};
 };
 
+/// @brief struct to represent the dimensions of a matrix known only at
+///        runtime, members are named after those of MatrixDimensions so that
+///        both can be used interchangeably
+struct DynamicDimensions {
+  std::size_t kRows;     // NOLINT(readability-identifier-naming)
+  std::size_t kColumns;  // NOLINT(readability-identifier-naming)
+};
+
+/// @brief concept for matrices types whose dimensions are known at compile
+///        time, i.e. they can be read from the type itself
+template <typename T>
+concept StaticallySized = requires {
+  typename std::integral_constant<std::size_t, T::dimensions().kRows>;
+  typename std::integral_constant<std::size_t, T::dimensions().kColumns>;
+};
+
+/// @brief helper function to return the number of rows of any matrix type
+/// @param matrix the matrix in question
+/// @return the number of rows of the matrix
+static constexpr auto numberOfRows(const auto& matrix) noexcept -> std::size_t {
+  return matrix.dimensions().kRows;
+}
+
+/// @brief helper function to return the number of columns of any matrix type
+/// @param matrix the matrix in question
+/// @return the number of columns of the matrix
+static constexpr auto numberOfColumns(const auto& matrix) noexcept
+    -> std::size_t {
+  return matrix.dimensions().kColumns;
+}
+
+/// @brief helper function to return the total number of elements in a packed
+///        triangle of a given number of rows n, which is also the offset of
+///        row n in a packed lower triangle
+/// @param n number of rows of the triangle
+/// @return the total number of elements in the triangle
+static constexpr auto numberOfTriangleElements(std::size_t n) noexcept
+    -> std::size_t {
+  // this returns the sum of {1, 2, ... , n}
+  return (n * (n + 1U)) / 2U;
+}
+
+/// @brief helper function to multiply two sizes, e.g. read from the header
+///        of a file that cannot be trusted
+/// @param first first size
+/// @param second second size
+/// @return the product of both sizes
+/// @throw std::invalid_argument if the product does not fit in std::size_t
+static constexpr auto checkedSizeProduct(std::size_t first,
+                                          std::size_t second) -> std::size_t {
+  std::size_t product{0U};
+  if (__builtin_mul_overflow(first, second, &product)) {
+    throw std::invalid_argument(
+        std::format("Size of {}*{} elements overflows", first, second));
+  }
+
+  return product;
+}
+
+/// @brief allocator of memory aligned to the given boundary, e.g. to a cache
+///        line, used for the heap storage of matrices types
+/// @tparam T type of the elements to be allocated
+/// @tparam ALIGNMENT the boundary in bytes, a power of two
+template <typename T, std::size_t ALIGNMENT>
+struct AlignedAllocator {
+  static_assert((ALIGNMENT & (ALIGNMENT - 1U)) == 0U && ALIGNMENT >= alignof(T),
+                "Alignment must be a power of two, and not less than the "
+                "alignment of the type");
+
+  using value_type = T;
+
+  /// @brief needed since the alignment is not a type template parameter
+  template <typename U>
+  struct rebind {
+    using other = AlignedAllocator<U, ALIGNMENT>;
+  };
+
+  constexpr AlignedAllocator() noexcept = default;
+
+  /// @brief converting constructor needed by containers rebinding it
+  template <typename U>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  constexpr AlignedAllocator(const AlignedAllocator<U, ALIGNMENT>&) noexcept {}
+
+  /// @brief method to allocate aligned memory for a number of elements
+  /// @param count number of elements
+  /// @return pointer to the allocated memory
+  [[nodiscard]] auto allocate(std::size_t count) -> T* {
+    if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length{};
+    }
+
+    return static_cast<T*>(
+        ::operator new(count * sizeof(T), std::align_val_t{ALIGNMENT}));
+  }
+
+  /// @brief method to free memory allocated by allocate()
+  /// @param pointer pointer to the allocated memory
+  /// @param count number of elements it was allocated for
+  void deallocate(T* pointer, std::size_t count) noexcept {
+    ::operator delete(pointer, count * sizeof(T), std::align_val_t{ALIGNMENT});
+  }
+
+  /// @brief all instances are interchangeable, as they have no state
+  template <typename U>
+  constexpr auto operator==(
+      const AlignedAllocator<U, ALIGNMENT>&) const noexcept -> bool {
+    return true;
+  }
+};
+
+/// @brief alignment of the buffers products pack their operands in, a cache
+///        line, as misaligned rows halve the throughput of the multiply-add
+///        kernels
+static constexpr std::size_t kWorkspaceAlignment{64U};
+
+/// @brief type alias for the buffer products pack their operands in, that
+///        can be kept across several products to reuse its memory
+/// @tparam T type of elements of the operands
+template <typename T>
+using Workspace = std::vector<T, AlignedAllocator<T, kWorkspaceAlignment>>;
+
+/// @brief helper function to return the workspace kept by the calling thread
+///        for products that have nowhere else to keep one between calls,
+///        e.g. the in-place ones of compound operators
+/// @tparam T type of elements of the operands
+/// @return reference to the workspace of the calling thread, which is only
+///         ever grown, so that later products of the same size reuse it
+/// @note products do not nest on a thread, the workers of a
+///       common::ThreadPool only running blocks of rows of a product, so the
+///       workspace is never used by two products at once
+template <typename T>
+inline auto threadWorkspace() -> Workspace<T>& {
+  thread_local Workspace<T> workspace;
+  return workspace;
+}
+
+/// @brief tile sizes used by the blocked multiplication kernel
+/// @note kRegisterRows rows of the result are computed at once so that every
+///       element loaded from the packed right-hand operand is reused across
+///       them, while kInnerBlock x kColumnsBlock is the panel of the packed
+///       right-hand operand that is meant to stay resident in L1 cache, and
+///       kRowsBlock rows of the result are the unit of work of parallel runs
+struct GemmBlocking {
+  static constexpr std::size_t kRegisterRows{4U};
+  static constexpr std::size_t kInnerBlock{64U};
+  static constexpr std::size_t kColumnsBlock{64U};
+  static constexpr std::size_t kRowsBlock{4U * kRegisterRows};
+};
+
+/// @brief helper function to pack the elements of a matrix into a contiguous
+///        buffer row by row, i.e. row-major order
+/// @param matrix the matrix to be packed
+/// @param packed iterator to the beginning of the buffer to be filled
+static void packRows(const auto& matrix, auto packed) {
+  const auto rows{numberOfRows(matrix)};
+
+  for (std::size_t rowIndex{0U}; rowIndex < rows; ++rowIndex) {
+    packed = matrix.rowView(rowIndex).copyTo(packed);
+  }
+}
+
+/// @brief helper function to pack the elements of a matrix into a contiguous
+///        buffer of column panels, each panel is kColumnsBlock columns wide and
+///        holds all the rows of the matrix, so that the panel can be walked
+///        sequentially by the multiplication kernel
+/// @param matrix the matrix to be packed
+/// @param packed iterator to the beginning of the buffer to be filled
+static void packColumnPanels(const auto& matrix, auto packed) {
+  const auto rows{numberOfRows(matrix)};
+  const auto columns{numberOfColumns(matrix)};
+  constexpr auto kPanelWidth{GemmBlocking::kColumnsBlock};
+
+  for (std::size_t rowIndex{0U}; rowIndex < rows; ++rowIndex) {
+    const auto currentRow{matrix.rowView(rowIndex)};
+    for (std::size_t panelBegin{0U}; panelBegin < columns;
+         panelBegin += kPanelWidth) {
+      const auto panelEnd{std::min(panelBegin + kPanelWidth, columns)};
+      // panels before this one are full panels of all rows
+      const auto panelPosition{(panelBegin * rows) +
+                               (rowIndex * (panelEnd - panelBegin))};
+
+      currentRow.copyTo(panelBegin, panelEnd,
+                        packed + static_cast<std::ptrdiff_t>(panelPosition));
+    }
+  }
+}
+
+/// @brief helper function to return pointer to the first element of a row of
+///        the result of a multiplication
+/// @param productResult either an array of arrays, or a matrix type having
+///        rowData(index) like DynamicMatrix
+/// @param rowIndex index of the row
+/// @return pointer to the first element of the row
+static auto resultRowData(auto& productResult, std::size_t rowIndex) {
+  if constexpr (requires { productResult.rowData(rowIndex); }) {
+    return productResult.rowData(rowIndex);
+  } else {
+    return productResult[rowIndex].data();
+  }
+}
+
+/// @brief number of multiply-adds of a product from which on it is computed
+///        over common::ThreadPool::shared(), products below it stay serial
+/// @return reference to the threshold, that can be tuned at runtime
+inline auto parallelThreshold() noexcept -> std::atomic<std::size_t>& {
+  static std::atomic<std::size_t> threshold{std::size_t{1U} << 21U};
+  return threshold;
+}
+
+/// @brief helper function to multiply a range of rows of an already packed
+///        first operand by an already packed second operand
+/// @param packedFirst first operand packed by packRows
+/// @param packedSecond second operand packed by packColumnPanels
+/// @param inner number of columns of first operand, rows of the second one
+/// @param columns number of columns of the second operand
+/// @param productResult an array of arrays the hold the result elements
+/// @param rowBegin first row of the result to compute
+/// @param rowEnd past the last row of the result to compute
+template <typename T>
+static void multiplyPackedRows(const T* packedFirst, const T* packedSecond,
+                               std::size_t inner, std::size_t columns,
+                               auto& productResult, std::size_t rowBegin,
+                               std::size_t rowEnd) {
+  constexpr auto kRegisterRows{GemmBlocking::kRegisterRows};
+  constexpr auto kInnerBlock{GemmBlocking::kInnerBlock};
+  constexpr auto kPanelWidth{GemmBlocking::kColumnsBlock};
+
+  for (auto rowIndex{rowBegin}; rowIndex < rowEnd; ++rowIndex) {
+    std::fill_n(resultRowData(productResult, rowIndex), columns, T{});
+  }
+
+  for (std::size_t panelBegin{0U}; panelBegin < columns;
+       panelBegin += kPanelWidth) {
+    const auto panelWidth{std::min(kPanelWidth, columns - panelBegin)};
+    const auto* const panel{packedSecond + (panelBegin * inner)};
+
+    for (std::size_t innerBegin{0U}; innerBegin < inner;
+         innerBegin += kInnerBlock) {
+      const auto innerEnd{std::min(innerBegin + kInnerBlock, inner)};
+
+      // main kernel: kRegisterRows rows of the result share each load
+      // from the panel of the second operand
+      auto rowIndex{rowBegin};
+      for (; rowIndex + kRegisterRows <= rowEnd; rowIndex += kRegisterRows) {
+        std::array<T*, kRegisterRows> resultRows;
+        for (std::size_t r{0U}; r < kRegisterRows; ++r) {
+          resultRows[r] =
+              resultRowData(productResult, rowIndex + r) + panelBegin;
+        }
+
+        for (auto innerIndex{innerBegin}; innerIndex < innerEnd; ++innerIndex) {
+          std::array<T, kRegisterRows> factors;
+          for (std::size_t r{0U}; r < kRegisterRows; ++r) {
+            factors[r] = packedFirst[((rowIndex + r) * inner) + innerIndex];
+          }
+
+          simd_kernels::multiplyAdd(factors,
+                                    panel + (innerIndex * panelWidth),
+                                    resultRows, panelWidth);
+        }
+      }
+
+      // remaining rows that do not fill a whole register tile
+      for (; rowIndex < rowEnd; ++rowIndex) {
+        const std::array<T*, 1U> resultRow{
+            resultRowData(productResult, rowIndex) + panelBegin};
+
+        for (auto innerIndex{innerBegin}; innerIndex < innerEnd; ++innerIndex) {
+          const std::array<T, 1U> factor{
+              packedFirst[(rowIndex * inner) + innerIndex]};
+
+          simd_kernels::multiplyAdd(factor, panel + (innerIndex * panelWidth),
+                                    resultRow, panelWidth);
+        }
+      }
+    }
+  }
+}
+
+/// @brief helper function to return the largest magnitude of integral
+///        elements, in the unsigned type of theirs so that it always fits
+/// @param elements the elements in question
+/// @return the largest magnitude
+template <std::integral T>
+static auto largestMagnitude(std::span<const T> elements) noexcept {
+  std::make_unsigned_t<T> largest{};
+  for (const auto element : elements) {
+    if constexpr (std::unsigned_integral<T>) {
+      largest = std::max(largest, element);
+    } else {
+      // negating in the unsigned type fits the magnitude of the minimum too,
+      // cast back as types narrower than int are promoted by the subtraction
+      using Magnitude = std::make_unsigned_t<T>;
+      const auto magnitude{static_cast<Magnitude>(element)};
+      largest = std::max(
+          largest,
+          element < 0 ? static_cast<Magnitude>(Magnitude{} - magnitude)
+                      : magnitude);
+    }
+  }
+
+  return largest;
+}
+
+/// @brief helper function to tell whether no element of the product of two
+///        packed operands can overflow their integral type, so that it can
+///        be accumulated by the vectorized kernels without any check
+/// @param packedFirst elements of the first operand
+/// @param packedSecond elements of the second operand
+/// @param inner number of columns of first operand, rows of the second one
+/// @return whether inner times both largest magnitudes fit the type
+/// @note the bound holds every partial sum, whatever the signs are, it is
+///       computed once in O(n^2) so that the O(n^3) product stays unchecked
+template <std::integral T>
+static auto productFitsType(std::span<const T> packedFirst,
+                            std::span<const T> packedSecond,
+                            std::size_t inner) noexcept -> bool {
+  std::make_unsigned_t<T> bound;
+  return !__builtin_mul_overflow(largestMagnitude(packedFirst),
+                                 largestMagnitude(packedSecond), &bound) &&
+         !__builtin_mul_overflow(bound, inner, &bound) &&
+         std::cmp_less_equal(bound, std::numeric_limits<T>::max());
+}
+
+/// @brief helper function to multiply a range of rows of an already packed
+///        first operand by an already packed second operand, one multiply-add
+///        of the accumulation policy at a time, for the products whose
+///        elements may overflow their type
+/// @tparam Accumulation a bounded accumulation policy
+/// @param packedFirst first operand packed by packRows
+/// @param packedSecond second operand packed by packColumnPanels
+/// @param inner number of columns of first operand, rows of the second one
+/// @param columns number of columns of the second operand
+/// @param productResult an array of arrays the hold the result elements
+/// @param rowBegin first row of the result to compute
+/// @param rowEnd past the last row of the result to compute
+template <typename Accumulation, typename T>
+static void multiplyPackedRowsBounded(const T* packedFirst,
+                                      const T* packedSecond, std::size_t inner,
+                                      std::size_t columns,
+                                      auto& productResult,
+                                      std::size_t rowBegin,
+                                      std::size_t rowEnd) {
+  constexpr auto kPanelWidth{GemmBlocking::kColumnsBlock};
+
+  for (auto rowIndex{rowBegin}; rowIndex < rowEnd; ++rowIndex) {
+    auto* const resultRow{resultRowData(productResult, rowIndex)};
+    const auto* const firstRow{packedFirst + (rowIndex * inner)};
+    std::fill_n(resultRow, columns, T{});
+
+    for (std::size_t panelBegin{0U}; panelBegin < columns;
+         panelBegin += kPanelWidth) {
+      const auto panelWidth{std::min(kPanelWidth, columns - panelBegin)};
+      const auto* const panel{packedSecond + (panelBegin * inner)};
+
+      // each element is accumulated in the order of the vectorized kernel
+      for (std::size_t innerIndex{0U}; innerIndex < inner; ++innerIndex) {
+        const auto* const panelRow{panel + (innerIndex * panelWidth)};
+        for (std::size_t j{0U}; j < panelWidth; ++j) {
+          resultRow[panelBegin + j] = Accumulation::multiplyAdd(
+              resultRow[panelBegin + j], firstRow[innerIndex], panelRow[j]);
+        }
+      }
+    }
+  }
+}
+
 /// @brief helper function to multiply rows of first matrix by columns of second
 ///        matrix, i.e the definition of matrices multiplication
+/// @tparam Accumulation accumulation policy, e.g. CheckedAccumulation
 /// @param firstMatrix first operand of matrices multiplication
 /// @param secondMatrix second operand of matrices multiplication
-/// @param productResult an array of arrays the hold the result elements
+/// @param productResult an array of arrays the hold the result elements, or
+///        a matrix type having rowData(index) like DynamicMatrix
+/// @param executor executor to run blocks of kRowsBlock rows of the result on
+/// @param workspace Workspace the operands are packed in, grown if needed
+/// @note both operands are packed once into a single buffer, then the product
+///       is accumulated panel by panel of the second operand, kRegisterRows
+///       rows of the result at a time, so no allocation nor copy takes place
+///       per element of the result. The accumulation itself is done by the
+///       vectorized kernels of simd_kernels::multiplyAdd.
+///       Each element of the result is computed by a single task in the same
+///       order whatever the executor is, so results are deterministic
+/// @note dimensions are asserted at compile time when both operands are
+///       statically sized, otherwise the caller is expected to check them
+/// @note operands are packed as elements of the accumulator type of the
+///       policy, which productResult and workspace must hold. Bounded
+///       policies only leave the vectorized kernels when productFitsType()
+///       cannot rule out an overflow
 // TODO(salah): make it accept matrix adt concept for first two parameters
+template <typename Accumulation = WrappingAccumulation>
+static void multiplyRowsByColumns(const auto& firstMatrix,
+                                  const auto& secondMatrix, auto& productResult,
+                                  common::Executor auto& executor,
+                                  auto& workspace) {
+  using FirstMatrixType = std::remove_cvref_t<decltype(firstMatrix)>;
+  using SecondMatrixType = std::remove_cvref_t<decltype(secondMatrix)>;
+
+  // type alias for element type in in either of both matrices
+  using value_type = FirstMatrixType::value_type;  // or SecondMatrixType
+  using accumulator_type =
+      Accumulation::template accumulator_type<value_type>;
+
+  if constexpr (StaticallySized<FirstMatrixType> &&
+                StaticallySized<SecondMatrixType>) {
+    static_assert(FirstMatrixType::dimensions().kColumns ==
+                  SecondMatrixType::dimensions().kRows);
+  }
+
+  const auto rows{numberOfRows(firstMatrix)};
+  const auto inner{numberOfColumns(firstMatrix)};
+  const auto columns{numberOfColumns(secondMatrix)};
+
+  // first operand is packed row-major, second one into column panels
+  workspace.resize((rows * inner) + (inner * columns));
+  const accumulator_type* const packedFirst{workspace.data()};
+  const accumulator_type* const packedSecond{packedFirst + (rows * inner)};
+  packRows(firstMatrix, workspace.begin());
+  packColumnPanels(
+      secondMatrix,
+      workspace.begin() + static_cast<std::ptrdiff_t>(rows * inner));
+
+  bool mayOverflow{false};
+  if constexpr (Accumulation::kBounded) {
+    mayOverflow = !productFitsType(
+        std::span{packedFirst, rows * inner},
+        std::span{packedSecond, inner * columns}, inner);
+  }
+
+  constexpr auto kRowsBlock{GemmBlocking::kRowsBlock};
+  executor.parallelFor(
+      (rows + kRowsBlock - 1U) / kRowsBlock,
+      [packedFirst, packedSecond, inner, columns, rows, mayOverflow,
+       &productResult](std::size_t block) {
+        const auto rowBegin{block * kRowsBlock};
+        const auto rowEnd{std::min(rowBegin + kRowsBlock, rows)};
+        if constexpr (Accumulation::kBounded) {
+          if (mayOverflow) {
+            multiplyPackedRowsBounded<Accumulation>(
+                packedFirst, packedSecond, inner, columns, productResult,
+                rowBegin, rowEnd);
+            return;
+          }
+        }
+
+        multiplyPackedRows(packedFirst, packedSecond, inner, columns,
+                           productResult, rowBegin, rowEnd);
+      });
+}
+
+/// @brief overload of the helper function above packing the operands in a
+///        workspace of its own
+/// @tparam Accumulation accumulation policy, e.g. CheckedAccumulation
+/// @param firstMatrix first operand of matrices multiplication
+/// @param secondMatrix second operand of matrices multiplication
+/// @param productResult an array of arrays the hold the result elements, or
+///        a matrix type having rowData(index) like DynamicMatrix
+/// @param executor executor to run blocks of kRowsBlock rows of the result on
+template <typename Accumulation = WrappingAccumulation>
+static void multiplyRowsByColumns(const auto& firstMatrix,
+                                  const auto& secondMatrix, auto& productResult,
+                                  common::Executor auto& executor) {
+  using value_type = std::remove_cvref_t<decltype(firstMatrix)>::value_type;
+
+  Workspace<typename Accumulation::template accumulator_type<value_type>>
+      workspace;
+  multiplyRowsByColumns<Accumulation>(firstMatrix, secondMatrix,
+                                      productResult, executor, workspace);
+}
+
+/// @brief overload of the helper function above that runs serially, unless
+///        the product is as large as parallelThreshold(), then it runs over
+///        common::ThreadPool::shared()
+/// @tparam Accumulation accumulation policy, e.g. CheckedAccumulation
+/// @param firstMatrix first operand of matrices multiplication
+/// @param secondMatrix second operand of matrices multiplication
+/// @param productResult an array of arrays the hold the result elements, or
+///        a matrix type having rowData(index) like DynamicMatrix
+template <typename Accumulation = WrappingAccumulation>
 static void multiplyRowsByColumns(const auto& firstMatrix,
                                   const auto& secondMatrix,
                                   auto& productResult) {
-  std::for_each(
-      productResult.begin(), productResult.end(),
-      [resultBegin = productResult.begin(), &firstMatrix,
-       &secondMatrix](auto& resultRow) {
-        const auto rowIndex{
-            static_cast<std::size_t>(std::distance(resultBegin, &resultRow))};
-        const auto currentRow{firstMatrix.row(rowIndex)};
-
-        // TODO(salah): use iterators instead
-        auto colIndex{0U};
-        std::generate(
-            resultRow.begin(), resultRow.end(),
-            [&currentRow, &secondMatrix, &colIndex] {
-              auto column{secondMatrix.column(colIndex++)};
-
-              // type alias for element type in in either of both matrices
-              using value_type = std::remove_const<std::remove_reference_t<
-                  decltype(firstMatrix)>>::type::value_type;  // or secondMatrix
-
-              std::vector<value_type> elemsProduct(
-                  currentRow.size()  // or column.size()
-              );
-              std::transform(currentRow.cbegin(), currentRow.cend(),
-                             column.cbegin(), elemsProduct.begin(),
-                             std::multiplies<value_type>());
-
-              return std::accumulate(elemsProduct.cbegin(), elemsProduct.cend(),
-                                     0U);
-            });
+  const auto multiplyAdds{numberOfRows(firstMatrix) *
+                          numberOfColumns(firstMatrix) *
+                          numberOfColumns(secondMatrix)};
+
+  if (multiplyAdds < parallelThreshold().load(std::memory_order_relaxed)) {
+    common::SerialExecutor executor;
+    multiplyRowsByColumns<Accumulation>(firstMatrix, secondMatrix,
+                                        productResult, executor);
+  } else {
+    multiplyRowsByColumns<Accumulation>(firstMatrix, secondMatrix,
+                                        productResult,
+                                        common::ThreadPool::shared());
+  }
+}
+
+/// @brief helper function to multiply a range of rows of the first matrix by
+///        the second matrix, walking only the stored elements of their rows,
+///        i.e. structural zeros of packed matrices types are skipped
+/// @param firstMatrix first operand of matrices multiplication
+/// @param secondMatrix second operand of matrices multiplication
+/// @param resultRow callable returning pointer to the element at the first
+///        column of a row of the result, which is accumulated into
+/// @param rowBegin first row of the result to compute
+/// @param rowEnd past the last row of the result to compute
+/// @note the stored elements of the rows of the second operand are read by
+///       the multiply-add kernels when contiguous, which holds for the row
+///       views of all dense and packed matrices types but symmetric ones
+static void multiplyStoredRows(const auto& firstMatrix,
+                               const auto& secondMatrix, const auto& resultRow,
+                               std::size_t rowBegin, std::size_t rowEnd) {
+  using value_type = std::remove_cvref_t<decltype(firstMatrix)>::value_type;
+
+  for (auto rowIndex{rowBegin}; rowIndex < rowEnd; ++rowIndex) {
+    const auto firstRow{firstMatrix.rowView(rowIndex)};
+    const auto firstMapping{firstRow.mapping()};
+    value_type* const result{resultRow(rowIndex)};
+
+    // result row is a sum of the rows of the second matrix scaled by the
+    // stored elements of the row of the first one
+    for (auto innerIndex{firstMapping.first}; innerIndex < firstMapping.last;
+         ++innerIndex) {
+      const auto secondRow{secondMatrix.rowView(innerIndex)};
+      const auto secondMapping{secondRow.mapping()};
+      if (secondMapping.last <= secondMapping.first) {
+        continue;
+      }
+
+      const std::array<value_type, 1U> factor{
+          firstRow.data()[firstMapping.offset(innerIndex)]};
+
+      if constexpr (requires { secondMapping.stride; }) {
+        if (secondMapping.stride == 1U) {
+          const std::array<value_type*, 1U> destination{result +
+                                                        secondMapping.first};
+
+          simd_kernels::multiplyAdd(factor, secondRow.data(), destination,
+                                    secondMapping.last - secondMapping.first);
+          continue;
+        }
+      }
+
+      // rows not contiguous in storage, e.g. the ones of symmetric matrices
+      // or the columns of a matrix viewed as rows, are read element by
+      // element
+      for (auto index{secondMapping.first}; index < secondMapping.last;
+           ++index) {
+        result[index] += factor[0U] * secondRow[index];
+      }
+    }
+  }
+}
+
+/// @brief helper function to multiply matrices, of which at least one has
+///        packed rows, skipping the structural zeros of both
+/// @param firstMatrix first operand of matrices multiplication
+/// @param secondMatrix second operand of matrices multiplication
+/// @param resultRow callable returning pointer to the element at the first
+///        column of a row of the result, the result is expected to be zeroed
+/// @param executor executor to run blocks of kRowsBlock rows of the result on
+static void multiplyStoredElements(const auto& firstMatrix,
+                                   const auto& secondMatrix,
+                                   const auto& resultRow,
+                                   common::Executor auto& executor) {
+  using FirstMatrixType = std::remove_cvref_t<decltype(firstMatrix)>;
+  using SecondMatrixType = std::remove_cvref_t<decltype(secondMatrix)>;
+
+  static_assert(FirstMatrixType::dimensions().kColumns ==
+                SecondMatrixType::dimensions().kRows);
+
+  const auto rows{numberOfRows(firstMatrix)};
+  constexpr auto kRowsBlock{GemmBlocking::kRowsBlock};
+  executor.parallelFor(
+      (rows + kRowsBlock - 1U) / kRowsBlock,
+      [&firstMatrix, &secondMatrix, &resultRow, rows](std::size_t block) {
+        const auto rowBegin{block * kRowsBlock};
+        multiplyStoredRows(firstMatrix, secondMatrix, resultRow, rowBegin,
+                           std::min(rowBegin + kRowsBlock, rows));
       });
 }
 
+/// @brief overload of the helper function above that runs serially, unless
+///        the product is as large as parallelThreshold(), then it runs over
+///        common::ThreadPool::shared()
+/// @param firstMatrix first operand of matrices multiplication
+/// @param secondMatrix second operand of matrices multiplication
+/// @param resultRow callable returning pointer to the element at the first
+///        column of a row of the result, the result is expected to be zeroed
+/// @note the threshold is compared against the dense number of multiply-adds,
+///       so packed products run serially up to somewhat larger sizes
+static void multiplyStoredElements(const auto& firstMatrix,
+                                   const auto& secondMatrix,
+                                   const auto& resultRow) {
+  const auto multiplyAdds{numberOfRows(firstMatrix) *
+                          numberOfColumns(firstMatrix) *
+                          numberOfColumns(secondMatrix)};
+
+  if (multiplyAdds < parallelThreshold().load(std::memory_order_relaxed)) {
+    common::SerialExecutor executor;
+    multiplyStoredElements(firstMatrix, secondMatrix, resultRow, executor);
+  } else {
+    multiplyStoredElements(firstMatrix, secondMatrix, resultRow,
+                           common::ThreadPool::shared());
+  }
+}
+
+/// @brief helper function to add the stored elements of a line, scaled by a
+///        factor, to a range in place, i.e. an axpy skipping structural zeros
+/// @param line view of the row, or the column, added
+/// @param factor factor to scale the line added by
+/// @param result pointer to the element of the destination at the first
+///        index of the line, only the stored positions of the line are
+///        accumulated into
+static void accumulateStoredLine(const auto& line, const auto& factor,
+                                 auto* result) {
+  using value_type = std::remove_cvref_t<decltype(line)>::value_type;
+
+  if constexpr (requires { line.mapping().stride; }) {
+    const auto mapping{line.mapping()};
+    if (mapping.last <= mapping.first) {
+      return;
+    }
+
+    // rows are contiguous in all dense and packed matrices types, columns
+    // are not
+    if (mapping.stride == 1U) {
+      simd_kernels::multiplyAdd(std::array<value_type, 1U>{factor},
+                                line.data(),
+                                std::array<value_type*, 1U>{result +
+                                                            mapping.first},
+                                mapping.last - mapping.first);
+    } else {
+      for (auto index{mapping.first}; index < mapping.last; ++index) {
+        result[index] += factor * line[index];
+      }
+    }
+  } else if constexpr (requires { line.indices(); }) {
+    const auto indices{line.indices()};
+    const auto values{line.values()};
+    for (std::size_t i{0U}; i < indices.size(); ++i) {
+      result[indices[i]] += factor * values[i];
+    }
+  } else {
+    for (std::size_t i{0U}; i < line.size(); ++i) {
+      result[i] += factor * line[i];
+    }
+  }
+}
+
+/// @brief helper function to add the stored elements of a matrix, scaled by a
+///        factor, to the rows of another one in place, i.e. an axpy per row
+/// @param matrix the matrix added
+/// @param factor factor to scale the matrix added by, e.g. -1 to subtract it
+/// @param resultRow callable returning pointer to the element at the first
+///        column of a row of the destination
+/// @note structural zeros of the matrix added are skipped, so a destination
+///       with packed rows only needs to store the positions the other stores
+static void accumulateStoredRows(const auto& matrix, const auto& factor,
+                                 const auto& resultRow) {
+  const auto rows{numberOfRows(matrix)};
+
+  for (std::size_t rowIndex{0U}; rowIndex < rows; ++rowIndex) {
+    accumulateStoredLine(matrix.rowView(rowIndex), factor,
+                         resultRow(rowIndex));
+  }
+}
+
+/// @brief tile size at which the cache-oblivious transposes stop recursing
+/// @note a kLeaf x kLeaf block of source and destination fits in L1 cache for
+///       all element types, and is a multiple of every micro-transpose
+struct TransposeBlocking {
+  static constexpr std::size_t kLeaf{32U};
+  static constexpr std::size_t kMicroTile{8U};
+};
+
+/// @brief helper function to split a dimension of a transpose in two halves,
+///        keeping the first half a multiple of the micro-transposes
+/// @param size the dimension to split, larger than TransposeBlocking::kLeaf
+/// @return size of the first half
+constexpr auto transposeSplit(std::size_t size) noexcept -> std::size_t {
+  constexpr auto kMicroTile{TransposeBlocking::kMicroTile};
+
+  return ((size / 2U) + kMicroTile - 1U) / kMicroTile * kMicroTile;
+}
+
+/// @brief helper function to transpose a matrix stored row by row into
+///        another, halving the larger dimension until the blocks fit in
+///        cache, whatever its size is, i.e. cache-oblivious
+/// @tparam T type of the elements
+/// @param source first element of the matrix to be transposed
+/// @param sourceStride distance between two consecutive rows of the source
+/// @param destination first element of the transposed matrix
+/// @param destinationStride distance between two consecutive rows of the
+///        destination
+/// @param rows number of rows of the source
+/// @param columns number of columns of the source
+template <typename T>
+static void transposeRecursive(const T* source, std::size_t sourceStride,
+                               T* destination, std::size_t destinationStride,
+                               std::size_t rows, std::size_t columns) {
+  constexpr auto kLeaf{TransposeBlocking::kLeaf};
+
+  if (rows <= kLeaf && columns <= kLeaf) {
+    simd_kernels::transposeBlock<T>(source, sourceStride, destination,
+                                    destinationStride, rows, columns);
+  } else if (rows >= columns) {
+    const auto half{transposeSplit(rows)};
+    transposeRecursive(source, sourceStride, destination, destinationStride,
+                       half, columns);
+    transposeRecursive(source + (half * sourceStride), sourceStride,
+                       destination + half, destinationStride, rows - half,
+                       columns);
+  } else {
+    const auto half{transposeSplit(columns)};
+    transposeRecursive(source, sourceStride, destination, destinationStride,
+                       rows, half);
+    transposeRecursive(source + half, sourceStride,
+                       destination + (half * destinationStride),
+                       destinationStride, rows, columns - half);
+  }
+}
+
+/// @brief helper function to swap a block with the transpose of another one
+///        of the same matrix, both not overlapping each other
+/// @tparam T type of the elements
+/// @param first first element of the first block, of [rows*columns]
+/// @param second first element of the second block, of [columns*rows]
+/// @param stride distance between two consecutive rows of the matrix
+/// @param rows number of rows of the first block
+/// @param columns number of columns of the first block
+template <typename T>
+static void swapTransposed(T* first, T* second, std::size_t stride,
+                           std::size_t rows, std::size_t columns) {
+  constexpr auto kLeaf{TransposeBlocking::kLeaf};
+
+  if (rows <= kLeaf && columns <= kLeaf) {
+    std::array<T, kLeaf * kLeaf> buffer;
+    simd_kernels::transposeBlock<T>(first, stride, buffer.data(), rows, rows,
+                                    columns);
+    simd_kernels::transposeBlock<T>(second, stride, first, stride, columns,
+                                    rows);
+    for (std::size_t rowIndex{0U}; rowIndex < columns; ++rowIndex) {
+      std::copy_n(buffer.data() + (rowIndex * rows), rows,
+                  second + (rowIndex * stride));
+    }
+  } else if (rows >= columns) {
+    const auto half{transposeSplit(rows)};
+    swapTransposed(first, second, stride, half, columns);
+    swapTransposed(first + (half * stride), second + half, stride,
+                   rows - half, columns);
+  } else {
+    const auto half{transposeSplit(columns)};
+    swapTransposed(first, second, stride, rows, half);
+    swapTransposed(first + half, second + (half * stride), stride, rows,
+                   columns - half);
+  }
+}
+
+/// @brief helper function to transpose a square matrix in place, the
+///        diagonal blocks are transposed recursively, and the blocks on both
+///        sides of the diagonal are swapped with each other's transpose
+/// @tparam T type of the elements
+/// @param elements first element of the matrix
+/// @param stride distance between two consecutive rows of the matrix
+/// @param size number of rows, and columns, of the matrix
+template <typename T>
+static void transposeSquareInPlace(T* elements, std::size_t stride,
+                                   std::size_t size) {
+  constexpr auto kLeaf{TransposeBlocking::kLeaf};
+
+  if (size <= kLeaf) {
+    // the micro-transposes cannot overlap, so the block goes through a buffer
+    std::array<T, kLeaf * kLeaf> buffer;
+    simd_kernels::transposeBlock<T>(elements, stride, buffer.data(), size,
+                                    size, size);
+    for (std::size_t rowIndex{0U}; rowIndex < size; ++rowIndex) {
+      std::copy_n(buffer.data() + (rowIndex * size), size,
+                  elements + (rowIndex * stride));
+    }
+    return;
+  }
+
+  const auto half{transposeSplit(size)};
+  transposeSquareInPlace(elements, stride, half);
+  transposeSquareInPlace(elements + (half * stride) + half, stride,
+                         size - half);
+  swapTransposed(elements + half, elements + (half * stride), stride, half,
+                 size - half);
+}
+
+/// @brief helper function to check whether a square matrix is equal to its
+///        transpose, tile by tile against a transposed copy of the mirrored
+///        tile, so that both are read row by row, and each pair of elements
+///        is compared once
+/// @tparam T type of the elements
+/// @param elements first element of the matrix
+/// @param stride distance between two consecutive rows of the matrix
+/// @param size number of rows, and columns, of the matrix
+/// @return true if the matrix is symmetric, false otherwise
+/// @note it returns as soon as a pair of tiles differ
+template <typename T>
+static auto isSymmetricSquare(const T* elements, std::size_t stride,
+                              std::size_t size) -> bool {
+  constexpr auto kLeaf{TransposeBlocking::kLeaf};
+  std::array<T, kLeaf * kLeaf> mirrored;
+
+  for (std::size_t rowBegin{0U}; rowBegin < size; rowBegin += kLeaf) {
+    const auto rows{std::min(kLeaf, size - rowBegin)};
+
+    for (auto columnBegin{rowBegin}; columnBegin < size;
+         columnBegin += kLeaf) {
+      const auto columns{std::min(kLeaf, size - columnBegin)};
+      simd_kernels::transposeBlock<T>(
+          elements + (columnBegin * stride) + rowBegin, stride,
+          mirrored.data(), columns, columns, rows);
+
+      for (std::size_t rowIndex{0U}; rowIndex < rows; ++rowIndex) {
+        // tiles on the diagonal are only compared above it, the diagonal and
+        // the lower triangle being the same comparisons mirrored
+        const auto skipped{columnBegin == rowBegin ? rowIndex + 1U : 0U};
+        const auto* const row{elements + ((rowBegin + rowIndex) * stride) +
+                              columnBegin};
+        if (!std::equal(row + skipped, row + columns,
+                        mirrored.data() + (rowIndex * columns) + skipped)) {
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+/// @brief helper function to check whether all the elements of a square
+///        matrix stored row by row are zeros outside of a band around the
+///        diagonal, without copying any of its rows
+/// @tparam T type of the elements
+/// @param elements first element of the matrix
+/// @param stride distance between two consecutive rows of the matrix
+/// @param size number of rows, and columns, of the matrix
+/// @param lowerBandwidth number of diagonals of the band below the diagonal
+/// @param upperBandwidth number of diagonals of the band above the diagonal
+/// @return true if no element outside of the band is non-zero
+/// @note it returns as soon as a non-zero element is found outside the band
+template <typename T>
+constexpr auto isZeroOutsideBand(const T* elements, std::size_t stride,
+                                 std::size_t size, std::size_t lowerBandwidth,
+                                 std::size_t upperBandwidth) -> bool {
+  const auto isZero{[](const T& element) { return element == T{}; }};
+
+  for (std::size_t rowIndex{0U}; rowIndex < size; ++rowIndex) {
+    const auto* const row{elements + (rowIndex * stride)};
+    const auto bandBegin{rowIndex > lowerBandwidth ? rowIndex - lowerBandwidth
+                                                   : 0U};
+    const auto bandEnd{size - rowIndex > upperBandwidth
+                           ? rowIndex + upperBandwidth + 1U
+                           : size};
+
+    if (!std::all_of(row, row + bandBegin, isZero) ||
+        !std::all_of(row + bandEnd, row + size, isZero)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/// @brief function to check both operands of an element-wise operation have
+///        the same dimensions, at compile time when both are statically sized
+/// @param first first operand
+/// @param second second operand
+/// @param operation name of the operation, used in the error message
+/// @throw std::invalid_argument if dimensions are not the same
+constexpr void checkSameDimensions(const auto& first, const auto& second,
+                                   const char* operation) {
+  using FirstMatrixType = std::remove_cvref_t<decltype(first)>;
+  using SecondMatrixType = std::remove_cvref_t<decltype(second)>;
+
+  if constexpr (StaticallySized<FirstMatrixType> &&
+                StaticallySized<SecondMatrixType>) {
+    static_assert(FirstMatrixType::dimensions().kRows ==
+                          SecondMatrixType::dimensions().kRows &&
+                      FirstMatrixType::dimensions().kColumns ==
+                          SecondMatrixType::dimensions().kColumns,
+                  "Dimensions are not the same");
+  } else if (numberOfRows(first) != numberOfRows(second) ||
+             numberOfColumns(first) != numberOfColumns(second)) {
+    throw std::invalid_argument(std::format(
+        "Cannot {} [{}*{}] matrix and [{}*{}] matrix", operation,
+        numberOfRows(first), numberOfColumns(first), numberOfRows(second),
+        numberOfColumns(second)));
+  }
+}
+
+/// @brief number of rows of a matrix-vector product computed by a single task
+static constexpr std::size_t kGemvRowsBlock{256U};
+
+/// @brief helper function to check the lengths of the vectors of a
+///        matrix-vector product
+/// @param matrix the matrix multiplied
+/// @param vectorLength number of elements of the vector multiplied
+/// @param resultLength number of elements of the vector accumulated into
+/// @throw std::invalid_argument if the vector is not of as many elements as
+///        columns of the matrix, or the result as rows
+static void checkGemvLengths(const auto& matrix, std::size_t vectorLength,
+                             std::size_t resultLength) {
+  if (vectorLength != numberOfColumns(matrix) ||
+      resultLength != numberOfRows(matrix)) {
+    throw std::invalid_argument(
+        std::format("Cannot multiply [{}*{}] matrix by vector of {} elements "
+                    "into vector of {} elements",
+                    numberOfRows(matrix), numberOfColumns(matrix),
+                    vectorLength, resultLength));
+  }
+}
+
+/// @brief helper function to scale the vector a matrix-vector product is
+///        accumulated into, y = beta * y
+/// @param beta factor of the vector, which is only written when zero, as
+///        BLAS does, so that its previous elements may be anything
+/// @param result the vector in question
+template <typename T>
+static void scaleAccumulated(T beta, std::span<T> result) {
+  if (beta == T{}) {
+    std::ranges::fill(result, T{});
+  } else if (beta != T{1}) {
+    for (auto& element : result) {
+      element *= beta;
+    }
+  }
+}
+
+/// @brief helper function to compute a matrix-vector product row by row,
+///        y_i = alpha * (A_i . x) + beta * y_i, blocks of kGemvRowsBlock rows
+///        being computed by independent tasks
+/// @param alpha factor of the product
+/// @param beta factor of the vector accumulated into, which is not read when
+///        zero
+/// @param result the vector accumulated into, of as many elements as rows
+/// @param rowProduct callable returning the dot product of the row at the
+///        given index with the vector multiplied
+/// @param executor executor to run the blocks of rows on
+template <typename T>
+static void multiplyRowsByVector(T alpha, T beta, std::span<T> result,
+                                 const auto& rowProduct,
+                                 common::Executor auto& executor) {
+  const auto rows{result.size()};
+  executor.parallelFor(
+      (rows + kGemvRowsBlock - 1U) / kGemvRowsBlock,
+      [alpha, beta, result, rows, &rowProduct](std::size_t block) {
+        const auto rowEnd{std::min((block + 1U) * kGemvRowsBlock, rows)};
+        for (auto rowIndex{block * kGemvRowsBlock}; rowIndex < rowEnd;
+             ++rowIndex) {
+          const auto product{alpha * rowProduct(rowIndex)};
+          result[rowIndex] =
+              beta == T{} ? product : product + (beta * result[rowIndex]);
+        }
+      });
+}
+
+/// @brief helper function to run a matrix-vector product serially, unless
+///        it has as many multiply-adds as parallelThreshold(), then over
+///        common::ThreadPool::shared()
+/// @param multiplyAdds number of multiply-adds of the product
+/// @param product callable computing the product on the executor it is
+///        passed
+static void runMatrixVectorProduct(std::size_t multiplyAdds,
+                                   const auto& product) {
+  if (multiplyAdds < parallelThreshold().load(std::memory_order_relaxed)) {
+    common::SerialExecutor executor;
+    product(executor);
+  } else {
+    product(common::ThreadPool::shared());
+  }
+}
+
 }  // namespace matrix_common
 
+/// @brief function to accumulate a scaled vector into another one,
+///        y = alpha * x + y (AXPY), on the vectorized kernels
+/// @param alpha factor of x
+/// @param vector contiguous range x, e.g. a std::span or a std::vector
+/// @param result contiguous range y, of as many elements as x
+/// @throw std::invalid_argument if the ranges are of different lengths
+/// @note x and y must not overlap
+template <std::ranges::contiguous_range Vector,
+          std::ranges::contiguous_range Result>
+void axpy(std::ranges::range_value_t<Vector> alpha, const Vector& vector,
+          Result&& result) {
+  using value_type = std::ranges::range_value_t<Vector>;
+  static_assert(std::is_same_v<std::ranges::range_value_t<Result>, value_type>,
+                "Element types are not the same");
+
+  const auto size{std::ranges::size(vector)};
+  if (std::ranges::size(result) != size) {
+    throw std::invalid_argument(
+        std::format("Cannot accumulate vector of {} elements into vector of "
+                    "{} elements",
+                    size, std::ranges::size(result)));
+  }
+
+  simd_kernels::multiplyAdd(std::array<value_type, 1U>{alpha},
+                            std::ranges::data(vector),
+                            std::array<value_type*, 1U>{
+                                std::ranges::data(result)},
+                            size);
+}
+
 /// @brief a tag to be used to strict matrices types only
 /// @note it can be used in an intrusive approach via inheritance (preferred
 ///       privately tho), or non-intrusively through specialization
@@ -84,6 +1162,31 @@ class IsMatrixAdt : public std::is_base_of<MatrixAdtTag, T> {};
 template <typename T>
 constexpr bool kIsMatrixAdtV = IsMatrixAdt<T>::value;
 
+/// @brief trait for matrices types storing only part of each row, e.g. the
+///        triangle of a triangular matrix, so that products involving them
+///        can skip the structural zeros
+/// @tparam T the type in question
+/// @note it is specialized non-intrusively by such matrices types
+template <typename T>
+class HasPackedRows : public std::false_type {};
+
+/// @brief a compile-time shortcut for the trait above
+/// @tparam T the type in question
+template <typename T>
+constexpr bool kHasPackedRowsV = HasPackedRows<T>::value;
+
+/// @brief trait for matrices types storing every element of each row, one
+///        row after the other, so that rowData() points to a whole row
+/// @tparam T the type in question
+/// @note it is specialized non-intrusively by such matrices types
+template <typename T>
+class HasDenseRows : public std::false_type {};
+
+/// @brief a compile-time shortcut for the trait above
+/// @tparam T the type in question
+template <typename T>
+constexpr bool kHasDenseRowsV = HasDenseRows<T>::value;
+
 /// @brief concept for Matrix ADT interface
 template <typename T>
 concept MatrixAdtConcept = requires(T matrix) {
@@ -96,13 +1199,10 @@ concept MatrixAdtConcept = requires(T matrix) {
 
   typename T::value_type;
 } && requires(T matrix, std::size_t index) {
-  // TODO(salah):
-  // 1- implement rows() and columns() in the remaining matrices types
-  // 2- added them to the concept here
-  // 3- remove row(index) and column(index) from the concept and from the public
-  //    section as well
-  matrix.row(index);
-  matrix.column(index);
+  matrix.rows();
+  matrix.columns();
+  matrix.rowView(index);
+  matrix.columnView(index);
 } && kIsMatrixAdtV<T>;
 
 }  // namespace data_structures::matrix_types
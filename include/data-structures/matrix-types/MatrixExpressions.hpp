@@ -0,0 +1,941 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/FastMultiplication.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief trait to check whether a type is a lazy matrix expression,
+///        specialized in a non-intrusive way by each expression type
+/// @tparam T the type in question
+template <typename T>
+class IsMatrixExpression : public std::false_type {};
+
+/// @brief concept for lazy matrix expressions, i.e. trees of operations
+///        over matrices that are evaluated only when their result is needed
+template <typename T>
+concept MatrixExpression = IsMatrixExpression<std::remove_cvref_t<T>>::value;
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief concept for expressions whose dimensions are known at compile time
+template <typename T>
+concept StaticallySizedExpression =
+    !std::is_same_v<decltype(std::declval<const T&>().dimensions()),
+                    DynamicDimensions>;
+
+/// @brief line of an element-wise operation over two lines, computing each
+///        element on access
+/// @tparam FirstLine type of the line of the first operand
+/// @tparam SecondLine type of the line of the second operand
+/// @tparam Operation element-wise operation, e.g. std::plus<>
+template <typename FirstLine, typename SecondLine, typename Operation>
+class ElementwiseLine {
+public:
+  /// @brief constructor of the line from the lines of both operands
+  /// @param first line of the first operand
+  /// @param second line of the second operand
+  constexpr ElementwiseLine(FirstLine first, SecondLine second)
+      : m_first{std::move(first)}, m_second{std::move(second)} {}
+
+  /// @brief subscript operator computing the element at the given position
+  /// @param index position of the element within the line
+  /// @return the result of the operation on both elements
+  constexpr auto operator[](std::size_t index) const {
+    return Operation{}(m_first[index], m_second[index]);
+  }
+
+private:
+  /// @brief line of the first operand
+  FirstLine m_first;
+
+  /// @brief line of the second operand
+  SecondLine m_second;
+};
+
+/// @brief line scaled by a scalar, computing each element on access
+/// @tparam Line type of the line scaled
+/// @tparam T type of the scalar
+template <typename Line, typename T>
+class ScaledLine {
+public:
+  /// @brief constructor of the line from the line scaled and the scalar
+  /// @param line the line scaled
+  /// @param scalar the scalar to multiply elements by
+  constexpr ScaledLine(Line line, T scalar)
+      : m_line{std::move(line)}, m_scalar{scalar} {}
+
+  /// @brief subscript operator computing the element at the given position
+  /// @param index position of the element within the line
+  /// @return the element of the line multiplied by the scalar
+  constexpr auto operator[](std::size_t index) const -> T {
+    return m_scalar * m_line[index];
+  }
+
+private:
+  /// @brief the line scaled
+  Line m_line;
+
+  /// @brief the scalar to multiply elements by
+  T m_scalar;
+};
+
+/// @brief evaluator reading the rows and columns of a matrix through its views
+/// @tparam MatrixT type of the matrix, a reference when not owned
+template <typename MatrixT>
+class MatrixEvaluator {
+public:
+  /// @brief constructor of the evaluator from the matrix to read
+  /// @param matrix the matrix, either referenced or moved in
+  constexpr explicit MatrixEvaluator(MatrixT matrix)
+      : m_matrix{std::forward<MatrixT>(matrix)} {}
+
+  /// @brief method to get the row of the given index
+  /// @param index index of the row
+  /// @return view over the row
+  constexpr auto row(std::size_t index) const {
+    return m_matrix.rowView(index);
+  }
+
+  /// @brief method to get the column of the given index
+  /// @param index index of the column
+  /// @return view over the column
+  constexpr auto column(std::size_t index) const {
+    return m_matrix.columnView(index);
+  }
+
+private:
+  /// @brief the matrix read
+  MatrixT m_matrix;
+};
+
+/// @brief evaluator of an element-wise operation over two evaluators
+/// @tparam FirstEvaluator evaluator of the first operand
+/// @tparam SecondEvaluator evaluator of the second operand
+/// @tparam Operation element-wise operation, e.g. std::plus<>
+template <typename FirstEvaluator, typename SecondEvaluator, typename Operation>
+class ElementwiseEvaluator {
+public:
+  /// @brief constructor of the evaluator from those of both operands
+  /// @param first evaluator of the first operand
+  /// @param second evaluator of the second operand
+  constexpr ElementwiseEvaluator(FirstEvaluator first, SecondEvaluator second)
+      : m_first{std::move(first)}, m_second{std::move(second)} {}
+
+  /// @brief method to get the row of the given index
+  /// @param index index of the row
+  /// @return line computing the elements of the row on access
+  constexpr auto row(std::size_t index) const {
+    return ElementwiseLine<decltype(m_first.row(index)),
+                           decltype(m_second.row(index)), Operation>{
+        m_first.row(index), m_second.row(index)};
+  }
+
+  /// @brief method to get the column of the given index
+  /// @param index index of the column
+  /// @return line computing the elements of the column on access
+  constexpr auto column(std::size_t index) const {
+    return ElementwiseLine<decltype(m_first.column(index)),
+                           decltype(m_second.column(index)), Operation>{
+        m_first.column(index), m_second.column(index)};
+  }
+
+private:
+  /// @brief evaluator of the first operand
+  FirstEvaluator m_first;
+
+  /// @brief evaluator of the second operand
+  SecondEvaluator m_second;
+};
+
+/// @brief evaluator of an operand scaled by a scalar
+/// @tparam Evaluator evaluator of the operand
+/// @tparam T type of the scalar
+template <typename Evaluator, typename T>
+class ScaledEvaluator {
+public:
+  /// @brief constructor of the evaluator from that of the operand
+  /// @param evaluator evaluator of the operand
+  /// @param scalar the scalar to multiply elements by
+  constexpr ScaledEvaluator(Evaluator evaluator, T scalar)
+      : m_evaluator{std::move(evaluator)}, m_scalar{scalar} {}
+
+  /// @brief method to get the row of the given index
+  /// @param index index of the row
+  /// @return line computing the elements of the row on access
+  constexpr auto row(std::size_t index) const {
+    return ScaledLine{m_evaluator.row(index), m_scalar};
+  }
+
+  /// @brief method to get the column of the given index
+  /// @param index index of the column
+  /// @return line computing the elements of the column on access
+  constexpr auto column(std::size_t index) const {
+    return ScaledLine{m_evaluator.column(index), m_scalar};
+  }
+
+private:
+  /// @brief evaluator of the operand
+  Evaluator m_evaluator;
+
+  /// @brief the scalar to multiply elements by
+  T m_scalar;
+};
+
+/// @brief evaluator of a transposed operand, swapping its rows and columns
+/// @tparam Evaluator evaluator of the operand
+template <typename Evaluator>
+class TransposedEvaluator {
+public:
+  /// @brief constructor of the evaluator from that of the operand
+  /// @param evaluator evaluator of the operand
+  constexpr explicit TransposedEvaluator(Evaluator evaluator)
+      : m_evaluator{std::move(evaluator)} {}
+
+  /// @brief method to get the row of the given index
+  /// @param index index of the row
+  /// @return the column of the same index of the operand
+  constexpr auto row(std::size_t index) const {
+    return m_evaluator.column(index);
+  }
+
+  /// @brief method to get the column of the given index
+  /// @param index index of the column
+  /// @return the row of the same index of the operand
+  constexpr auto column(std::size_t index) const {
+    return m_evaluator.row(index);
+  }
+
+private:
+  /// @brief evaluator of the operand
+  Evaluator m_evaluator;
+};
+
+/// @brief function to evaluate an element-wise expression in a single pass,
+///        row by row, into a dense matrix of its dimensions
+/// @param expression the expression to evaluate
+/// @param result the matrix written, having rowData(index)
+void evaluateDenseInto(const auto& expression, auto& result) {
+  const auto evaluator{expression.evaluator()};
+  const auto rows{numberOfRows(expression)};
+  const auto columns{numberOfColumns(expression)};
+
+  for (std::size_t rowIndex{0U}; rowIndex < rows; ++rowIndex) {
+    const auto line{evaluator.row(rowIndex)};
+    auto* const resultRow{result.rowData(rowIndex)};
+    for (std::size_t columnIndex{0U}; columnIndex < columns; ++columnIndex) {
+      resultRow[columnIndex] = line[columnIndex];
+    }
+  }
+}
+
+/// @brief function to evaluate an element-wise expression in a single pass,
+///        row by row, into a dense matrix
+/// @param expression the expression to evaluate
+/// @return NormalMatrix if the dimensions of the expression are known at
+///         compile time, DynamicMatrix otherwise
+auto evaluateDense(const auto& expression) {
+  using ExpressionType = std::remove_cvref_t<decltype(expression)>;
+  using value_type = ExpressionType::value_type;
+
+  if constexpr (StaticallySizedExpression<ExpressionType>) {
+    using Dimensions = decltype(expression.dimensions());
+    NormalMatrix<Dimensions::kRows, Dimensions::kColumns, value_type> result{};
+    evaluateDenseInto(expression, result);
+
+    return result;
+  } else {
+    DynamicMatrix<value_type> result(numberOfRows(expression),
+                                     numberOfColumns(expression));
+    evaluateDenseInto(expression, result);
+
+    return result;
+  }
+}
+
+/// @brief function to combine an element-wise expression in a single pass,
+///        row by row, into a dense matrix in place, e.g. to add it without
+///        evaluating it first
+/// @tparam Operation element-wise operation, e.g. std::plus<>
+/// @param matrix the matrix combined into, having rowData(index)
+/// @param expression the expression, whose elements read only those at the
+///        same position of the matrices it refers to, see kIsElementwiseV
+/// @param operation name of the operation, used in error messages
+/// @throw std::invalid_argument if dimensions are not the same
+template <typename Operation>
+void combineDense(auto& matrix, const auto& expression,
+                  const char* operation) {
+  using MatrixType = std::remove_cvref_t<decltype(matrix)>;
+  using ExpressionType = std::remove_cvref_t<decltype(expression)>;
+
+  static_assert(std::is_same_v<typename ExpressionType::value_type,
+                               typename MatrixType::value_type>,
+                "Element types are not the same");
+
+  if constexpr (StaticallySized<MatrixType> &&
+                StaticallySizedExpression<ExpressionType>) {
+    using Dimensions = decltype(expression.dimensions());
+    static_assert(MatrixType::dimensions().kRows == Dimensions::kRows &&
+                      MatrixType::dimensions().kColumns == Dimensions::kColumns,
+                  "Dimensions are not the same");
+  } else {
+    checkSameDimensions(matrix, expression, operation);
+  }
+
+  // each element is read before it is written, so the expression may refer
+  // to the matrix itself
+  const auto evaluator{expression.evaluator()};
+  const auto rows{numberOfRows(matrix)};
+  const auto columns{numberOfColumns(matrix)};
+  for (std::size_t rowIndex{0U}; rowIndex < rows; ++rowIndex) {
+    const auto line{evaluator.row(rowIndex)};
+    auto* const resultRow{matrix.rowData(rowIndex)};
+    for (std::size_t columnIndex{0U}; columnIndex < columns; ++columnIndex) {
+      resultRow[columnIndex] =
+          Operation{}(resultRow[columnIndex], line[columnIndex]);
+    }
+  }
+}
+
+/// @brief struct to represent the cheapest order of evaluation of a chain of
+///        matrices products
+/// @tparam N number of matrices of the chain
+template <std::size_t N>
+struct ChainOrder {
+  /// @brief for each sub-chain [i, j], the index k of the last matrix of its
+  ///        first half, i.e. it is evaluated as [i, k] * [k + 1, j]
+  std::array<std::array<std::size_t, N>, N> splits{};
+
+  /// @brief number of multiply-adds of the whole chain in that order
+  std::size_t multiplyAdds{0U};
+};
+
+/// @brief function running the classic matrix-chain dynamic programming at
+///        compile time
+/// @tparam N number of matrices of the chain
+/// @param dimensions number of rows of each matrix of the chain followed by
+///        the number of columns of the last one
+/// @return the cheapest order of evaluation of the chain
+template <std::size_t N>
+consteval auto optimalChainOrder(
+    const std::array<std::size_t, N + 1U>& dimensions) {
+  ChainOrder<N> order{};
+  std::array<std::array<std::size_t, N>, N> costs{};
+
+  for (std::size_t length{2U}; length <= N; ++length) {
+    for (std::size_t first{0U}; first + length <= N; ++first) {
+      const auto last{first + length - 1U};
+      costs[first][last] = std::numeric_limits<std::size_t>::max();
+
+      for (std::size_t split{first}; split < last; ++split) {
+        const auto cost{costs[first][split] + costs[split + 1U][last] +
+                        (dimensions[first] * dimensions[split + 1U] *
+                         dimensions[last + 1U])};
+        if (cost < costs[first][last]) {
+          costs[first][last] = cost;
+          order.splits[first][last] = split;
+        }
+      }
+    }
+  }
+
+  order.multiplyAdds = costs[0U][N - 1U];
+  return order;
+}
+
+}  // namespace matrix_common
+
+/// @brief leaf of an expression, referring to a matrix, or owning it when
+///        built from a temporary
+/// @tparam MatrixT type of the matrix
+/// @note like a view of std::ranges, a leaf referring to a matrix does not
+///       extend its lifetime, the matrix must outlive every expression built
+///       over it
+template <MatrixAdtConcept MatrixT>
+class TerminalExpression {
+public:
+  /// @brief type alias for the type of the elements
+  using value_type = MatrixT::value_type;
+
+  /// @brief constructor of a leaf referring to a matrix outliving it
+  /// @param matrix the matrix referred to
+  constexpr explicit TerminalExpression(const MatrixT& matrix) noexcept
+      : m_matrix{&matrix} {}
+
+  /// @brief deleted constructor of a leaf referring to a temporary, which
+  ///        would be destroyed before the leaf
+  explicit TerminalExpression(const MatrixT&&) = delete;
+
+  /// @brief constructor of a leaf taking the ownership of a matrix
+  /// @param matrix the matrix owned
+  /// @throw std::bad_alloc if the shared ownership cannot be allocated
+  explicit TerminalExpression(std::unique_ptr<MatrixT>&& matrix)
+      : m_matrix{matrix.get()}, m_owner{std::move(matrix)} {}
+
+  /// @brief method to return the dimensions of the matrix
+  /// @return the dimensions of the matrix referred to
+  constexpr auto dimensions() const noexcept { return m_matrix->dimensions(); }
+
+  /// @brief method to get the matrix referred to, without any copy
+  /// @return reference to the matrix
+  constexpr auto materialize() const noexcept -> const MatrixT& {
+    return *m_matrix;
+  }
+
+  /// @brief method to display the result of the expression
+  /// @return stringified format of the result
+  [[nodiscard]] auto display() const -> std::string {
+    return materialize().display();
+  }
+
+  /// @brief method to get the evaluator reading the matrix
+  /// @return evaluator referring to the matrix
+  constexpr auto evaluator() const noexcept {
+    return matrix_common::MatrixEvaluator<const MatrixT&>{*m_matrix};
+  }
+
+private:
+  /// @brief the matrix referred to
+  const MatrixT* m_matrix;
+
+  /// @brief the matrix when owned, shared between copies of the leaf
+  std::shared_ptr<const MatrixT> m_owner;
+};
+
+/// @brief expression of an element-wise operation between two expressions
+///        of the same dimensions, e.g. addition and subtraction
+/// @tparam First type of the first operand
+/// @tparam Second type of the second operand
+/// @tparam Operation element-wise operation, e.g. std::plus<>
+template <typename First, typename Second, typename Operation>
+class ElementwiseExpression {
+public:
+  /// @brief type alias for the type of the elements
+  using value_type = First::value_type;
+
+  static_assert(std::is_same_v<typename Second::value_type, value_type>,
+                "Element types are not the same");
+
+  /// @brief constructor of the expression from both operands
+  /// @param first first operand
+  /// @param second second operand
+  /// @param operation name of the operation, used in error messages
+  /// @throw std::invalid_argument if dimensions are not the same
+  constexpr ElementwiseExpression(First first, Second second,
+                                  const char* operation)
+      : m_first{std::move(first)}, m_second{std::move(second)} {
+    if constexpr (matrix_common::StaticallySizedExpression<First> &&
+                  matrix_common::StaticallySizedExpression<Second>) {
+      static_assert(
+          decltype(m_first.dimensions())::kRows ==
+              decltype(m_second.dimensions())::kRows &&
+          decltype(m_first.dimensions())::kColumns ==
+              decltype(m_second.dimensions())::kColumns);
+    } else {
+      matrix_common::checkSameDimensions(m_first, m_second, operation);
+    }
+  }
+
+  /// @brief method to return the dimensions of the result
+  /// @return the dimensions of the result, known at compile time if those
+  ///         of both operands are
+  constexpr auto dimensions() const noexcept {
+    if constexpr (matrix_common::StaticallySizedExpression<First> &&
+                  matrix_common::StaticallySizedExpression<Second>) {
+      return m_first.dimensions();
+    } else {
+      return matrix_common::DynamicDimensions{
+          matrix_common::numberOfRows(m_first),
+          matrix_common::numberOfColumns(m_first)};
+    }
+  }
+
+  /// @brief method to evaluate the expression in a single pass
+  /// @return dense matrix containing the result
+  auto materialize() const { return matrix_common::evaluateDense(*this); }
+
+  /// @brief method to display the result of the expression
+  /// @return stringified format of the result
+  [[nodiscard]] auto display() const -> std::string {
+    return materialize().display();
+  }
+
+  /// @brief method to get the evaluator fusing the whole subtree
+  /// @return evaluator computing elements on access
+  constexpr auto evaluator() const {
+    return matrix_common::ElementwiseEvaluator<decltype(m_first.evaluator()),
+                                               decltype(m_second.evaluator()),
+                                               Operation>{
+        m_first.evaluator(), m_second.evaluator()};
+  }
+
+private:
+  /// @brief first operand
+  First m_first;
+
+  /// @brief second operand
+  Second m_second;
+};
+
+/// @brief expression of an operand multiplied by a scalar
+/// @tparam Operand type of the operand
+template <typename Operand>
+class ScaledExpression {
+public:
+  /// @brief type alias for the type of the elements
+  using value_type = Operand::value_type;
+
+  /// @brief constructor of the expression from the operand and the scalar
+  /// @param operand the operand scaled
+  /// @param scalar the scalar to multiply elements by
+  constexpr ScaledExpression(Operand operand, value_type scalar)
+      : m_operand{std::move(operand)}, m_scalar{scalar} {}
+
+  /// @brief method to return the dimensions of the result
+  /// @return the dimensions of the operand
+  constexpr auto dimensions() const noexcept { return m_operand.dimensions(); }
+
+  /// @brief method to evaluate the expression in a single pass
+  /// @return dense matrix containing the result
+  auto materialize() const { return matrix_common::evaluateDense(*this); }
+
+  /// @brief method to display the result of the expression
+  /// @return stringified format of the result
+  [[nodiscard]] auto display() const -> std::string {
+    return materialize().display();
+  }
+
+  /// @brief method to get the evaluator fusing the whole subtree
+  /// @return evaluator computing elements on access
+  constexpr auto evaluator() const {
+    return matrix_common::ScaledEvaluator{m_operand.evaluator(), m_scalar};
+  }
+
+private:
+  /// @brief the operand scaled
+  Operand m_operand;
+
+  /// @brief the scalar to multiply elements by
+  value_type m_scalar;
+};
+
+/// @brief expression of a transposed operand
+/// @tparam Operand type of the operand
+template <typename Operand>
+class TransposedExpression {
+public:
+  /// @brief type alias for the type of the elements
+  using value_type = Operand::value_type;
+
+  /// @brief constructor of the expression from the operand
+  /// @param operand the operand transposed
+  constexpr explicit TransposedExpression(Operand operand)
+      : m_operand{std::move(operand)} {}
+
+  /// @brief method to return the dimensions of the result
+  /// @return the dimensions of the operand swapped
+  constexpr auto dimensions() const noexcept {
+    if constexpr (matrix_common::StaticallySizedExpression<Operand>) {
+      using Dimensions = decltype(m_operand.dimensions());
+      return matrix_common::MatrixDimensions<Dimensions::kColumns,
+                                             Dimensions::kRows>{};
+    } else {
+      return matrix_common::DynamicDimensions{
+          matrix_common::numberOfColumns(m_operand),
+          matrix_common::numberOfRows(m_operand)};
+    }
+  }
+
+  /// @brief method to evaluate the expression in a single pass
+  /// @return dense matrix containing the result
+  auto materialize() const { return matrix_common::evaluateDense(*this); }
+
+  /// @brief method to display the result of the expression
+  /// @return stringified format of the result
+  [[nodiscard]] auto display() const -> std::string {
+    return materialize().display();
+  }
+
+  /// @brief method to get the evaluator fusing the whole subtree
+  /// @return evaluator reading the operand column by column
+  constexpr auto evaluator() const {
+    return matrix_common::TransposedEvaluator{m_operand.evaluator()};
+  }
+
+private:
+  /// @brief the operand transposed
+  Operand m_operand;
+};
+
+/// @brief expression of the product of two expressions
+/// @tparam First type of the first operand
+/// @tparam Second type of the second operand
+/// @note the product is not element-wise, hence it is computed once by the
+///       multiplication of the matrices types, keeping their structure, and
+///       the enclosing element-wise operations read its result
+template <typename First, typename Second>
+class ProductExpression {
+public:
+  /// @brief type alias for the type of the elements
+  using value_type = First::value_type;
+
+  static_assert(std::is_same_v<typename Second::value_type, value_type>,
+                "Element types are not the same");
+
+  /// @brief constructor of the expression from both operands
+  /// @param first first operand
+  /// @param second second operand
+  /// @throw std::invalid_argument if dimensions are not compatible
+  constexpr ProductExpression(First first, Second second)
+      : m_first{std::move(first)}, m_second{std::move(second)} {
+    if constexpr (matrix_common::StaticallySizedExpression<First> &&
+                  matrix_common::StaticallySizedExpression<Second>) {
+      static_assert(decltype(m_first.dimensions())::kColumns ==
+                    decltype(m_second.dimensions())::kRows);
+    } else if (matrix_common::numberOfColumns(m_first) !=
+               matrix_common::numberOfRows(m_second)) {
+      throw std::invalid_argument(std::format(
+          "Cannot multiply [{}*{}] matrix by [{}*{}] matrix",
+          matrix_common::numberOfRows(m_first),
+          matrix_common::numberOfColumns(m_first),
+          matrix_common::numberOfRows(m_second),
+          matrix_common::numberOfColumns(m_second)));
+    }
+  }
+
+  /// @brief method to return the dimensions of the result
+  /// @return the dimensions of the result, known at compile time if those
+  ///         of both operands are
+  constexpr auto dimensions() const noexcept {
+    if constexpr (matrix_common::StaticallySizedExpression<First> &&
+                  matrix_common::StaticallySizedExpression<Second>) {
+      return matrix_common::MatrixDimensions<
+          decltype(m_first.dimensions())::kRows,
+          decltype(m_second.dimensions())::kColumns>{};
+    } else {
+      return matrix_common::DynamicDimensions{
+          matrix_common::numberOfRows(m_first),
+          matrix_common::numberOfColumns(m_second)};
+    }
+  }
+
+  /// @brief method to evaluate the product, operands that are matrices are
+  ///        multiplied in place, without any copy
+  /// @return the product, of the type the multiplication of both operands
+  ///         results in
+  auto materialize() const {
+    return m_first.materialize() * m_second.materialize();
+  }
+
+  /// @brief method to evaluate the product of dense operands into a dense
+  ///        matrix of its dimensions, e.g. one kept across evaluations, the
+  ///        operands being packed in matrix_common::threadWorkspace()
+  /// @param result the matrix written, having rowData(index)
+  void materializeInto(auto& result) const
+    requires(kHasDenseRowsV<std::remove_cvref_t<
+                 decltype(std::declval<const First&>().materialize())>> &&
+             kHasDenseRowsV<std::remove_cvref_t<
+                 decltype(std::declval<const Second&>().materialize())>>)
+  {
+    matrix_common::multiplyInto(m_first.materialize(), m_second.materialize(),
+                                result,
+                                matrix_common::threadWorkspace<value_type>());
+  }
+
+  /// @brief method to display the result of the expression
+  /// @return stringified format of the result
+  [[nodiscard]] auto display() const -> std::string {
+    return materialize().display();
+  }
+
+  /// @brief method to get the evaluator reading the product, computed once
+  /// @return evaluator owning the product
+  auto evaluator() const {
+    return matrix_common::MatrixEvaluator<decltype(materialize())>{
+        materialize()};
+  }
+
+private:
+  /// @brief first operand
+  First m_first;
+
+  /// @brief second operand
+  Second m_second;
+};
+
+/// @brief derive in a non-intrusive way of the MatrixExpression type
+/// @tparam MatrixT type of the matrix
+template <typename MatrixT>
+class IsMatrixExpression<TerminalExpression<MatrixT>> : public std::true_type {
+};
+
+/// @brief derive in a non-intrusive way of the MatrixExpression type
+/// @tparam First type of the first operand
+/// @tparam Second type of the second operand
+/// @tparam Operation element-wise operation
+template <typename First, typename Second, typename Operation>
+class IsMatrixExpression<ElementwiseExpression<First, Second, Operation>>
+    : public std::true_type {};
+
+/// @brief derive in a non-intrusive way of the MatrixExpression type
+/// @tparam Operand type of the operand
+template <typename Operand>
+class IsMatrixExpression<ScaledExpression<Operand>> : public std::true_type {};
+
+/// @brief derive in a non-intrusive way of the MatrixExpression type
+/// @tparam Operand type of the operand
+template <typename Operand>
+class IsMatrixExpression<TransposedExpression<Operand>>
+    : public std::true_type {};
+
+/// @brief derive in a non-intrusive way of the MatrixExpression type
+/// @tparam First type of the first operand
+/// @tparam Second type of the second operand
+template <typename First, typename Second>
+class IsMatrixExpression<ProductExpression<First, Second>>
+    : public std::true_type {};
+
+/// @brief trait telling whether each element of an expression is computed
+///        from the elements at the same position of the matrices it refers
+///        to, so that it can be combined into one of them in place, i.e.
+///        trees of leaves, element-wise operations and scaling
+/// @tparam T type of the expression
+template <typename T>
+constexpr bool kIsElementwiseV{false};
+
+/// @brief specialization of the trait above for leaves
+/// @tparam MatrixT type of the matrix
+template <typename MatrixT>
+constexpr bool kIsElementwiseV<TerminalExpression<MatrixT>>{true};
+
+/// @brief specialization of the trait above for element-wise operations
+/// @tparam First type of the first operand
+/// @tparam Second type of the second operand
+/// @tparam Operation element-wise operation
+template <typename First, typename Second, typename Operation>
+constexpr bool kIsElementwiseV<ElementwiseExpression<First, Second, Operation>>{
+    kIsElementwiseV<First> && kIsElementwiseV<Second>};
+
+/// @brief specialization of the trait above for scaled operands
+/// @tparam Operand type of the operand
+template <typename Operand>
+constexpr bool kIsElementwiseV<ScaledExpression<Operand>>{
+    kIsElementwiseV<Operand>};
+
+/// @brief function to turn an expression into an operand of another one
+/// @param expression the expression, copied or moved into its parent
+/// @return the expression itself
+/// @note MatrixAdt provides its own overload, found by ADL, referring to
+///       the wrapped matrix, or owning it when the MatrixAdt is a temporary
+constexpr auto toExpression(MatrixExpression auto&& expression) {
+  return std::remove_cvref_t<decltype(expression)>{
+      std::forward<decltype(expression)>(expression)};
+}
+
+/// @brief concept for the types that can be operands of matrix expressions
+template <typename T>
+concept ExpressionOperand =
+    requires(T&& operand) { toExpression(std::forward<T>(operand)); };
+
+/// @brief type alias for the expression an operand is turned into
+/// @tparam T type of the operand
+template <ExpressionOperand T>
+using ExpressionOf = decltype(toExpression(std::declval<T>()));
+
+/// @brief function to evaluate an expression into a matrix
+/// @param expression the expression to evaluate
+/// @return the result, of a matrix type fitting the expression
+[[nodiscard]] auto evaluate(const MatrixExpression auto& expression) {
+  return std::remove_cvref_t<decltype(expression.materialize())>{
+      expression.materialize()};
+}
+
+/// @brief function to evaluate an expression into a dense matrix kept by the
+///        calling thread, e.g. the operand of an in-place product, which must
+///        be whole before the product overwrites what it reads
+/// @param expression the expression to evaluate
+/// @return the matrix a leaf refers to, the result itself when it is not a
+///         DynamicMatrix, e.g. a NormalMatrix on the stack, otherwise a
+///         reference to the DynamicMatrix of the thread holding it, valid
+///         until the next evaluation on the thread
+/// @note the DynamicMatrix keeps its storage across evaluations of as many
+///       elements, products of dense operands being multiplied into it, so
+///       repeated in-place operations allocate nothing
+decltype(auto) materializeBuffered(const MatrixExpression auto& expression) {
+  using ResultType = std::remove_cvref_t<decltype(expression.materialize())>;
+
+  if constexpr (std::is_reference_v<decltype(expression.materialize())> ||
+                !std::is_same_v<ResultType,
+                                DynamicMatrix<typename ResultType::value_type>>) {
+    return expression.materialize();
+  } else {
+    thread_local ResultType buffer;
+    buffer.resize(matrix_common::numberOfRows(expression),
+                  matrix_common::numberOfColumns(expression));
+    if constexpr (requires { expression.materializeInto(buffer); }) {
+      expression.materializeInto(buffer);
+    } else {
+      matrix_common::evaluateDenseInto(expression, buffer);
+    }
+
+    return static_cast<const ResultType&>(buffer);
+  }
+}
+
+/// @brief addition operator building a lazy expression
+/// @param first first operand
+/// @param second second operand
+/// @return expression of the sum of both operands
+/// @throw std::invalid_argument if dimensions are not the same
+/// @note the expression refers to the operands that are lvalues, which must
+///       outlive it, e.g. auto sum{a + b} dangles once a or b is destroyed,
+///       while temporaries are moved into it. Evaluating the expression, by
+///       evaluate() or into a MatrixAdt, gives a result owning its elements
+template <ExpressionOperand First, ExpressionOperand Second>
+constexpr auto operator+(First&& first, Second&& second) {
+  return ElementwiseExpression<ExpressionOf<First>, ExpressionOf<Second>,
+                               std::plus<>>{
+      toExpression(std::forward<First>(first)),
+      toExpression(std::forward<Second>(second)), "add"};
+}
+
+/// @brief subtraction operator building a lazy expression
+/// @param first first operand
+/// @param second second operand
+/// @return expression of the difference of both operands
+/// @throw std::invalid_argument if dimensions are not the same
+/// @note operands are referred to, or owned, as by operator+ above
+template <ExpressionOperand First, ExpressionOperand Second>
+constexpr auto operator-(First&& first, Second&& second) {
+  return ElementwiseExpression<ExpressionOf<First>, ExpressionOf<Second>,
+                               std::minus<>>{
+      toExpression(std::forward<First>(first)),
+      toExpression(std::forward<Second>(second)), "subtract"};
+}
+
+/// @brief multiplication operator building a lazy expression
+/// @param first first operand
+/// @param second second operand
+/// @return expression of the product of both operands
+/// @throw std::invalid_argument if dimensions are not compatible
+/// @note operands are referred to, or owned, as by operator+ above
+template <ExpressionOperand First, ExpressionOperand Second>
+constexpr auto operator*(First&& first, Second&& second) {
+  return ProductExpression<ExpressionOf<First>, ExpressionOf<Second>>{
+      toExpression(std::forward<First>(first)),
+      toExpression(std::forward<Second>(second))};
+}
+
+/// @brief multiplication operator by a scalar building a lazy expression
+/// @param operand the operand scaled
+/// @param scalar the scalar to multiply elements by
+/// @return expression of the operand scaled
+/// @note the operand is referred to, or owned, as by operator+ above
+template <ExpressionOperand Operand, typename Scalar>
+  requires std::is_arithmetic_v<Scalar>
+constexpr auto operator*(Operand&& operand, Scalar scalar) {
+  using ExpressionType = ExpressionOf<Operand>;
+  return ScaledExpression<ExpressionType>{
+      toExpression(std::forward<Operand>(operand)),
+      static_cast<ExpressionType::value_type>(scalar)};
+}
+
+/// @brief multiplication operator by a scalar building a lazy expression
+/// @param scalar the scalar to multiply elements by
+/// @param operand the operand scaled
+/// @return expression of the operand scaled
+template <typename Scalar, ExpressionOperand Operand>
+  requires std::is_arithmetic_v<Scalar>
+constexpr auto operator*(Scalar scalar, Operand&& operand) {
+  return std::forward<Operand>(operand) * scalar;
+}
+
+/// @brief function building a lazy expression of the transpose
+/// @param operand the operand transposed
+/// @return expression of the operand transposed
+/// @note the operand is referred to, or owned, as by operator+ above
+template <ExpressionOperand Operand>
+constexpr auto transpose(Operand&& operand) {
+  return TransposedExpression<ExpressionOf<Operand>>{
+      toExpression(std::forward<Operand>(operand))};
+}
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief function building the product expression of the sub-chain
+///        [FIRST, LAST] in the given order
+/// @tparam FIRST index of the first matrix of the sub-chain
+/// @tparam LAST index of the last matrix of the sub-chain
+/// @tparam ORDER the order of evaluation of the whole chain
+/// @param operands tuple of the expressions of the chain, each one is moved
+///        out exactly once
+/// @return expression of the product of the sub-chain
+template <std::size_t FIRST, std::size_t LAST, auto ORDER>
+constexpr auto chainExpression(auto& operands) {
+  if constexpr (FIRST == LAST) {
+    return std::move(std::get<FIRST>(operands));
+  } else {
+    constexpr auto kSplit{ORDER.splits[FIRST][LAST]};
+    auto first{chainExpression<FIRST, kSplit, ORDER>(operands)};
+    auto second{chainExpression<kSplit + 1U, LAST, ORDER>(operands)};
+    return ProductExpression<decltype(first), decltype(second)>{
+        std::move(first), std::move(second)};
+  }
+}
+
+}  // namespace matrix_common
+
+/// @brief function building the product of a chain of matrices in the
+///        cheapest order, found at compile time from their dimensions
+/// @param operands the matrices of the chain, in the order of the product
+/// @return expression of the product of the chain
+/// @note the cost model counts multiply-adds of dense products, and only
+///       operands whose dimensions are known at compile time are accepted
+template <ExpressionOperand... Operands>
+  requires(sizeof...(Operands) >= 2U &&
+           (matrix_common::StaticallySizedExpression<ExpressionOf<Operands>> &&
+            ...))
+constexpr auto multiplyChain(Operands&&... operands) {
+  constexpr std::array<std::size_t, sizeof...(Operands)> kRows{
+      decltype(std::declval<const ExpressionOf<Operands>&>()
+                   .dimensions())::kRows...};
+  constexpr std::array<std::size_t, sizeof...(Operands)> kColumns{
+      decltype(std::declval<const ExpressionOf<Operands>&>()
+                   .dimensions())::kColumns...};
+
+  constexpr std::array<std::size_t, sizeof...(Operands) + 1U> kDimensions{
+      decltype(std::declval<const ExpressionOf<Operands>&>()
+                   .dimensions())::kRows...,
+      kColumns.back()};
+  static_assert(std::equal(kColumns.begin(), kColumns.end() - 1,
+                           kRows.begin() + 1),
+                "Dimensions of the chain are not compatible");
+
+  constexpr auto kOrder{
+      matrix_common::optimalChainOrder<sizeof...(Operands)>(kDimensions)};
+
+  std::tuple operandsExpressions{
+      toExpression(std::forward<Operands>(operands))...};
+  return matrix_common::chainExpression<0U, sizeof...(Operands) - 1U, kOrder>(
+      operandsExpressions);
+}
+
+}  // namespace data_structures::matrix_types
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+
+#include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
+#include "data-structures/matrix-types/UpperTriangularMatrix.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief definition of the LU factorization with partial pivoting of a
+///        square matrix A, such that P A = L U
+/// @tparam N number of rows and columns of the factorized matrix
+/// @tparam T type of elements of matrix
+template <common::NaturalNumber auto N, typename T>
+struct LuFactorization {
+  /// @brief unit lower triangular factor L, its diagonal of ones included
+  LowerTriangularMatrix<N, T> lower;
+
+  /// @brief upper triangular factor U
+  UpperTriangularMatrix<N, T> upper;
+
+  /// @brief permutation P, row i of P A being row permutation[i] of A
+  std::array<std::size_t, N> permutation;
+
+  /// @brief method to solve the system A x = b, by a forward substitution
+  ///        with L followed by a backward one with U
+  /// @param vector the right-hand side b
+  /// @return the solution x
+  [[nodiscard]] auto solve(const std::array<T, N>& vector) const
+      -> std::array<T, N> {
+    std::array<T, N> permuted;
+    for (std::size_t i{0U}; i < N; ++i) {
+      permuted[i] = vector[permutation[i]];
+    }
+
+    return upper.solve(lower.solve(permuted));
+  }
+};
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief number of columns factorized at once by the blocked LU, the rows
+///        right of them being updated by the multiply-add kernels afterwards
+static constexpr std::size_t kLuPanelWidth{32U};
+
+/// @brief helper function to subtract from rows of a dense matrix the
+///        multiples of other rows of it, by the multipliers stored in the
+///        rows themselves, as done by the updates of the blocked LU
+/// @param factors dense matrix being factorized, with rowData(index)
+/// @param rowBegin first row to update
+/// @param rowEnd past the last row to update
+/// @param pivotBegin first row to subtract multiples of
+/// @param pivotEnd past the last row to subtract multiples of
+/// @param columnBegin first column to update, up to the last one
+/// @note rows among the pivots only subtract the pivots above them
+static void subtractPivotRows(auto& factors, std::size_t rowBegin,
+                              std::size_t rowEnd, std::size_t pivotBegin,
+                              std::size_t pivotEnd, std::size_t columnBegin) {
+  using value_type = std::remove_cvref_t<decltype(factors)>::value_type;
+  constexpr auto kRegisterRows{GemmBlocking::kRegisterRows};
+  const auto columns{numberOfColumns(factors) - columnBegin};
+
+  // kRegisterRows rows share each load of a pivot row, as in the products,
+  // unless the rows are pivots themselves and must be updated one by one
+  auto rowIndex{rowBegin};
+  for (; rowBegin >= pivotEnd && rowIndex + kRegisterRows <= rowEnd;
+       rowIndex += kRegisterRows) {
+    std::array<value_type*, kRegisterRows> rows;
+    for (std::size_t r{0U}; r < kRegisterRows; ++r) {
+      rows[r] = factors.rowData(rowIndex + r);
+    }
+
+    for (auto pivot{pivotBegin}; pivot < pivotEnd; ++pivot) {
+      std::array<value_type, kRegisterRows> multipliers;
+      std::array<value_type*, kRegisterRows> destinations;
+      for (std::size_t r{0U}; r < kRegisterRows; ++r) {
+        multipliers[r] = value_type{} - rows[r][pivot];
+        destinations[r] = rows[r] + columnBegin;
+      }
+
+      simd_kernels::multiplyAdd(multipliers,
+                                factors.rowData(pivot) + columnBegin,
+                                destinations, columns);
+    }
+  }
+
+  for (; rowIndex < rowEnd; ++rowIndex) {
+    auto* const row{factors.rowData(rowIndex)};
+    for (auto pivot{pivotBegin}; pivot < pivotEnd && pivot < rowIndex;
+         ++pivot) {
+      simd_kernels::multiplyAdd(
+          std::array<value_type, 1U>{value_type{} - row[pivot]},
+          factors.rowData(pivot) + columnBegin,
+          std::array<value_type*, 1U>{row + columnBegin}, columns);
+    }
+  }
+}
+
+}  // namespace matrix_common
+
+/// @brief function to factorize a square matrix by LU with partial pivoting,
+///        blocked so that most of the work is done by the multiply-add
+///        kernels on contiguous rows
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix, a floating point type
+/// @param matrix the matrix to be factorized
+/// @return the packed factors L and U, with the row permutation
+/// @throw std::domain_error if the matrix is singular
+template <common::NaturalNumber auto N, std::floating_point T>
+auto luFactorization(const NormalMatrix<N, N, T>& matrix)
+    -> LuFactorization<N, T> {
+  constexpr std::size_t kSize{N};
+  constexpr auto kPanelWidth{matrix_common::kLuPanelWidth};
+
+  // L and U overwrite a copy of the matrix, before being packed apart
+  auto factors{matrix};
+  LuFactorization<N, T> result{};
+  std::iota(result.permutation.begin(), result.permutation.end(), 0U);
+
+  for (std::size_t panelBegin{0U}; panelBegin < kSize;
+       panelBegin += kPanelWidth) {
+    const auto panelEnd{std::min(panelBegin + kPanelWidth, kSize)};
+
+    // unblocked factorization of the panel columns only
+    for (auto k{panelBegin}; k < panelEnd; ++k) {
+      auto pivot{k};
+      for (auto i{k + 1U}; i < kSize; ++i) {
+        if (std::abs(factors.rowData(i)[k]) >
+            std::abs(factors.rowData(pivot)[k])) {
+          pivot = i;
+        }
+      }
+
+      if (factors.rowData(pivot)[k] == T{}) {
+        throw std::domain_error(std::format(
+            "Cannot factorize a singular matrix, column {} has no pivot", k));
+      }
+
+      if (pivot != k) {
+        std::swap_ranges(factors.rowData(k), factors.rowData(k) + kSize,
+                         factors.rowData(pivot));
+        std::swap(result.permutation[k], result.permutation[pivot]);
+      }
+
+      const auto* const pivotRow{factors.rowData(k)};
+      for (auto i{k + 1U}; i < kSize; ++i) {
+        auto* const row{factors.rowData(i)};
+        row[k] /= pivotRow[k];
+        simd_kernels::multiplyAdd(std::array<T, 1U>{T{} - row[k]},
+                                  pivotRow + k + 1U,
+                                  std::array<T*, 1U>{row + k + 1U},
+                                  panelEnd - k - 1U);
+      }
+    }
+
+    // rows of U right of the panel, then the trailing submatrix
+    matrix_common::subtractPivotRows(factors, panelBegin + 1U, panelEnd,
+                                     panelBegin, panelEnd, panelEnd);
+    matrix_common::subtractPivotRows(factors, panelEnd, kSize, panelBegin,
+                                     panelEnd, panelEnd);
+  }
+
+  for (std::size_t i{0U}; i < kSize; ++i) {
+    auto* const lowerRow{result.lower.rowData(i)};
+    std::copy_n(factors.rowData(i), i, lowerRow);
+    lowerRow[i] = T{1};
+
+    std::copy_n(factors.rowData(i) + i, kSize - i, result.upper.rowData(i));
+  }
+
+  return result;
+}
+
+/// @brief function to factorize a symmetric positive-definite matrix by
+///        Cholesky, A = L transpose(L), computed in place in the packed
+///        triangle of L
+/// @tparam MatrixT type of the matrix, square and statically sized, of
+///         floating point elements
+/// @param matrix the matrix to be factorized
+/// @return the packed factor L
+/// @throw std::domain_error if the matrix is not positive-definite
+/// @note only the lower triangle of the matrix is read, the upper one being
+///       assumed symmetric to it
+template <typename MatrixT>
+  requires(matrix_common::StaticallySized<MatrixT> &&
+           std::floating_point<typename MatrixT::value_type> &&
+           MatrixT::dimensions().kRows == MatrixT::dimensions().kColumns)
+auto choleskyFactorization(const MatrixT& matrix) {
+  using T = MatrixT::value_type;
+  constexpr auto kSize{MatrixT::dimensions().kRows};
+
+  LowerTriangularMatrix<kSize, T> factor{matrix};
+  for (std::size_t i{0U}; i < kSize; ++i) {
+    auto* const row{factor.rowData(i)};
+
+    for (std::size_t j{0U}; j <= i; ++j) {
+      const auto* const otherRow{factor.rowData(j)};
+      // both packed rows are contiguous up to the column being computed
+      auto sum{row[j]};
+      for (std::size_t k{0U}; k < j; ++k) {
+        sum -= row[k] * otherRow[k];
+      }
+
+      if (j < i) {
+        row[j] = sum / otherRow[j];
+      } else if (sum > T{}) {
+        row[i] = std::sqrt(sum);
+      } else {
+        throw std::domain_error(std::format(
+            "Cannot factorize a matrix not positive-definite, pivot {} is {}",
+            i, sum));
+      }
+    }
+  }
+
+  return factor;
+}
+
+}  // namespace data_structures::matrix_types
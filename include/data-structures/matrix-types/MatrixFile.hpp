@@ -0,0 +1,669 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixStorage.hpp"
+#include "data-structures/matrix-types/MatrixViews.hpp"
+#include "data-structures/matrix-types/SymmetricMatrix.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief the element types a matrix file can hold, as tagged in its header
+enum class ElementType : std::uint8_t {
+  kInt32,
+  kUInt32,
+  kInt64,
+  kUInt64,
+  kFloat32,
+  kFloat64
+};
+
+/// @brief header at the beginning of a binary matrix file, followed by the
+///        stored elements of the matrix in the native byte order, row by row
+///        as the matrix type of the storage kind packs them: all elements
+///        of a dense matrix, the lower triangle of a lower triangular or a
+///        symmetric one, and the diagonal of a diagonal one
+/// @note the header is a cache line long, so that the elements of a file
+///       mapped at a page boundary are aligned as those of DynamicMatrix
+struct MatrixFileHeader {
+  /// @brief signature of matrix files
+  static constexpr std::array<char, 8U> kMagic{'D', 'S', 'M', 'A',
+                                               'T', 'R', 'I', 'X'};
+
+  /// @brief version of the format written
+  static constexpr std::uint32_t kVersion{1U};
+
+  /// @brief marker read back differently by a machine of the other byte
+  ///        order, whose files are rejected
+  static constexpr std::uint32_t kByteOrderMark{0x01020304U};
+
+  /// @brief signature of the file, kMagic
+  std::array<char, 8U> magic{kMagic};
+
+  /// @brief version of the format the file was written in
+  std::uint32_t version{kVersion};
+
+  /// @brief kByteOrderMark in the byte order of the writer
+  std::uint32_t byteOrderMark{kByteOrderMark};
+
+  /// @brief type of the elements
+  ElementType elementType{};
+
+  /// @brief storage kind, i.e. which elements are stored
+  MatrixStorage storage{};
+
+  /// @brief size in bytes of an element
+  std::uint16_t elementSize{};
+
+  /// @brief reserved, zero
+  std::uint32_t reserved{};
+
+  /// @brief number of rows of the matrix
+  std::uint64_t rows{};
+
+  /// @brief number of columns of the matrix
+  std::uint64_t columns{};
+
+  /// @brief number of elements following the header
+  std::uint64_t storedElements{};
+
+  /// @brief padding up to a cache line, zeros
+  std::array<std::uint64_t, 2U> padding{};
+};
+
+static_assert(sizeof(MatrixFileHeader) == 64U &&
+              std::is_trivially_copyable_v<MatrixFileHeader>);
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief concept of the element types a matrix file can hold
+template <typename T>
+concept FileElement =
+    std::same_as<T, std::int32_t> || std::same_as<T, std::uint32_t> ||
+    std::same_as<T, std::int64_t> || std::same_as<T, std::uint64_t> ||
+    std::same_as<T, float> || std::same_as<T, double>;
+
+/// @brief number of bytes of elements buffered by writeMatrixFile() before
+///        being written at once
+static constexpr std::size_t kFileBlockBytes{std::size_t{1U} << 20U};
+
+/// @brief helper function to tag an element type in the header of a file
+/// @tparam T type of the elements
+/// @return the tag of the element type
+template <FileElement T>
+consteval auto elementTypeOf() noexcept -> ElementType {
+  if constexpr (std::same_as<T, std::int32_t>) {
+    return ElementType::kInt32;
+  } else if constexpr (std::same_as<T, std::uint32_t>) {
+    return ElementType::kUInt32;
+  } else if constexpr (std::same_as<T, std::int64_t>) {
+    return ElementType::kInt64;
+  } else if constexpr (std::same_as<T, std::uint64_t>) {
+    return ElementType::kUInt64;
+  } else if constexpr (std::same_as<T, float>) {
+    return ElementType::kFloat32;
+  } else {
+    return ElementType::kFloat64;
+  }
+}
+
+/// @brief helper function to return the size of the elements of a tagged
+///        type, e.g. to check the element size in the header of a file
+/// @param elementType the tag of the element type
+/// @return size in bytes of an element, zero for a tag of no known type
+static constexpr auto elementSizeOf(ElementType elementType) noexcept
+    -> std::size_t {
+  switch (elementType) {
+    case ElementType::kInt32:
+    case ElementType::kUInt32:
+    case ElementType::kFloat32:
+      return 4U;
+    case ElementType::kInt64:
+    case ElementType::kUInt64:
+    case ElementType::kFloat64:
+      return 8U;
+    default:
+      return 0U;
+  }
+}
+
+/// @brief helper function to pick the storage kind a matrix type is written
+///        in, the one it is stored in itself
+/// @tparam MatrixT type of the matrix
+/// @return diagonal, lower triangular or symmetric storage for the matrix
+///         types of them, dense storage otherwise
+template <typename MatrixT>
+constexpr auto fileStorageOf() noexcept -> MatrixStorage {
+  if constexpr (StaticallySized<MatrixT>) {
+    constexpr auto kSize{MatrixT::dimensions().kRows};
+    using value_type = MatrixT::value_type;
+
+    if constexpr (std::is_same_v<MatrixT, DiagonalMatrix<kSize, value_type>>) {
+      return MatrixStorage::kDiagonal;
+    } else if constexpr (std::is_same_v<MatrixT, LowerTriangularMatrix<
+                                                      kSize, value_type>>) {
+      return MatrixStorage::kLowerTriangular;
+    } else if constexpr (std::is_same_v<MatrixT,
+                                        SymmetricMatrix<kSize, value_type>>) {
+      return MatrixStorage::kSymmetric;
+    } else {
+      return MatrixStorage::kDense;
+    }
+  } else {
+    return MatrixStorage::kDense;
+  }
+}
+
+/// @brief helper function to return the logical indices of the elements of
+///        a row stored by a storage kind
+/// @param storage the storage kind
+/// @param rowIndex index of the row
+/// @param columns number of columns of the matrix
+/// @return first and past the last stored column of the row
+static constexpr auto storedColumns(MatrixStorage storage,
+                                    std::size_t rowIndex,
+                                    std::size_t columns) noexcept
+    -> std::pair<std::size_t, std::size_t> {
+  switch (storage) {
+    case MatrixStorage::kDiagonal:
+      return {rowIndex, rowIndex + 1U};
+    case MatrixStorage::kLowerTriangular:
+    case MatrixStorage::kSymmetric:
+      return {0U, rowIndex + 1U};
+    default:
+      return {0U, columns};
+  }
+}
+
+/// @brief helper function to count the elements stored in a file by a
+///        storage kind
+/// @param storage the storage kind
+/// @param rows number of rows of the matrix
+/// @param columns number of columns of the matrix
+/// @return number of stored elements
+/// @throw std::invalid_argument if the storage kind has no file layout, or
+///        needs a square matrix and the matrix is not, or if the number of
+///        elements does not fit in std::size_t
+static auto fileStoredElements(MatrixStorage storage, std::size_t rows,
+                               std::size_t columns) -> std::size_t {
+  if (storage == MatrixStorage::kDense) {
+    return checkedSizeProduct(rows, columns);
+  }
+
+  if (storage != MatrixStorage::kDiagonal &&
+      storage != MatrixStorage::kLowerTriangular &&
+      storage != MatrixStorage::kSymmetric) {
+    throw std::invalid_argument(
+        std::format("Storage kind {} has no file layout",
+                    static_cast<unsigned>(storage)));
+  }
+
+  if (rows != columns) {
+    throw std::invalid_argument(std::format(
+        "Cannot store a non-square [{}*{}] matrix packed", rows, columns));
+  }
+
+  if (storage == MatrixStorage::kDiagonal) {
+    return rows;
+  }
+
+  // a square that fits bounds rows below 2^32, so the triangle fits too
+  (void)checkedSizeProduct(rows, rows);
+  return numberOfTriangleElements(rows);
+}
+
+}  // namespace matrix_common
+
+/// @brief zero-copy read only view of a matrix stored in a buffer in the
+///        layout of a matrix file, e.g. a file mapped by MappedMatrixFile
+/// @tparam T type of elements of matrix
+/// @tparam STORAGE storage kind of the buffer, dense, lower triangular,
+///         symmetric or diagonal
+/// @note the view must not outlive the buffer it reads from
+template <typename T, MatrixStorage STORAGE>
+class MatrixFileView {
+public:
+  /// @brief type alias for T, as for standard containers
+  using value_type = T;
+
+  /// @brief constructor of a view
+  /// @param data pointer to the first stored element
+  /// @param rows number of rows of the matrix
+  /// @param columns number of columns of the matrix
+  constexpr MatrixFileView(const T* data, std::size_t rows,
+                           std::size_t columns) noexcept
+      : m_data{data}, m_rows{rows}, m_columns{columns} {}
+
+  /// @brief a method to return the [n*m] dimensions of the matrix
+  /// @return a DynamicDimensions object representing [n*m] dimensions
+  [[nodiscard]] constexpr auto dimensions() const noexcept {
+    return matrix_common::DynamicDimensions{m_rows, m_columns};
+  }
+
+  /// @brief method to return pointer to the first element of a row of a
+  ///        dense matrix
+  /// @param index index of the row
+  /// @return pointer to the first element of the row at the given index
+  /// @note no range checking is done here
+  [[nodiscard]] constexpr auto rowData(std::size_t index) const noexcept
+      -> const T*
+    requires(STORAGE == MatrixStorage::kDense)
+  {
+    return m_data + (index * m_columns);
+  }
+
+  /// @brief method to return a view of the row at a given index, reading
+  ///        directly from the buffer
+  /// @param index at which row should be viewed
+  /// @return view of the row, zeros included
+  /// @note no range checking is done here
+  [[nodiscard]] constexpr auto rowView(std::size_t index) const noexcept {
+    if constexpr (STORAGE == MatrixStorage::kSymmetric) {
+      return LineView<T, PackedSymmetricMapping>{
+          m_data + matrix_common::numberOfTriangleElements(index),
+          m_columns,
+          {0U, m_columns, index}};
+    } else if constexpr (STORAGE == MatrixStorage::kLowerTriangular) {
+      return LineView<T>{
+          m_data + matrix_common::numberOfTriangleElements(index), m_columns,
+          {0U, index + 1U, 1U}};
+    } else if constexpr (STORAGE == MatrixStorage::kDiagonal) {
+      return LineView<T>{m_data + index, m_columns, {index, index + 1U, 1U}};
+    } else {
+      return LineView<T>{rowData(index), m_columns, {0U, m_columns, 1U}};
+    }
+  }
+
+  /// @brief method to return a view of the column at a given index, reading
+  ///        directly from the buffer
+  /// @param index at which column should be viewed
+  /// @return view of the column, zeros included
+  /// @note no range checking is done here
+  [[nodiscard]] constexpr auto columnView(std::size_t index) const noexcept {
+    if constexpr (STORAGE == MatrixStorage::kLowerTriangular) {
+      return LineView<T, PackedLowerColumnMapping>{
+          m_data + matrix_common::numberOfTriangleElements(index) + index,
+          m_rows, {index, m_rows}};
+    } else if constexpr (STORAGE == MatrixStorage::kDense) {
+      return LineView<T>{m_data + index, m_rows, {0U, m_rows, m_columns}};
+    } else {
+      // by definition of both, rows and columns are the same
+      return rowView(index);
+    }
+  }
+
+  /// @brief method that returns RowsIterator to traverse through each row
+  /// @return RowsIterator object pointing to first row, yielding views
+  [[nodiscard]] constexpr auto rows() const noexcept {
+    return matrix_common::RowsIterator<MatrixFileView>(*this);
+  }
+
+  /// @brief method that returns ColumnsIterator to traverse through
+  ///        each column
+  /// @return ColumnsIterator object pointing to first column, yielding views
+  [[nodiscard]] constexpr auto columns() const noexcept {
+    return matrix_common::ColumnsIterator<MatrixFileView>(*this);
+  }
+
+private:
+  /// @brief pointer to the first stored element
+  const T* m_data;
+
+  /// @brief number of rows of the matrix
+  std::size_t m_rows;
+
+  /// @brief number of columns of the matrix
+  std::size_t m_columns;
+};
+
+/// @brief definition of a read only matrix file mapped in memory, whose
+///        elements are read in place by the views it returns
+/// @note pages of the file are only loaded on first access, so opening a
+///       large file is cheap, and those of files mapped by several processes
+///       are shared between them
+class MappedMatrixFile {
+public:
+  /// @brief constructor mapping a matrix file
+  /// @param path path of the file
+  /// @throw std::system_error if the file cannot be opened or mapped
+  /// @throw std::runtime_error if the file is not a valid matrix file
+  explicit MappedMatrixFile(const std::filesystem::path& path) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    const int descriptor{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (descriptor < 0) {
+      throw std::system_error(errno, std::generic_category(),
+                              std::format("Cannot open {}", path.string()));
+    }
+
+    struct stat status{};
+    if (::fstat(descriptor, &status) != 0) {
+      const auto error{errno};
+      ::close(descriptor);
+      throw std::system_error(error, std::generic_category(),
+                              std::format("Cannot stat {}", path.string()));
+    }
+
+    m_size = static_cast<std::size_t>(status.st_size);
+    if (m_size < sizeof(MatrixFileHeader)) {
+      ::close(descriptor);
+      throw std::runtime_error(std::format(
+          "{} is too short to be a matrix file", path.string()));
+    }
+
+    void* const mapping{
+        ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, descriptor, 0)};
+    const auto error{errno};
+    ::close(descriptor);  // the mapping keeps the file open
+    if (mapping == MAP_FAILED) {
+      throw std::system_error(error, std::generic_category(),
+                              std::format("Cannot map {}", path.string()));
+    }
+    m_data = static_cast<const std::byte*>(mapping);
+
+    std::array<std::byte, sizeof(MatrixFileHeader)> headerBytes;
+    std::copy_n(m_data, headerBytes.size(), headerBytes.begin());
+    m_header = std::bit_cast<MatrixFileHeader>(headerBytes);
+
+    try {
+      validate(path);
+    } catch (...) {
+      unmap();
+      throw;
+    }
+  }
+
+  /// @brief destructor unmapping the file
+  ~MappedMatrixFile() { unmap(); }
+
+  MappedMatrixFile(const MappedMatrixFile&) = delete;
+  auto operator=(const MappedMatrixFile&) -> MappedMatrixFile& = delete;
+
+  /// @brief move constructor, taking over the mapping of the other file
+  /// @param other the file moved from, left unmapped
+  MappedMatrixFile(MappedMatrixFile&& other) noexcept
+      : m_data{std::exchange(other.m_data, nullptr)},
+        m_size{std::exchange(other.m_size, 0U)},
+        m_header{other.m_header} {}
+
+  /// @brief move assignment operator, taking over the mapping of the other
+  ///        file after unmapping this one
+  /// @param other the file moved from, left unmapped
+  /// @return reference to this file
+  auto operator=(MappedMatrixFile&& other) noexcept -> MappedMatrixFile& {
+    if (this != &other) {
+      unmap();
+      m_data = std::exchange(other.m_data, nullptr);
+      m_size = std::exchange(other.m_size, 0U);
+      m_header = other.m_header;
+    }
+
+    return *this;
+  }
+
+  /// @brief method to return the header of the file
+  /// @return the header, telling the matrix type to view the file as
+  [[nodiscard]] auto header() const noexcept -> const MatrixFileHeader& {
+    return m_header;
+  }
+
+  /// @brief method to view the matrix stored in the file without copying it
+  /// @tparam T type of elements of matrix
+  /// @tparam STORAGE storage kind of the file
+  /// @return view reading the elements in place, e.g. to be converted to a
+  ///         DynamicMatrix or multiplied by another matrix
+  /// @throw std::invalid_argument if the file holds another element type or
+  ///        another storage kind
+  /// @note the view must not outlive the file
+  template <matrix_common::FileElement T, MatrixStorage STORAGE>
+  [[nodiscard]] auto view() const -> MatrixFileView<T, STORAGE> {
+    if (m_header.elementType != matrix_common::elementTypeOf<T>() ||
+        m_header.storage != STORAGE) {
+      throw std::invalid_argument(std::format(
+          "Cannot view a matrix file of element type {} and storage {} as "
+          "element type {} and storage {}",
+          static_cast<unsigned>(m_header.elementType),
+          static_cast<unsigned>(m_header.storage),
+          static_cast<unsigned>(matrix_common::elementTypeOf<T>()),
+          static_cast<unsigned>(STORAGE)));
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return {reinterpret_cast<const T*>(m_data + sizeof(MatrixFileHeader)),
+            m_header.rows, m_header.columns};
+  }
+
+private:
+  /// @brief pointer to the first byte of the mapping
+  const std::byte* m_data{nullptr};
+
+  /// @brief size in bytes of the mapping
+  std::size_t m_size{0U};
+
+  /// @brief copy of the header of the file
+  MatrixFileHeader m_header{};
+
+  /// @brief method to check the header against the size of the file
+  /// @param path path of the file, for the messages
+  /// @throw std::runtime_error if the file is not a valid matrix file
+  void validate(const std::filesystem::path& path) const {
+    if (m_header.magic != MatrixFileHeader::kMagic) {
+      throw std::runtime_error(
+          std::format("{} is not a matrix file", path.string()));
+    }
+
+    if (m_header.version != MatrixFileHeader::kVersion ||
+        m_header.byteOrderMark != MatrixFileHeader::kByteOrderMark) {
+      throw std::runtime_error(std::format(
+          "{} is a matrix file of another version or byte order",
+          path.string()));
+    }
+
+    // a tag of no known type has no size, which a corrupted element size of
+    // zero would match otherwise
+    const auto elementSize{matrix_common::elementSizeOf(m_header.elementType)};
+    if (elementSize == 0U) {
+      throw std::runtime_error(
+          std::format("{} holds elements of unknown type {}", path.string(),
+                      static_cast<unsigned>(m_header.elementType)));
+    }
+
+    if (m_header.elementSize != elementSize) {
+      throw std::runtime_error(std::format(
+          "{} holds elements of {} bytes, not of the size of element type {}",
+          path.string(), m_header.elementSize,
+          static_cast<unsigned>(m_header.elementType)));
+    }
+
+    // sizes of the header are not trusted until checked against the file
+    std::size_t storedElements{0U};
+    std::size_t storedBytes{0U};
+    try {
+      storedElements = matrix_common::fileStoredElements(
+          m_header.storage, m_header.rows, m_header.columns);
+      storedBytes = matrix_common::checkedSizeProduct(storedElements,
+                                                      m_header.elementSize);
+    } catch (const std::invalid_argument& exception) {
+      throw std::runtime_error(
+          std::format("{}: {}", path.string(), exception.what()));
+    }
+
+    if (m_header.storedElements != storedElements ||
+        m_size - sizeof(MatrixFileHeader) != storedBytes) {
+      throw std::runtime_error(std::format(
+          "{} holds {} bytes of elements, not the {} elements of its header",
+          path.string(), m_size - sizeof(MatrixFileHeader), storedElements));
+    }
+  }
+
+  /// @brief method to unmap the file, if mapped
+  void unmap() noexcept {
+    if (m_data != nullptr) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      ::munmap(const_cast<std::byte*>(m_data), m_size);
+      m_data = nullptr;
+    }
+  }
+};
+
+/// @brief definition of a writer of a matrix file, streaming the stored
+///        elements of the matrix in as many blocks as needed, e.g. a few rows
+///        at a time of a matrix too large to be held in memory
+/// @tparam T type of elements of matrix
+template <matrix_common::FileElement T>
+class MatrixFileWriter {
+public:
+  /// @brief constructor creating the file and writing its header
+  /// @param path path of the file, overwritten if it exists
+  /// @param storage storage kind, dense, lower triangular, symmetric or
+  ///        diagonal
+  /// @param rows number of rows of the matrix
+  /// @param columns number of columns of the matrix
+  /// @throw std::invalid_argument if the storage kind has no file layout, or
+  ///        needs a square matrix and the matrix is not
+  /// @throw std::runtime_error if the file cannot be written
+  MatrixFileWriter(const std::filesystem::path& path, MatrixStorage storage,
+                   std::size_t rows, std::size_t columns)
+      : m_path{path.string()},
+        m_remaining{matrix_common::fileStoredElements(storage, rows, columns)},
+        m_stream{path, std::ios::binary | std::ios::trunc} {
+    const MatrixFileHeader header{.elementType =
+                                      matrix_common::elementTypeOf<T>(),
+                                  .storage = storage,
+                                  .elementSize = sizeof(T),
+                                  .rows = rows,
+                                  .columns = columns,
+                                  .storedElements = m_remaining};
+    const auto headerBytes{
+        std::bit_cast<std::array<char, sizeof(MatrixFileHeader)>>(header)};
+    m_stream.write(headerBytes.data(), headerBytes.size());
+    checkStream();
+  }
+
+  /// @brief method to append stored elements to the file
+  /// @param elements the next elements, in the order of the file layout
+  /// @return reference to this writer
+  /// @throw std::length_error if more elements than stored are written
+  /// @throw std::runtime_error if the file cannot be written
+  auto write(std::span<const T> elements) -> MatrixFileWriter& {
+    if (elements.size() > m_remaining) {
+      throw std::length_error(std::format(
+          "Cannot write {} elements to {}, only {} remaining", elements.size(),
+          m_path, m_remaining));
+    }
+
+    m_stream.write(
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        reinterpret_cast<const char*>(elements.data()),
+        static_cast<std::streamsize>(elements.size_bytes()));
+    checkStream();
+    m_remaining -= elements.size();
+
+    return *this;
+  }
+
+  /// @brief method to show the number of elements still to be written
+  /// @return number of elements still to be written
+  [[nodiscard]] auto remaining() const noexcept { return m_remaining; }
+
+  /// @brief method to flush and close the file once all its elements are
+  ///        written
+  /// @throw std::length_error if elements are still to be written
+  /// @throw std::runtime_error if the file cannot be written
+  void close() {
+    if (m_remaining != 0U) {
+      throw std::length_error(std::format(
+          "Cannot close {}, {} elements are still to be written", m_path,
+          m_remaining));
+    }
+
+    m_stream.close();
+    checkStream();
+  }
+
+private:
+  /// @brief path of the file, for the messages
+  std::string m_path;
+
+  /// @brief number of elements still to be written
+  std::size_t m_remaining;
+
+  /// @brief the stream the file is written through
+  std::ofstream m_stream;
+
+  /// @brief method to check the last operation on the stream
+  /// @throw std::runtime_error if it failed
+  void checkStream() const {
+    if (!m_stream) {
+      throw std::runtime_error(std::format("Cannot write to {}", m_path));
+    }
+  }
+};
+
+/// @brief function to write a matrix to a file, in the storage kind of its
+///        type, streaming blocks of rows so that no copy of the whole matrix
+///        is made
+/// @param path path of the file, overwritten if it exists
+/// @param matrix the matrix to be written, of any matrix type
+/// @param storage storage kind of the file, the one of the type of the
+///        matrix by default, any elements it does not store being dropped
+/// @throw std::invalid_argument if the storage kind has no file layout, or
+///        needs a square matrix and the matrix is not
+/// @throw std::runtime_error if the file cannot be written
+template <typename MatrixT>
+void writeMatrixFile(
+    const std::filesystem::path& path, const MatrixT& matrix,
+    MatrixStorage storage = matrix_common::fileStorageOf<MatrixT>()) {
+  using value_type = MatrixT::value_type;
+  const auto rows{matrix_common::numberOfRows(matrix)};
+  const auto columns{matrix_common::numberOfColumns(matrix)};
+
+  MatrixFileWriter<value_type> writer{path, storage, rows, columns};
+
+  constexpr auto kBlockElements{matrix_common::kFileBlockBytes /
+                                sizeof(value_type)};
+  std::vector<value_type> block;
+  block.reserve(kBlockElements + columns);
+  for (std::size_t rowIndex{0U}; rowIndex < rows; ++rowIndex) {
+    const auto [first, last]{
+        matrix_common::storedColumns(storage, rowIndex, columns)};
+    matrix.rowView(rowIndex).copyTo(first, last, std::back_inserter(block));
+
+    if (block.size() >= kBlockElements) {
+      writer.write(block);
+      block.clear();
+    }
+  }
+
+  writer.write(block);
+  writer.close();
+}
+
+}  // namespace data_structures::matrix_types
@@ -0,0 +1,326 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdio>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief number of bytes printMatrix() and dumpMatrix() gather before
+///        writing them out at once
+static constexpr std::size_t kFormatBlockBytes{std::size_t{1U} << 16U};
+
+/// @brief number of decimals of floating elements, as std::to_string() has
+static constexpr int kFormatPrecision{6};
+
+/// @brief helper function to write the text of an element, the way
+///        std::to_string() does, without any allocation
+/// @param out output iterator to write the text to
+/// @param element the element in question
+/// @return the output iterator past the text
+template <typename T>
+static auto formatElementTo(auto out, const T& element) {
+  if constexpr (std::floating_point<T>) {
+    // integral part of the largest element, its sign, point and decimals
+    std::array<char, std::numeric_limits<T>::max_exponent10 +
+                         kFormatPrecision + 3>
+        buffer;
+    const auto [last, error]{std::to_chars(buffer.data(),
+                                           buffer.data() + buffer.size(),
+                                           element, std::chars_format::fixed,
+                                           kFormatPrecision)};
+    return std::copy(buffer.data(), last, out);
+  } else if constexpr (HalfPrecision<T>) {
+    return formatElementTo(out, static_cast<float>(element));
+  } else if constexpr (std::integral<T> && !std::same_as<T, bool>) {
+    std::array<char, std::numeric_limits<T>::digits10 + 3> buffer;
+    const auto [last, error]{
+        std::to_chars(buffer.data(), buffer.data() + buffer.size(), element)};
+    return std::copy(buffer.data(), last, out);
+  } else {
+    return std::format_to(out, "{}", element);
+  }
+}
+
+/// @brief helper function to call a function on every row of a matrix, as a
+///        contiguous array of all of its elements, zeros included
+/// @param matrix the matrix in question
+/// @param function function called with the index and the elements of each
+///        row, in order
+/// @note rows of dense matrices are passed in place, the others are copied
+///       into a single buffer reused by all rows
+static void forEachContiguousRow(const auto& matrix, auto&& function) {
+  using MatrixT = std::remove_cvref_t<decltype(matrix)>;
+
+  const auto rows{numberOfRows(matrix)};
+  if constexpr (kHasDenseRowsV<MatrixT>) {
+    for (std::size_t i{0U}; i < rows; ++i) {
+      function(i, matrix.rowData(i));
+    }
+  } else {
+    std::vector<typename MatrixT::value_type> row(numberOfColumns(matrix));
+    for (std::size_t i{0U}; i < rows; ++i) {
+      matrix.rowView(i).copyTo(row.begin());
+      function(i, std::as_const(row).data());
+    }
+  }
+}
+
+/// @brief helper function to write the text of a row of a matrix
+/// @param out output iterator to write the text to
+/// @param row the elements of the row
+/// @param columns number of elements of the row
+/// @return the output iterator past the text
+template <typename T>
+static auto formatRowTo(auto out, const T* row, std::size_t columns) {
+  *out++ = '|';
+  for (std::size_t j{0U}; j < columns; ++j) {
+    if (j != 0U) {
+      *out++ = ' ';
+    }
+    out = formatElementTo(out, row[j]);
+  }
+  *out++ = '|';
+
+  return out;
+}
+
+/// @brief helper function to write the text of a matrix, as display() shows
+///        it, straight to an output iterator
+/// @param out output iterator to write the text to
+/// @param matrix the matrix in question
+/// @return the output iterator past the text
+static auto formatRowsTo(auto out, const auto& matrix) {
+  const auto columns{numberOfColumns(matrix)};
+  forEachContiguousRow(matrix, [&out, columns](std::size_t rowIndex,
+                                               const auto* row) {
+    if (rowIndex != 0U) {
+      *out++ = '\n';
+    }
+    out = formatRowTo(out, row, columns);
+  });
+
+  return out;
+}
+
+/// @brief helper function to write the text of a matrix, as display() shows
+///        it, in blocks of about kFormatBlockBytes
+/// @param matrix the matrix in question
+/// @param write function called with each block of text, a std::string_view
+static void formatMatrixBlocks(const auto& matrix, auto&& write) {
+  const auto columns{numberOfColumns(matrix)};
+
+  std::string block;
+  block.reserve(kFormatBlockBytes);
+  forEachContiguousRow(matrix, [&](std::size_t rowIndex, const auto* row) {
+    if (rowIndex != 0U) {
+      block.push_back('\n');
+    }
+    formatRowTo(std::back_inserter(block), row, columns);
+
+    if (block.size() >= kFormatBlockBytes) {
+      write(std::string_view{block});
+      block.clear();
+    }
+  });
+
+  if (!block.empty()) {
+    write(std::string_view{block});
+  }
+}
+
+/// @brief helper function to write the bytes of all elements of a matrix,
+///        row after row, in blocks of about kFormatBlockBytes
+/// @param matrix the matrix in question
+/// @param write function called with each block of bytes, a std::string_view
+/// @note dense matrices whose rows follow each other in memory are written
+///       in a single block, straight from their storage
+static void dumpMatrixBlocks(const auto& matrix, auto&& write) {
+  using MatrixT = std::remove_cvref_t<decltype(matrix)>;
+  using value_type = MatrixT::value_type;
+
+  const auto rows{numberOfRows(matrix)};
+  const auto rowBytes{numberOfColumns(matrix) * sizeof(value_type)};
+
+  if constexpr (kHasDenseRowsV<MatrixT>) {
+    if (rows != 0U &&
+        matrix.rowData(rows - 1U) ==
+            matrix.rowData(0U) + ((rows - 1U) * numberOfColumns(matrix))) {
+      write(std::string_view{
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+          reinterpret_cast<const char*>(matrix.rowData(0U)), rows * rowBytes});
+      return;
+    }
+  }
+
+  std::string block;
+  block.reserve(std::max(kFormatBlockBytes, rowBytes));
+  forEachContiguousRow(matrix, [&](std::size_t, const auto* row) {
+    if (block.size() + rowBytes > block.capacity()) {
+      write(std::string_view{block});
+      block.clear();
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    block.append(reinterpret_cast<const char*>(row), rowBytes);
+  });
+
+  if (!block.empty()) {
+    write(std::string_view{block});
+  }
+}
+
+/// @brief helper function to write a block to a C stream
+/// @param file the stream
+/// @return function writing a block to the stream
+/// @throw std::system_error if a block cannot be written
+static auto writeToFile(std::FILE* file) {
+  return [file](std::string_view block) {
+    if (std::fwrite(block.data(), 1U, block.size(), file) != block.size()) {
+      throw std::system_error(errno, std::generic_category(),
+                              "Cannot write the matrix");
+    }
+  };
+}
+
+/// @brief helper function to write a block to an output stream
+/// @param stream the stream
+/// @return function writing a block to the stream, whose state tells whether
+///         the writing failed
+static auto writeToStream(std::ostream& stream) {
+  return [&stream](std::string_view block) {
+    stream.write(block.data(), static_cast<std::streamsize>(block.size()));
+  };
+}
+
+/// @brief formatter of matrices, the base of the std::formatter of every
+///        matrix type
+/// @tparam MatrixT type of matrix formatted
+/// @note an empty format specification formats the matrix as display()
+///       shows it, "b" formats the bytes of its elements, row after row
+template <typename MatrixT>
+class MatrixFormatter {
+public:
+  /// @brief method to parse the format specification
+  /// @param context the format specification
+  /// @return iterator to the end of the specification
+  /// @throw std::format_error if the specification is neither empty nor "b"
+  constexpr auto parse(std::format_parse_context& context) {
+    auto iterator{context.begin()};
+    if (iterator != context.end() && *iterator == 'b') {
+      m_binary = true;
+      ++iterator;
+    }
+
+    if (iterator != context.end() && *iterator != '}') {
+      throw std::format_error(
+          "Matrices format specification is either empty or b");
+    }
+
+    return iterator;
+  }
+
+  /// @brief method to format a matrix
+  /// @param matrix the matrix to be formatted
+  /// @param context the format context to write the matrix to
+  /// @return iterator past the written matrix
+  auto format(const MatrixT& matrix, auto& context) const {
+    auto out{context.out()};
+    const auto write{[&out](std::string_view block) {
+      out = std::copy(block.begin(), block.end(), out);
+    }};
+
+    if (m_binary) {
+      dumpMatrixBlocks(matrix, write);
+    } else {
+      out = formatRowsTo(out, matrix);
+    }
+
+    return out;
+  }
+
+private:
+  /// @brief whether the bytes of the elements are formatted instead of their
+  ///        text
+  bool m_binary{false};
+};
+
+}  // namespace matrix_common
+
+/// @brief function to write the text of a matrix, as display() shows it, to
+///        an output iterator, without building a string per element or row
+/// @param out output iterator to write the text to
+/// @param matrix the matrix to be written
+/// @return the output iterator past the text
+auto formatMatrixTo(auto out, const auto& matrix) {
+  return matrix_common::formatRowsTo(out, matrix);
+}
+
+/// @brief function to write the text of a matrix, as display() shows it, to
+///        a C stream, through a single reused buffer
+/// @param file the stream to write to
+/// @param matrix the matrix to be written
+/// @throw std::system_error if the matrix cannot be written
+void printMatrix(std::FILE* file, const auto& matrix) {
+  matrix_common::formatMatrixBlocks(matrix, matrix_common::writeToFile(file));
+}
+
+/// @brief function to write the text of a matrix, as display() shows it, to
+///        an output stream, through a single reused buffer
+/// @param stream the stream to write to, whose state tells whether the
+///        writing failed
+/// @param matrix the matrix to be written
+void printMatrix(std::ostream& stream, const auto& matrix) {
+  matrix_common::formatMatrixBlocks(matrix,
+                                    matrix_common::writeToStream(stream));
+}
+
+/// @brief function to write the bytes of all elements of a matrix, zeros
+///        included, row after row, to a C stream
+/// @param file the stream to write to
+/// @param matrix the matrix to be written
+/// @throw std::system_error if the matrix cannot be written
+/// @note there is no header, see writeMatrixFile() for self-describing files
+void dumpMatrix(std::FILE* file, const auto& matrix) {
+  matrix_common::dumpMatrixBlocks(matrix, matrix_common::writeToFile(file));
+}
+
+/// @brief function to write the bytes of all elements of a matrix, zeros
+///        included, row after row, to an output stream
+/// @param stream the stream to write to, whose state tells whether the
+///        writing failed
+/// @param matrix the matrix to be written
+/// @note there is no header, see writeMatrixFile() for self-describing files
+void dumpMatrix(std::ostream& stream, const auto& matrix) {
+  matrix_common::dumpMatrixBlocks(matrix,
+                                  matrix_common::writeToStream(stream));
+}
+
+}  // namespace data_structures::matrix_types
+
+/// @brief formatter of every matrix type, see matrix_common::MatrixFormatter
+/// @tparam MatrixT type of matrix formatted
+template <typename MatrixT>
+  requires data_structures::matrix_types::kIsMatrixAdtV<MatrixT>
+struct std::formatter<MatrixT, char>
+    : data_structures::matrix_types::matrix_common::MatrixFormatter<MatrixT> {
+};
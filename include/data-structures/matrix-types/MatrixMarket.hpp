@@ -0,0 +1,693 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixStorage.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SymmetricMatrix.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief the layouts of the entries of a Matrix Market file
+enum class MatrixMarketFormat : std::uint8_t {
+  /// @brief one "row column [value]" line per non-zero, indices from one
+  kCoordinate,
+
+  /// @brief every value, column after column
+  kArray
+};
+
+/// @brief the fields of the values of a Matrix Market file
+enum class MatrixMarketField : std::uint8_t {
+  kReal,
+  kInteger,
+
+  /// @brief no value, every listed entry is a one
+  kPattern
+};
+
+/// @brief the symmetries of a Matrix Market file, the files of the
+///        symmetric ones listing only their lower triangle
+enum class MatrixMarketSymmetry : std::uint8_t {
+  kGeneral,
+  kSymmetric,
+  kSkewSymmetric
+};
+
+/// @brief the header of a Matrix Market file, i.e. its banner and its size
+///        line
+struct MatrixMarketHeader {
+  /// @brief layout of the entries
+  MatrixMarketFormat format{};
+
+  /// @brief field of the values
+  MatrixMarketField field{};
+
+  /// @brief symmetry of the matrix
+  MatrixMarketSymmetry symmetry{};
+
+  /// @brief number of rows of the matrix
+  std::size_t rows{};
+
+  /// @brief number of columns of the matrix
+  std::size_t columns{};
+
+  /// @brief number of entries listed by the file
+  std::size_t entries{};
+};
+
+/// @brief the matrix read from a Matrix Market file, with the header of the
+///        file and the throughput of the reading
+/// @tparam MatrixT type of the matrix read
+template <typename MatrixT>
+struct MatrixMarketResult {
+  /// @brief the matrix read
+  MatrixT matrix;
+
+  /// @brief the header of the file
+  MatrixMarketHeader header;
+
+  /// @brief number of bytes of the file
+  std::size_t bytes{};
+
+  /// @brief time taken to read and parse the file
+  std::chrono::duration<double> elapsed{};
+
+  /// @brief method to return the throughput of the reading
+  /// @return megabytes read per second
+  [[nodiscard]] auto megabytesPerSecond() const noexcept -> double {
+    constexpr double kBytesPerMegabyte{1e6};
+    return elapsed.count() > 0.0 ? static_cast<double>(bytes) /
+                                       kBytesPerMegabyte / elapsed.count()
+                                 : 0.0;
+  }
+};
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief number of bytes of a Matrix Market file parsed by a single task,
+///        each chunk ending at the end of a line
+static constexpr std::size_t kMatrixMarketChunkBytes{std::size_t{1U} << 20U};
+
+/// @brief number of elements flagged by each word of the bitset used to
+///        detect entries listed twice in a coordinate Matrix Market file
+static constexpr std::size_t kMatrixMarketBitsPerWord{64U};
+
+/// @brief helper function to consume the next token of a Matrix Market text,
+///        skipping white spaces and comment lines
+/// @param text the text left to parse, advanced past the token
+/// @return the token, empty at the end of the text
+static auto nextToken(std::string_view& text) noexcept -> std::string_view {
+  std::size_t begin{0U};
+  while (begin < text.size()) {
+    if (text[begin] == '%') {
+      begin = std::min(text.find('\n', begin), text.size());
+    } else if (std::isspace(static_cast<unsigned char>(text[begin])) != 0) {
+      ++begin;
+    } else {
+      break;
+    }
+  }
+
+  auto end{begin};
+  while (end < text.size() &&
+         std::isspace(static_cast<unsigned char>(text[end])) == 0) {
+    ++end;
+  }
+
+  const auto token{text.substr(begin, end - begin)};
+  text.remove_prefix(end);
+
+  return token;
+}
+
+/// @brief helper function to parse a number of a Matrix Market text, without
+///        any allocation
+/// @tparam T type of the number
+/// @param token the token holding the number
+/// @return the number
+/// @throw std::runtime_error if the token is not a number of the type
+template <typename T>
+static auto parseNumber(std::string_view token) -> T {
+  if (token.starts_with('+')) {
+    token.remove_prefix(1U);
+  }
+
+  T number{};
+  const auto* const end{token.data() + token.size()};
+  const auto [last, error]{std::from_chars(token.data(), end, number)};
+  if (error != std::errc{} || last != end || token.empty()) {
+    throw std::runtime_error(
+        std::format("Cannot parse '{}' as a number of a Matrix Market file",
+                    token));
+  }
+
+  return number;
+}
+
+/// @brief helper function to parse the banner and the size line of a Matrix
+///        Market text
+/// @param text the text to parse, advanced to the first entry
+/// @return the header of the text
+/// @throw std::runtime_error if the header is not a valid one, or is of a
+///        complex or hermitian matrix, which have no matrix type
+static auto parseMatrixMarketHeader(std::string_view& text)
+    -> MatrixMarketHeader {
+  constexpr std::string_view kBanner{"%%MatrixMarket"};
+  if (!text.starts_with(kBanner)) {
+    throw std::runtime_error("Matrix Market files must start with their "
+                             "banner, %%MatrixMarket");
+  }
+  text.remove_prefix(kBanner.size());
+
+  // the keywords of the banner are case-insensitive
+  const auto bannerEnd{std::min(text.find('\n'), text.size())};
+  std::string banner{text.substr(0U, bannerEnd)};
+  std::ranges::transform(banner, banner.begin(), [](char character) {
+    return static_cast<char>(
+        std::tolower(static_cast<unsigned char>(character)));
+  });
+  text.remove_prefix(bannerEnd);
+
+  std::string_view keywords{banner};
+  std::array<std::string_view, 4U> tokens;
+  for (auto& token : tokens) {
+    token = nextToken(keywords);
+  }
+  const auto& [object, format, field, symmetry]{tokens};
+
+  MatrixMarketHeader header;
+  if (object != "matrix" || (format != "coordinate" && format != "array")) {
+    throw std::runtime_error(std::format(
+        "Unsupported Matrix Market banner: {} {}", object, format));
+  }
+  header.format = format == "coordinate" ? MatrixMarketFormat::kCoordinate
+                                         : MatrixMarketFormat::kArray;
+
+  if (field == "real" || field == "double") {
+    header.field = MatrixMarketField::kReal;
+  } else if (field == "integer") {
+    header.field = MatrixMarketField::kInteger;
+  } else if (field == "pattern" &&
+             header.format == MatrixMarketFormat::kCoordinate) {
+    header.field = MatrixMarketField::kPattern;
+  } else {
+    throw std::runtime_error(
+        std::format("Unsupported Matrix Market field: {} {}", format, field));
+  }
+
+  if (symmetry == "general") {
+    header.symmetry = MatrixMarketSymmetry::kGeneral;
+  } else if (symmetry == "symmetric") {
+    header.symmetry = MatrixMarketSymmetry::kSymmetric;
+  } else if (symmetry == "skew-symmetric") {
+    header.symmetry = MatrixMarketSymmetry::kSkewSymmetric;
+  } else {
+    throw std::runtime_error(
+        std::format("Unsupported Matrix Market symmetry: {}", symmetry));
+  }
+
+  header.rows = parseNumber<std::size_t>(nextToken(text));
+  header.columns = parseNumber<std::size_t>(nextToken(text));
+  if (header.symmetry != MatrixMarketSymmetry::kGeneral &&
+      header.rows != header.columns) {
+    throw std::runtime_error(std::format(
+        "A symmetric Matrix Market matrix cannot be [{}*{}]", header.rows,
+        header.columns));
+  }
+
+  // sizes of the header are not trusted, the dense matrix they describe
+  // being allocated before any entry is read
+  std::size_t elements{0U};
+  try {
+    elements = checkedSizeProduct(header.rows, header.columns);
+  } catch (const std::invalid_argument& exception) {
+    throw std::runtime_error(
+        std::format("Matrix Market matrix of [{}*{}] is too large: {}",
+                    header.rows, header.columns, exception.what()));
+  }
+
+  if (header.format == MatrixMarketFormat::kCoordinate) {
+    header.entries = parseNumber<std::size_t>(nextToken(text));
+    if (header.entries > elements) {
+      throw std::runtime_error(std::format(
+          "Matrix Market file lists {} entries, more than the {} elements "
+          "of its matrix",
+          header.entries, elements));
+    }
+  } else if (header.symmetry == MatrixMarketSymmetry::kGeneral) {
+    header.entries = elements;
+  } else if (header.symmetry == MatrixMarketSymmetry::kSymmetric) {
+    header.entries = numberOfTriangleElements(header.rows);
+  } else {
+    // the diagonal of a skew-symmetric matrix is zero, hence not listed
+    header.entries = header.rows * (header.rows - 1U) / 2U;
+  }
+
+  return header;
+}
+
+/// @brief helper function to split the entries of a Matrix Market text into
+///        chunks of about kMatrixMarketChunkBytes, at line ends
+/// @param text the entries
+/// @return the chunks
+static auto splitMatrixMarketChunks(std::string_view text)
+    -> std::vector<std::string_view> {
+  std::vector<std::string_view> chunks;
+  chunks.reserve((text.size() / kMatrixMarketChunkBytes) + 1U);
+
+  while (!text.empty()) {
+    auto end{text.size()};
+    if (end > kMatrixMarketChunkBytes) {
+      end = std::min(text.find('\n', kMatrixMarketChunkBytes), text.size());
+    }
+
+    chunks.push_back(text.substr(0U, end));
+    text.remove_prefix(end);
+  }
+
+  return chunks;
+}
+
+/// @brief helper function to store an entry of a Matrix Market file, and its
+///        mirror when the file lists only the lower triangle
+/// @param matrix the dense matrix being read
+/// @param header the header of the file
+/// @param row index of the row of the entry, from zero
+/// @param column index of the column of the entry, from zero
+/// @param value the value of the entry
+template <typename T>
+static void storeMatrixMarketEntry(DynamicMatrix<T>& matrix,
+                                   const MatrixMarketHeader& header,
+                                   std::size_t row, std::size_t column,
+                                   T value) {
+  matrix.rowData(row)[column] = value;
+
+  if (row != column) {
+    if (header.symmetry == MatrixMarketSymmetry::kSymmetric) {
+      matrix.rowData(column)[row] = value;
+    } else if (header.symmetry == MatrixMarketSymmetry::kSkewSymmetric) {
+      matrix.rowData(column)[row] = T{} - value;
+    }
+  }
+}
+
+/// @brief helper function to parse a chunk of entries of a Matrix Market
+///        file in the coordinate format into a dense matrix
+/// @param chunk the entries
+/// @param header the header of the file
+/// @param matrix the dense matrix being read, sized by the header
+/// @param listed bits of the elements already listed, row after row and 64
+///        per word, shared by all chunks so that no element is written twice
+/// @return number of entries parsed
+/// @throw std::runtime_error if an entry is not valid, or is listed twice
+template <typename T>
+static auto parseCoordinateChunk(std::string_view chunk,
+                                 const MatrixMarketHeader& header,
+                                 DynamicMatrix<T>& matrix,
+                                 std::span<std::atomic<std::uint64_t>> listed)
+    -> std::size_t {
+  std::size_t entries{0U};
+  for (auto token{nextToken(chunk)}; !token.empty();
+       token = nextToken(chunk), ++entries) {
+    const auto row{parseNumber<std::size_t>(token)};
+    const auto column{parseNumber<std::size_t>(nextToken(chunk))};
+    const auto value{header.field == MatrixMarketField::kPattern
+                         ? T{1}
+                         : parseNumber<T>(nextToken(chunk))};
+
+    if (row == 0U || row > header.rows || column == 0U ||
+        column > header.columns ||
+        (header.symmetry != MatrixMarketSymmetry::kGeneral && column > row)) {
+      throw std::runtime_error(std::format(
+          "Entry ({}, {}) out of the [{}*{}] Matrix Market matrix", row,
+          column, header.rows, header.columns));
+    }
+
+    // the diagonal of a skew-symmetric matrix is zero, hence never listed
+    if (header.symmetry == MatrixMarketSymmetry::kSkewSymmetric &&
+        row == column) {
+      throw std::runtime_error(std::format(
+          "Entry ({}, {}) on the diagonal of a skew-symmetric Matrix Market "
+          "matrix",
+          row, column));
+    }
+
+    // chunks are parsed concurrently, so an element listed twice is
+    // rejected rather than written by two of them
+    const auto index{((row - 1U) * header.columns) + column - 1U};
+    const auto bit{std::uint64_t{1U} << (index % kMatrixMarketBitsPerWord)};
+    const auto previous{listed[index / kMatrixMarketBitsPerWord].fetch_or(
+        bit, std::memory_order_relaxed)};
+    if ((previous & bit) != 0U) {
+      throw std::runtime_error(std::format(
+          "Entry ({}, {}) listed twice in a Matrix Market file", row,
+          column));
+    }
+
+    storeMatrixMarketEntry(matrix, header, row - 1U, column - 1U, value);
+  }
+
+  return entries;
+}
+
+/// @brief helper function to parse a chunk of values of a Matrix Market file
+///        in the array format into a dense matrix
+/// @param chunk the values
+/// @param header the header of the file
+/// @param matrix the dense matrix being read, sized by the header
+/// @param firstValue index of the first value of the chunk in the file
+/// @return number of values parsed
+/// @throw std::runtime_error if a value is not valid, or is one too many
+template <typename T>
+static auto parseArrayChunk(std::string_view chunk,
+                            const MatrixMarketHeader& header,
+                            DynamicMatrix<T>& matrix, std::size_t firstValue)
+    -> std::size_t {
+  // columns of symmetric matrices start at the diagonal, or below it
+  const auto columnBegin{[&header](std::size_t column) {
+    return header.symmetry == MatrixMarketSymmetry::kGeneral ? 0U
+           : header.symmetry == MatrixMarketSymmetry::kSymmetric
+               ? column
+               : column + 1U;
+  }};
+
+  // position of the first value, found once per chunk
+  std::size_t column{0U};
+  auto row{columnBegin(0U) + firstValue};
+  while (column < header.columns && row >= header.rows) {
+    row -= header.rows;
+    ++column;
+    row += columnBegin(column);
+  }
+
+  std::size_t values{0U};
+  for (auto token{nextToken(chunk)}; !token.empty();
+       token = nextToken(chunk), ++values) {
+    if (column >= header.columns) {
+      throw std::runtime_error(std::format(
+          "Matrix Market array lists more than its {} values",
+          header.entries));
+    }
+
+    storeMatrixMarketEntry(matrix, header, row, column, parseNumber<T>(token));
+
+    // the last column of a skew-symmetric matrix lists no value, so more
+    // than one column may be stepped over
+    ++row;
+    while (column < header.columns && row >= header.rows) {
+      ++column;
+      row = columnBegin(column);
+    }
+  }
+
+  return values;
+}
+
+/// @brief helper function to count the tokens of a chunk of a Matrix Market
+///        file, i.e. the values of a chunk of a file in the array format
+/// @param chunk the chunk in question
+/// @return number of tokens
+static auto countTokens(std::string_view chunk) noexcept -> std::size_t {
+  std::size_t tokens{0U};
+  while (!nextToken(chunk).empty()) {
+    ++tokens;
+  }
+
+  return tokens;
+}
+
+/// @brief helper function to parse a Matrix Market text into a dense
+///        matrix, the chunks of entries being parsed in parallel
+/// @param text the whole text of the file
+/// @param executor executor to run the chunks on
+/// @return the dense matrix, with the header of the text
+/// @throw std::runtime_error if the text is not a valid Matrix Market file
+template <typename T>
+static auto parseMatrixMarketText(std::string_view text,
+                                  common::Executor auto& executor)
+    -> std::pair<DynamicMatrix<T>, MatrixMarketHeader> {
+  const auto header{parseMatrixMarketHeader(text)};
+  DynamicMatrix<T> matrix(header.rows, header.columns);
+
+  const auto chunks{splitMatrixMarketChunks(text)};
+  std::vector<std::size_t> counts(chunks.size());
+
+  if (header.format == MatrixMarketFormat::kCoordinate) {
+    // a bit per element rather than a flag, not to add a matrix of flags to
+    // the peak memory of reading
+    std::vector<std::atomic<std::uint64_t>> listed(
+        (header.rows * header.columns / kMatrixMarketBitsPerWord) + 1U);
+    executor.parallelFor(chunks.size(), [&](std::size_t chunk) {
+      counts[chunk] =
+          parseCoordinateChunk(chunks[chunk], header, matrix, listed);
+    });
+  } else {
+    // values are positioned by their index, so the values of each chunk are
+    // counted first
+    executor.parallelFor(chunks.size(), [&](std::size_t chunk) {
+      counts[chunk] = countTokens(chunks[chunk]);
+    });
+
+    std::vector<std::size_t> firstValues(chunks.size());
+    std::exclusive_scan(counts.begin(), counts.end(), firstValues.begin(),
+                        std::size_t{0U});
+    executor.parallelFor(chunks.size(), [&](std::size_t chunk) {
+      counts[chunk] =
+          parseArrayChunk(chunks[chunk], header, matrix, firstValues[chunk]);
+    });
+  }
+
+  const auto entries{
+      std::accumulate(counts.begin(), counts.end(), std::size_t{0U})};
+  if (entries != header.entries) {
+    throw std::runtime_error(
+        std::format("Matrix Market file lists {} entries, not the {} of its "
+                    "header",
+                    entries, header.entries));
+  }
+
+  return {std::move(matrix), header};
+}
+
+/// @brief helper function to read the whole text of a file at once
+/// @param path path of the file
+/// @return the text of the file
+/// @throw std::system_error if the file cannot be opened, or is read short
+static auto readWholeFile(const std::filesystem::path& path) -> std::string {
+  std::ifstream stream{path, std::ios::binary};
+  if (!stream) {
+    throw std::system_error(std::make_error_code(std::errc::io_error),
+                            std::format("Cannot open {}", path.string()));
+  }
+
+  std::string text(std::filesystem::file_size(path), '\0');
+  stream.read(text.data(), static_cast<std::streamsize>(text.size()));
+  if (std::cmp_not_equal(stream.gcount(), text.size())) {
+    throw std::system_error(
+        std::make_error_code(std::errc::io_error),
+        std::format("Cannot read the {} bytes of {}", text.size(),
+                    path.string()));
+  }
+
+  return text;
+}
+
+/// @brief helper function to move a square matrix read from a Matrix Market
+///        file into the matrix type storing it in the least memory among
+///        the dense, packed and diagonal ones
+/// @tparam N number of rows and columns of the matrix
+/// @param dense the matrix read, with the header of the file
+/// @return the matrix in a DiagonalMatrix if it is diagonal, otherwise in a
+///         SymmetricMatrix if the header tells it is symmetric, in a
+///         LowerTriangularMatrix if it is lower triangular, and in a
+///         NormalMatrix otherwise
+/// @throw std::invalid_argument if the matrix is not [N*N]
+template <common::NaturalNumber auto N, typename T>
+static auto toSmallestStorage(const MatrixMarketResult<DynamicMatrix<T>>& dense)
+    -> MatrixMarketResult<AnyStorageMatrix<N, T>> {
+  const auto& matrix{dense.matrix};
+  const auto& header{dense.header};
+  if (header.rows != N || header.columns != N) {
+    throw std::invalid_argument(
+        std::format("Cannot store a [{}*{}] Matrix Market matrix as [{}*{}]",
+                    header.rows, header.columns, N, N));
+  }
+
+  const auto copyRows{[&matrix](auto result, auto rowLength) {
+    for (std::size_t i{0U}; i < N; ++i) {
+      std::copy_n(matrix.rowData(i), rowLength(i), result.rowData(i));
+    }
+    return result;
+  }};
+  const auto lowerRowLength{[](std::size_t i) { return i + 1U; }};
+
+  AnyStorageMatrix<N, T> result{[&]() -> AnyStorageMatrix<N, T> {
+    if (matrix.isDiagonal()) {
+      std::array<T, N> diagonal;
+      for (std::size_t i{0U}; i < N; ++i) {
+        diagonal[i] = matrix.rowData(i)[i];
+      }
+      return std::apply(
+          [](const auto&... elements) {
+            return DiagonalMatrix<N, T>{elements...};
+          },
+          diagonal);
+    }
+
+    if (header.symmetry == MatrixMarketSymmetry::kSymmetric) {
+      return copyRows(SymmetricMatrix<N, T>{}, lowerRowLength);
+    }
+
+    if (matrix.isLowerTriangular()) {
+      return copyRows(LowerTriangularMatrix<N, T>{}, lowerRowLength);
+    }
+
+    return copyRows(NormalMatrix<N, N, T>{}, [](std::size_t) { return N; });
+  }()};
+
+  return {std::move(result), header, dense.bytes, dense.elapsed};
+}
+
+}  // namespace matrix_common
+
+/// @brief function to parse a Matrix Market text into a dense matrix, on the
+///        given executor
+/// @tparam T type of elements of matrix
+/// @param text the whole text of the file
+/// @param executor executor to run the chunks of the text on
+/// @return the dense matrix, the lower triangle of symmetric files being
+///         mirrored, with the header and the throughput of the parsing
+/// @throw std::runtime_error if the text is not a valid Matrix Market file
+/// @note chunks of about kMatrixMarketChunkBytes are parsed in parallel by
+///       std::from_chars straight from the text, so no allocation takes
+///       place per entry
+template <typename T>
+auto parseMatrixMarket(std::string_view text,
+                       common::Executor auto& executor)
+    -> MatrixMarketResult<DynamicMatrix<T>> {
+  const auto start{std::chrono::steady_clock::now()};
+  auto [matrix, header]{
+      matrix_common::parseMatrixMarketText<T>(text, executor)};
+
+  return {std::move(matrix), header, text.size(),
+          std::chrono::steady_clock::now() - start};
+}
+
+/// @brief overload of the function above that runs serially, unless the
+///        text spans several chunks, then it runs over
+///        common::ThreadPool::shared()
+/// @tparam T type of elements of matrix
+/// @param text the whole text of the file
+/// @return the dense matrix, with the header and the throughput of the
+///         parsing
+/// @throw std::runtime_error if the text is not a valid Matrix Market file
+template <typename T>
+auto parseMatrixMarket(std::string_view text)
+    -> MatrixMarketResult<DynamicMatrix<T>> {
+  if (text.size() <= matrix_common::kMatrixMarketChunkBytes) {
+    common::SerialExecutor executor;
+    return parseMatrixMarket<T>(text, executor);
+  }
+
+  return parseMatrixMarket<T>(text, common::ThreadPool::shared());
+}
+
+/// @brief function to parse a Matrix Market text of a square matrix into
+///        the matrix type storing it in the least memory, on the given
+///        executor, see matrix_common::toSmallestStorage()
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix
+/// @param text the whole text of the file
+/// @param executor executor to run the chunks of the text on
+/// @return the matrix, with the header and the throughput of the parsing
+/// @throw std::runtime_error if the text is not a valid Matrix Market file
+/// @throw std::invalid_argument if the matrix is not [N*N]
+template <common::NaturalNumber auto N, typename T>
+auto parseMatrixMarket(std::string_view text,
+                       common::Executor auto& executor)
+    -> MatrixMarketResult<AnyStorageMatrix<N, T>> {
+  return matrix_common::toSmallestStorage<N>(
+      parseMatrixMarket<T>(text, executor));
+}
+
+/// @brief overload of the function above that runs serially, unless the
+///        text spans several chunks
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix
+/// @param text the whole text of the file
+/// @return the matrix, with the header and the throughput of the parsing
+/// @throw std::runtime_error if the text is not a valid Matrix Market file
+/// @throw std::invalid_argument if the matrix is not [N*N]
+template <common::NaturalNumber auto N, typename T>
+auto parseMatrixMarket(std::string_view text)
+    -> MatrixMarketResult<AnyStorageMatrix<N, T>> {
+  return matrix_common::toSmallestStorage<N>(parseMatrixMarket<T>(text));
+}
+
+/// @brief function to read a Matrix Market file into a dense matrix, see
+///        parseMatrixMarket()
+/// @tparam T type of elements of matrix
+/// @param path path of the file
+/// @return the dense matrix, with the header of the file and the throughput
+///         of the reading, which includes the time to read the file
+/// @throw std::system_error if the file cannot be read
+/// @throw std::runtime_error if the file is not a valid Matrix Market file
+template <typename T>
+auto readMatrixMarket(const std::filesystem::path& path)
+    -> MatrixMarketResult<DynamicMatrix<T>> {
+  const auto start{std::chrono::steady_clock::now()};
+  const auto text{matrix_common::readWholeFile(path)};
+
+  auto result{parseMatrixMarket<T>(text)};
+  result.elapsed = std::chrono::steady_clock::now() - start;
+
+  return result;
+}
+
+/// @brief function to read a Matrix Market file of a square matrix into the
+///        matrix type storing it in the least memory, see
+///        matrix_common::toSmallestStorage()
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix
+/// @param path path of the file
+/// @return the matrix, with the header of the file and the throughput of the
+///         reading, which includes the time to read the file
+/// @throw std::system_error if the file cannot be read
+/// @throw std::runtime_error if the file is not a valid Matrix Market file
+/// @throw std::invalid_argument if the matrix is not [N*N]
+template <common::NaturalNumber auto N, typename T>
+auto readMatrixMarket(const std::filesystem::path& path)
+    -> MatrixMarketResult<AnyStorageMatrix<N, T>> {
+  return matrix_common::toSmallestStorage<N>(readMatrixMarket<T>(path));
+}
+
+}  // namespace data_structures::matrix_types
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "algorithms/Recursion.hpp"
+#include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/FastMultiplication.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief concept of the square matrix types whose products by themselves
+///        keep their type, so that they can be raised to a power, i.e. all
+///        of them but the sparse ones and those whose structure is lost
+/// @tparam MatrixT the matrix type in question
+template <typename MatrixT>
+concept SquarePowerable =
+    MatrixAdtConcept<MatrixT> &&
+    ((StaticallySized<MatrixT> &&
+      MatrixT::dimensions().kRows == MatrixT::dimensions().kColumns) ||
+     (!StaticallySized<MatrixT> &&
+      requires(MatrixT matrix) { matrix.rowData(0U); })) &&
+    std::same_as<decltype(std::declval<const MatrixT&>() *
+                          std::declval<const MatrixT&>()),
+                 MatrixT>;
+
+/// @brief trait telling whether a matrix type is a DiagonalMatrix
+/// @tparam MatrixT the matrix type in question
+template <typename MatrixT>
+constexpr bool kIsDiagonalMatrixV{false};
+
+/// @brief specialization of the trait above for DiagonalMatrix
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix
+template <common::NaturalNumber auto N, typename T>
+constexpr bool kIsDiagonalMatrixV<DiagonalMatrix<N, T>>{true};
+
+/// @brief helper function to build the identity matrix of the type and
+///        dimensions of a square matrix
+/// @param matrix the matrix in question
+/// @return the identity matrix
+template <typename MatrixT>
+auto identityLike(const MatrixT& matrix) -> MatrixT {
+  using value_type = MatrixT::value_type;
+
+  if constexpr (StaticallySized<MatrixT>) {
+    constexpr auto kSize{MatrixT::dimensions().kRows};
+    std::array<value_type, kSize> ones;
+    ones.fill(value_type{1});
+
+    MatrixT identity{};
+    identity += std::apply(
+        [](const auto&... elements) {
+          return DiagonalMatrix<kSize, value_type>{elements...};
+        },
+        ones);
+
+    return identity;
+  } else {
+    const auto size{numberOfRows(matrix)};
+    MatrixT identity(size, size);
+    for (std::size_t i{0U}; i < size; ++i) {
+      identity.rowData(i)[i] = value_type{1};
+    }
+
+    return identity;
+  }
+}
+
+}  // namespace matrix_common
+
+/// @brief function to raise a square matrix to a natural power by repeated
+///        squaring, i.e. in about 2 log2(exponent) products
+/// @tparam MatrixT type of the matrix, square and closed under multiplication
+/// @param matrix the matrix to be raised
+/// @param exponent the power to raise the matrix to, zero giving identity
+/// @return the matrix to the power of exponent, of the type of the matrix
+/// @throw std::invalid_argument if a runtime sized matrix is not square
+/// @note a diagonal matrix is raised element-wise, by algorithms::Recursion,
+///       in O(N log k). Dense matrices ping-pong between three buffers
+///       allocated once, the power, the squared base and the product being
+///       computed, and pack the operands of every product in the same
+///       workspace, so no allocation takes place per step. Other matrix
+///       types, e.g. triangular ones, are multiplied by value
+template <matrix_common::SquarePowerable MatrixT>
+auto pow(const MatrixT& matrix, std::size_t exponent) -> MatrixT {
+  using value_type = MatrixT::value_type;
+  const auto rows{matrix_common::numberOfRows(matrix)};
+  const auto columns{matrix_common::numberOfColumns(matrix)};
+
+  if (rows != columns) {
+    throw std::invalid_argument(std::format(
+        "Cannot raise a non-square [{}*{}] matrix to a power", rows, columns));
+  }
+
+  if (exponent == 0U) {
+    return matrix_common::identityLike(matrix);
+  }
+
+  if constexpr (matrix_common::kIsDiagonalMatrixV<MatrixT>) {
+    constexpr auto kSize{MatrixT::dimensions().kRows};
+    std::array<value_type, kSize> elements;
+    for (std::size_t i{0U}; i < kSize; ++i) {
+      elements[i] =
+          algorithms::Recursion::power(matrix.rowView(i)[i], exponent);
+    }
+
+    return std::apply(
+        [](const auto&... powers) { return MatrixT{powers...}; }, elements);
+  } else {
+    matrix_common::Workspace<value_type> workspace;
+    const auto multiplyInto{[&workspace](const MatrixT& first,
+                                         const MatrixT& second,
+                                         MatrixT& product) {
+      if constexpr (requires { product.rowData(0U)[0U] = value_type{}; } &&
+                    !kHasPackedRowsV<MatrixT>) {
+        matrix_common::multiplyInto(first, second, product, workspace);
+      } else {
+        product = first * second;
+      }
+    }};
+
+    // the power starts as the base to the lowest set bit of the exponent,
+    // instead of as an identity multiplied by it
+    std::array<MatrixT, 3U> buffers{matrix, matrix, matrix};
+    auto* base{buffers.data()};
+    auto* power{base + 1U};
+    auto* scratch{base + 2U};
+    bool isPowerSet{false};
+
+    while (true) {
+      if ((exponent & 1U) != 0U) {
+        if (isPowerSet) {
+          multiplyInto(*power, *base, *scratch);
+          std::swap(power, scratch);
+        } else {
+          *power = *base;
+          isPowerSet = true;
+        }
+      }
+
+      exponent >>= 1U;
+      if (exponent == 0U) {
+        break;
+      }
+
+      multiplyInto(*base, *base, *scratch);
+      std::swap(base, scratch);
+    }
+
+    return std::move(*power);
+  }
+}
+
+}  // namespace data_structures::matrix_types
@@ -0,0 +1,502 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixPower.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
+#include "data-structures/matrix-types/UpperTriangularMatrix.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief trait telling whether a matrix type is a LowerTriangularMatrix
+/// @tparam MatrixT the matrix type in question
+template <typename MatrixT>
+constexpr bool kIsLowerTriangularMatrixV{false};
+
+/// @brief specialization of the trait above for LowerTriangularMatrix
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix
+template <common::NaturalNumber auto N, typename T>
+constexpr bool kIsLowerTriangularMatrixV<LowerTriangularMatrix<N, T>>{true};
+
+/// @brief trait telling whether a matrix type is an UpperTriangularMatrix
+/// @tparam MatrixT the matrix type in question
+template <typename MatrixT>
+constexpr bool kIsUpperTriangularMatrixV{false};
+
+/// @brief specialization of the trait above for UpperTriangularMatrix
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix
+template <common::NaturalNumber auto N, typename T>
+constexpr bool kIsUpperTriangularMatrixV<UpperTriangularMatrix<N, T>>{true};
+
+/// @brief concept of the matrix types whose elements above the diagonal are
+///        all structural zeros
+/// @tparam MatrixT the matrix type in question
+template <typename MatrixT>
+concept LowerStructured =
+    kIsDiagonalMatrixV<MatrixT> || kIsLowerTriangularMatrixV<MatrixT>;
+
+/// @brief concept of the matrix types whose elements below the diagonal are
+///        all structural zeros
+/// @tparam MatrixT the matrix type in question
+template <typename MatrixT>
+concept UpperStructured =
+    kIsDiagonalMatrixV<MatrixT> || kIsUpperTriangularMatrixV<MatrixT>;
+
+/// @brief stored elements of a line, contiguous in memory
+/// @tparam T type of the elements
+template <typename T>
+struct ContiguousLine {
+  /// @brief pointer to the element at the first stored index
+  const T* data;
+
+  /// @brief first stored logical index
+  std::size_t first;
+
+  /// @brief past the last stored logical index
+  std::size_t last;
+};
+
+/// @brief helper function to read the stored elements of a line as a
+///        contiguous range, so that they can be passed to the kernels
+/// @param line view of the row, or the column, in question
+/// @param buffer vector the line is copied to when it is not contiguous in
+///        storage, which must outlive the returned range
+/// @return the stored elements of the line
+/// @note rows are contiguous in all dense and packed matrices types, only
+///       the ones of symmetric and sparse matrices are copied, zeros included
+template <typename T>
+static auto contiguousLine(const auto& line, std::vector<T>& buffer)
+    -> ContiguousLine<T> {
+  if constexpr (requires { line.mapping().stride; }) {
+    const auto mapping{line.mapping()};
+    return {line.data(), mapping.first, mapping.last};
+  } else {
+    buffer.resize(line.size());
+    line.copyTo(buffer.begin());
+    return {buffer.data(), 0U, line.size()};
+  }
+}
+
+/// @brief helper function to build a diagonal matrix out of its elements
+/// @tparam N number of rows and columns of the matrix, of the type of the
+///        dimensions of the operands it is the product of
+/// @tparam T type of the elements
+/// @param elements the diagonal elements of the matrix
+/// @return the diagonal matrix
+template <common::NaturalNumber auto N, typename T>
+static auto diagonalMatrixOf(
+    const std::array<T, static_cast<std::size_t>(N)>& elements) {
+  return std::apply(
+      [](const auto&... diagonal) { return DiagonalMatrix<N, T>{diagonal...}; },
+      elements);
+}
+
+/// @brief number of columns of the second operand of a Kronecker product
+///        from which each block of a row of the result is long enough to be
+///        scaled by its own call to the kernels
+static constexpr std::size_t kKroneckerBlockColumns{64U};
+
+/// @brief helper function to return the logical indices a line stores
+/// @param line view of the row, or the column, in question
+/// @return first stored index and past the last one
+static auto storedBounds(const auto& line)
+    -> std::pair<std::size_t, std::size_t> {
+  if constexpr (requires { line.mapping().stride; }) {
+    const auto mapping{line.mapping()};
+    return {mapping.first, mapping.last};
+  } else {
+    return {0U, line.size()};
+  }
+}
+
+/// @brief helper function to compute the Kronecker product of two matrices
+///        row after row of the result, each row being written once from left
+///        to right
+/// @param firstMatrix first operand of the Kronecker product
+/// @param secondMatrix second operand of the Kronecker product
+/// @param resultRow callable returning pointer to the element at the first
+///        column of a row of the result, the result is expected to be zeroed
+/// @note the blocks outside the stored range of both operands are skipped,
+///       but narrow operands are tiled and multiplied over the whole span
+///       of a row of the result, from its first stored position to its last
+///       one, structural zeros in between being read and written as well. A
+///       result with packed rows must thus store that span, as triangular
+///       results of triangular operands of the same side do
+static void multiplyKronecker(const auto& firstMatrix,
+                              const auto& secondMatrix,
+                              const auto& resultRow) {
+  using value_type = std::remove_cvref_t<decltype(firstMatrix)>::value_type;
+  const auto firstRows{numberOfRows(firstMatrix)};
+  const auto firstColumns{numberOfColumns(firstMatrix)};
+  const auto secondRows{numberOfRows(secondMatrix)};
+  const auto secondColumns{numberOfColumns(secondMatrix)};
+
+  std::vector<value_type> firstBuffer;
+  if (secondColumns >= kKroneckerBlockColumns) {
+    // each block of a row of the result is a row of the second matrix scaled
+    // by an element of a row of the first one
+    for (std::size_t i{0U}; i < firstRows; ++i) {
+      const auto firstRow{contiguousLine(firstMatrix.rowView(i), firstBuffer)};
+
+      for (std::size_t k{0U}; k < secondRows; ++k) {
+        const auto secondRow{secondMatrix.rowView(k)};
+        auto* const result{resultRow((i * secondRows) + k)};
+
+        for (auto j{firstRow.first}; j < firstRow.last; ++j) {
+          accumulateStoredLine(secondRow, firstRow.data[j - firstRow.first],
+                               result + (j * secondColumns));
+        }
+      }
+    }
+
+    return;
+  }
+
+  // blocks too short to be scaled one by one, each row of the second matrix
+  // is rather tiled once per column of the first one, and each element of a
+  // row of the first one repeated once per column of the second, so that a
+  // row of the result is their element-wise product, in a single call
+  const auto width{firstColumns * secondColumns};
+  std::vector<value_type> tiledRows(secondRows * width);
+  std::vector<std::pair<std::size_t, std::size_t>> secondBounds(secondRows);
+  for (std::size_t k{0U}; k < secondRows; ++k) {
+    const auto secondRow{secondMatrix.rowView(k)};
+    auto* const tile{tiledRows.data() + (k * width)};
+
+    secondRow.copyTo(tile);
+    for (std::size_t j{1U}; j < firstColumns; ++j) {
+      std::copy_n(tile, secondColumns, tile + (j * secondColumns));
+    }
+    secondBounds[k] = storedBounds(secondRow);
+  }
+
+  std::vector<value_type> repeatedRow(width);
+  for (std::size_t i{0U}; i < firstRows; ++i) {
+    const auto firstRow{contiguousLine(firstMatrix.rowView(i), firstBuffer)};
+    if (firstRow.last <= firstRow.first) {
+      continue;
+    }
+
+    for (auto j{firstRow.first}; j < firstRow.last; ++j) {
+      std::fill_n(repeatedRow.data() + (j * secondColumns), secondColumns,
+                  firstRow.data[j - firstRow.first]);
+    }
+
+    for (std::size_t k{0U}; k < secondRows; ++k) {
+      const auto [secondFirst, secondLast]{secondBounds[k]};
+      if (secondLast <= secondFirst) {
+        continue;
+      }
+
+      // from the first stored position of the first block to the last one
+      // of the last block, both operands being zeros in between elsewhere
+      const auto begin{(firstRow.first * secondColumns) + secondFirst};
+      const auto end{((firstRow.last - 1U) * secondColumns) + secondLast};
+      simd_kernels::multiplyAddElementwise(
+          repeatedRow.data() + begin, tiledRows.data() + (k * width) + begin,
+          resultRow((i * secondRows) + k) + begin, end - begin);
+    }
+  }
+}
+
+/// @brief helper function to compute the element-wise product of two
+///        matrices of the same dimensions row after row, on the vectorized
+///        kernel over the positions both rows store
+/// @param firstMatrix first operand of the element-wise product
+/// @param secondMatrix second operand of the element-wise product
+/// @param resultRow callable returning pointer to the element at the first
+///        column of a row of the result, the result is expected to be zeroed
+/// @note only the positions both operands store are written, so a result
+///       with packed rows only needs to store the positions either stores
+static void multiplyElementwise(const auto& firstMatrix,
+                                const auto& secondMatrix,
+                                const auto& resultRow) {
+  using value_type = std::remove_cvref_t<decltype(firstMatrix)>::value_type;
+  const auto rows{numberOfRows(firstMatrix)};
+
+  std::vector<value_type> firstBuffer;
+  std::vector<value_type> secondBuffer;
+  for (std::size_t rowIndex{0U}; rowIndex < rows; ++rowIndex) {
+    const auto firstRow{
+        contiguousLine(firstMatrix.rowView(rowIndex), firstBuffer)};
+    const auto secondRow{
+        contiguousLine(secondMatrix.rowView(rowIndex), secondBuffer)};
+
+    const auto first{std::max(firstRow.first, secondRow.first)};
+    const auto last{std::min(firstRow.last, secondRow.last)};
+    if (first < last) {
+      simd_kernels::multiplyAddElementwise(
+          firstRow.data + (first - firstRow.first),
+          secondRow.data + (first - secondRow.first),
+          resultRow(rowIndex) + first, last - first);
+    }
+  }
+}
+
+/// @brief helper function to compute the outer product of two vectors, a
+///        few rows of the result at once, all scaling the second vector
+/// @tparam T type of the elements
+/// @param first the first vector, one element per row of the result
+/// @param rows number of elements of the first vector
+/// @param second the second vector, one element per column of the result
+/// @param columns number of elements of the second vector
+/// @param resultRow callable returning pointer to the first element of a row
+///        of the result, the result is expected to be zeroed
+template <typename T>
+static void multiplyOuter(const T* first, std::size_t rows, const T* second,
+                          std::size_t columns, const auto& resultRow) {
+  // the second vector is loaded once per four rows of the result
+  std::size_t rowIndex{0U};
+  for (; rowIndex + 4U <= rows; rowIndex += 4U) {
+    simd_kernels::multiplyAdd(
+        std::array<T, 4U>{first[rowIndex], first[rowIndex + 1U],
+                          first[rowIndex + 2U], first[rowIndex + 3U]},
+        second,
+        std::array<T*, 4U>{resultRow(rowIndex), resultRow(rowIndex + 1U),
+                           resultRow(rowIndex + 2U),
+                           resultRow(rowIndex + 3U)},
+        columns);
+  }
+
+  for (; rowIndex < rows; ++rowIndex) {
+    simd_kernels::multiplyAdd(std::array<T, 1U>{first[rowIndex]}, second,
+                              std::array<T*, 1U>{resultRow(rowIndex)},
+                              columns);
+  }
+}
+
+}  // namespace matrix_common
+
+/// @brief function to compute the Kronecker product of two matrices of any
+///        types, i.e. the block matrix whose block (i, j) is the second
+///        matrix scaled by the element (i, j) of the first one
+/// @param firstMatrix first operand of the Kronecker product
+/// @param secondMatrix second operand of the Kronecker product
+/// @return DiagonalMatrix for two diagonal operands, LowerTriangularMatrix
+///         for two lower triangular or diagonal ones, UpperTriangularMatrix
+///         for two upper triangular or diagonal ones, NormalMatrix for any
+///         other statically sized operands, whose dimensions are the
+///         products of those of the operands, a DynamicMatrix otherwise
+/// @note the result is written as a stream, row after row, each row being
+///       computed by the vectorized kernels, from rows of the second matrix
+///       tiled beforehand when they are narrow, skipping the blocks outside
+///       the stored range of both operands
+auto kronecker(const auto& firstMatrix, const auto& secondMatrix) {
+  using FirstMatrixType = std::remove_cvref_t<decltype(firstMatrix)>;
+  using SecondMatrixType = std::remove_cvref_t<decltype(secondMatrix)>;
+  using value_type = FirstMatrixType::value_type;
+
+  static_assert(
+      std::is_same_v<typename SecondMatrixType::value_type, value_type>,
+      "Element types are not the same");
+
+  if constexpr (matrix_common::StaticallySized<FirstMatrixType> &&
+                matrix_common::StaticallySized<SecondMatrixType>) {
+    constexpr auto kFirstDimensions{FirstMatrixType::dimensions()};
+    constexpr auto kSecondDimensions{SecondMatrixType::dimensions()};
+    constexpr auto kRows{kFirstDimensions.kRows * kSecondDimensions.kRows};
+    constexpr auto kColumns{kFirstDimensions.kColumns *
+                            kSecondDimensions.kColumns};
+
+    if constexpr (matrix_common::kIsDiagonalMatrixV<FirstMatrixType> &&
+                  matrix_common::kIsDiagonalMatrixV<SecondMatrixType>) {
+      // the diagonal of the product is the outer product of both diagonals
+      constexpr auto kFirstSize{kFirstDimensions.kRows};
+      constexpr auto kSecondSize{kSecondDimensions.kRows};
+      std::array<value_type, kFirstSize> firstDiagonal;
+      std::array<value_type, kSecondSize> secondDiagonal;
+      for (std::size_t i{0U}; i < kFirstSize; ++i) {
+        firstDiagonal[i] = firstMatrix.rowView(i)[i];
+      }
+      for (std::size_t i{0U}; i < kSecondSize; ++i) {
+        secondDiagonal[i] = secondMatrix.rowView(i)[i];
+      }
+
+      std::array<value_type, kRows> resultElements{};
+      matrix_common::multiplyOuter(
+          firstDiagonal.data(), kFirstSize, secondDiagonal.data(), kSecondSize,
+          [&resultElements](std::size_t rowIndex) {
+            return resultElements.data() + (rowIndex * kSecondSize);
+          });
+
+      return matrix_common::diagonalMatrixOf<kRows>(resultElements);
+    } else if constexpr (matrix_common::LowerStructured<FirstMatrixType> &&
+                         matrix_common::LowerStructured<SecondMatrixType>) {
+      LowerTriangularMatrix<kRows, value_type> result;
+      matrix_common::multiplyKronecker(
+          firstMatrix, secondMatrix,
+          [&result](std::size_t rowIndex) { return result.rowData(rowIndex); });
+
+      return result;
+    } else if constexpr (matrix_common::UpperStructured<FirstMatrixType> &&
+                         matrix_common::UpperStructured<SecondMatrixType>) {
+      UpperTriangularMatrix<kRows, value_type> result;
+      matrix_common::multiplyKronecker(firstMatrix, secondMatrix,
+                                       [&result](std::size_t rowIndex) {
+                                         return result.rowData(rowIndex) -
+                                                rowIndex;
+                                       });
+
+      return result;
+    } else {
+      NormalMatrix<kRows, kColumns, value_type> result;
+      matrix_common::multiplyKronecker(
+          firstMatrix, secondMatrix,
+          [&result](std::size_t rowIndex) { return result.rowData(rowIndex); });
+
+      return result;
+    }
+  } else {
+    DynamicMatrix<value_type> result(
+        matrix_common::numberOfRows(firstMatrix) *
+            matrix_common::numberOfRows(secondMatrix),
+        matrix_common::numberOfColumns(firstMatrix) *
+            matrix_common::numberOfColumns(secondMatrix));
+    matrix_common::multiplyKronecker(
+        firstMatrix, secondMatrix,
+        [&result](std::size_t rowIndex) { return result.rowData(rowIndex); });
+
+    return result;
+  }
+}
+
+/// @brief function to compute the element-wise, i.e. Hadamard, product of
+///        two matrices of any types of the same dimensions
+/// @param firstMatrix first operand of the element-wise product
+/// @param secondMatrix second operand of the element-wise product
+/// @return DiagonalMatrix when either operand is diagonal, or one is lower
+///         triangular and the other upper triangular, LowerTriangularMatrix
+///         when either is lower triangular, UpperTriangularMatrix when
+///         either is upper triangular, NormalMatrix for any other statically
+///         sized operands, a DynamicMatrix otherwise
+/// @throw std::invalid_argument if dimensions are not the same
+/// @note only the positions both operands store are multiplied, by the
+///       vectorized kernel, e.g. only the triangle of a triangular operand
+auto hadamard(const auto& firstMatrix, const auto& secondMatrix) {
+  using FirstMatrixType = std::remove_cvref_t<decltype(firstMatrix)>;
+  using SecondMatrixType = std::remove_cvref_t<decltype(secondMatrix)>;
+  using value_type = FirstMatrixType::value_type;
+
+  static_assert(
+      std::is_same_v<typename SecondMatrixType::value_type, value_type>,
+      "Element types are not the same");
+  matrix_common::checkSameDimensions(firstMatrix, secondMatrix,
+                                     "multiply element-wise");
+
+  if constexpr (matrix_common::StaticallySized<FirstMatrixType> &&
+                matrix_common::StaticallySized<SecondMatrixType>) {
+    constexpr auto kRows{FirstMatrixType::dimensions().kRows};
+    constexpr auto kColumns{FirstMatrixType::dimensions().kColumns};
+
+    if constexpr (matrix_common::kIsDiagonalMatrixV<FirstMatrixType> ||
+                  matrix_common::kIsDiagonalMatrixV<SecondMatrixType> ||
+                  (matrix_common::LowerStructured<FirstMatrixType> &&
+                   matrix_common::UpperStructured<SecondMatrixType>) ||
+                  (matrix_common::UpperStructured<FirstMatrixType> &&
+                   matrix_common::LowerStructured<SecondMatrixType>)) {
+      // only the diagonal is stored by either, or by both together
+      std::array<value_type, kRows> resultElements;
+      for (std::size_t i{0U}; i < kRows; ++i) {
+        resultElements[i] =
+            firstMatrix.rowView(i)[i] * secondMatrix.rowView(i)[i];
+      }
+
+      return matrix_common::diagonalMatrixOf<kRows>(resultElements);
+    } else if constexpr (matrix_common::LowerStructured<FirstMatrixType> ||
+                         matrix_common::LowerStructured<SecondMatrixType>) {
+      LowerTriangularMatrix<kRows, value_type> result;
+      matrix_common::multiplyElementwise(
+          firstMatrix, secondMatrix,
+          [&result](std::size_t rowIndex) { return result.rowData(rowIndex); });
+
+      return result;
+    } else if constexpr (matrix_common::UpperStructured<FirstMatrixType> ||
+                         matrix_common::UpperStructured<SecondMatrixType>) {
+      UpperTriangularMatrix<kRows, value_type> result;
+      matrix_common::multiplyElementwise(firstMatrix, secondMatrix,
+                                         [&result](std::size_t rowIndex) {
+                                           return result.rowData(rowIndex) -
+                                                  rowIndex;
+                                         });
+
+      return result;
+    } else {
+      NormalMatrix<kRows, kColumns, value_type> result;
+      matrix_common::multiplyElementwise(
+          firstMatrix, secondMatrix,
+          [&result](std::size_t rowIndex) { return result.rowData(rowIndex); });
+
+      return result;
+    }
+  } else {
+    DynamicMatrix<value_type> result(matrix_common::numberOfRows(firstMatrix),
+                                     matrix_common::numberOfColumns(
+                                         firstMatrix));
+    matrix_common::multiplyElementwise(
+        firstMatrix, secondMatrix,
+        [&result](std::size_t rowIndex) { return result.rowData(rowIndex); });
+
+    return result;
+  }
+}
+
+/// @brief function to compute the outer product of two vectors, i.e. the
+///        matrix whose element (i, j) is the product of the element i of the
+///        first vector by the element j of the second one
+/// @param first contiguous range, e.g. a std::array or a std::vector
+/// @param second contiguous range, of elements of the same type
+/// @return NormalMatrix when both vectors are std::array, whose dimensions
+///         are their sizes, a DynamicMatrix otherwise
+/// @note each row of the result is the second vector scaled, by the
+///       vectorized kernels, four rows at once
+template <std::ranges::contiguous_range First,
+          std::ranges::contiguous_range Second>
+auto outer(const First& first, const Second& second) {
+  using value_type = std::ranges::range_value_t<First>;
+  static_assert(std::is_same_v<std::ranges::range_value_t<Second>, value_type>,
+                "Element types are not the same");
+
+  const auto rows{std::ranges::size(first)};
+  const auto columns{std::ranges::size(second)};
+  if constexpr (requires {
+                  std::tuple_size<First>::value;
+                  std::tuple_size<Second>::value;
+                }) {
+    NormalMatrix<std::tuple_size_v<First>, std::tuple_size_v<Second>,
+                 value_type>
+        result;
+    matrix_common::multiplyOuter(
+        std::ranges::data(first), rows, std::ranges::data(second), columns,
+        [&result](std::size_t rowIndex) { return result.rowData(rowIndex); });
+
+    return result;
+  } else {
+    DynamicMatrix<value_type> result(rows, columns);
+    matrix_common::multiplyOuter(
+        std::ranges::data(first), rows, std::ranges::data(second), columns,
+        [&result](std::size_t rowIndex) { return result.rowData(rowIndex); });
+
+    return result;
+  }
+}
+
+}  // namespace data_structures::matrix_types
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+
+#include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "data-structures/matrix-types/BandedMatrix.hpp"
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SparseMatrix.hpp"
+#include "data-structures/matrix-types/SymmetricMatrix.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief the matrix types a matrix can be stored in, from the most to the
+///        least specialized one
+enum class MatrixStorage : std::uint8_t {
+  kDiagonal,
+  kTridiagonal,
+  kLowerTriangular,
+  kSymmetric,
+  kSparse,
+  kDense
+};
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief helper function to count the non-zero elements of a matrix
+/// @param matrix the matrix in question
+/// @return number of non-zero elements
+static auto countNonZeros(const auto& matrix) -> std::size_t {
+  using value_type = std::remove_cvref_t<decltype(matrix)>::value_type;
+
+  if constexpr (requires { matrix.numberOfNonZeros(); }) {
+    return matrix.numberOfNonZeros();
+  } else {
+    const auto rows{numberOfRows(matrix)};
+
+    std::size_t nonZeros{0U};
+    for (std::size_t rowIndex{0U}; rowIndex < rows; ++rowIndex) {
+      for (const auto& element : matrix.rowView(rowIndex)) {
+        nonZeros += element == value_type{} ? 0U : 1U;
+      }
+    }
+
+    return nonZeros;
+  }
+}
+
+}  // namespace matrix_common
+
+/// @brief function to detect the matrix type storing a matrix in the least
+///        memory without losing any of its elements
+/// @param matrix the matrix in question, of any matrix type
+/// @return the cheapest storage of the matrix
+/// @note the structure is detected first, with early exits, and the non-zeros
+///       are counted to weigh a sparse storage, whose every element costs an
+///       index besides its value, against the structures found, the most
+///       specialized one being kept on ties
+auto cheapestStorage(const auto& matrix) -> MatrixStorage {
+  using value_type = std::remove_cvref_t<decltype(matrix)>::value_type;
+  const auto rows{matrix_common::numberOfRows(matrix)};
+  const auto columns{matrix_common::numberOfColumns(matrix)};
+
+  if (matrix.isDiagonal()) {
+    return MatrixStorage::kDiagonal;
+  }
+
+  auto storage{MatrixStorage::kSparse};
+  auto bytes{(matrix_common::countNonZeros(matrix) *
+              (sizeof(value_type) + sizeof(std::size_t))) +
+             ((rows + 1U) * sizeof(std::size_t))};
+  const auto keepIfCheaper{[&storage, &bytes](MatrixStorage candidate,
+                                              std::size_t candidateBytes) {
+    if (candidateBytes <= bytes) {
+      storage = candidate;
+      bytes = candidateBytes;
+    }
+  }};
+
+  // candidates from the least to the most specialized, so the latter win ties
+  keepIfCheaper(MatrixStorage::kDense, rows * columns * sizeof(value_type));
+  if (rows == columns) {
+    const auto triangleBytes{matrix_common::numberOfTriangleElements(rows) *
+                             sizeof(value_type)};
+    if (matrix.isSymmetric()) {
+      keepIfCheaper(MatrixStorage::kSymmetric, triangleBytes);
+    }
+    if (matrix.isLowerTriangular()) {
+      keepIfCheaper(MatrixStorage::kLowerTriangular, triangleBytes);
+    }
+    if (matrix.isBanded(1U)) {
+      keepIfCheaper(MatrixStorage::kTridiagonal,
+                    3U * rows * sizeof(value_type));
+    }
+  }
+
+  return storage;
+}
+
+/// @brief type alias for all the matrix types a square matrix of known size
+///        can be stored in
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix
+template <common::NaturalNumber auto N, typename T>
+using AnyStorageMatrix =
+    std::variant<DiagonalMatrix<N, T>, TridiagonalMatrix<N, T>,
+                 LowerTriangularMatrix<N, T>, SymmetricMatrix<N, T>,
+                 CsrMatrix<T>, NormalMatrix<N, N, T>>;
+
+/// @brief function to convert a square matrix to its cheapest storage
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix
+/// @param matrix the matrix to be converted
+/// @return the matrix converted to the type picked by cheapestStorage()
+template <common::NaturalNumber auto N, typename T>
+auto toCheapestStorage(const NormalMatrix<N, N, T>& matrix)
+    -> AnyStorageMatrix<N, T> {
+  switch (cheapestStorage(matrix)) {
+    case MatrixStorage::kDiagonal:
+      return DiagonalMatrix<N, T>{matrix};
+    case MatrixStorage::kTridiagonal:
+      return TridiagonalMatrix<N, T>{matrix};
+    case MatrixStorage::kLowerTriangular:
+      return LowerTriangularMatrix<N, T>{matrix};
+    case MatrixStorage::kSymmetric:
+      return SymmetricMatrix<N, T>{matrix};
+    case MatrixStorage::kSparse:
+      return CsrMatrix<T>{matrix};
+    case MatrixStorage::kDense:
+      break;
+  }
+
+  return matrix;
+}
+
+}  // namespace data_structures::matrix_types
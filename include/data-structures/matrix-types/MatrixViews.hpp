@@ -0,0 +1,398 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief mapping of a line stored with a constant stride, where only the
+///        logical indices [first, last) are stored, and the rest are known
+///        to be zeros, e.g. a row of a lower triangular matrix
+/// @note it plays the role of the layout mapping of std::mdspan, adding the
+///       notion of structural zeros needed by packed matrices types
+struct StridedMapping {
+  /// @brief first stored logical index
+  std::size_t first;
+
+  /// @brief past the last stored logical index
+  std::size_t last;
+
+  /// @brief distance between two consecutive stored elements
+  std::size_t stride;
+
+  /// @brief method to check whether an index is stored or is a zero
+  /// @param index logical index in the line
+  /// @return true if the element at the index is stored
+  [[nodiscard]] constexpr auto isStored(std::size_t index) const noexcept {
+    return index >= first && index < last;
+  }
+
+  /// @brief method to map a stored logical index to its storage offset
+  /// @param index logical index in the line
+  /// @return offset from the first stored element
+  [[nodiscard]] constexpr auto offset(std::size_t index) const noexcept {
+    return (index - first) * stride;
+  }
+};
+
+/// @brief mapping of a column of a lower triangle packed row by row, where
+///        the distance between consecutive elements grows by one each row
+struct PackedLowerColumnMapping {
+  /// @brief index of the column, i.e. the first stored logical index
+  std::size_t first;
+
+  /// @brief past the last stored logical index, i.e. the number of rows
+  std::size_t last;
+
+  /// @brief method to check whether an index is stored or is a zero
+  /// @param index logical index in the line
+  /// @return true if the element at the index is stored
+  [[nodiscard]] constexpr auto isStored(std::size_t index) const noexcept {
+    return index >= first && index < last;
+  }
+
+  /// @brief method to map a stored logical index to its storage offset
+  /// @param index logical index in the line
+  /// @return offset from the first stored element
+  [[nodiscard]] constexpr auto offset(std::size_t index) const noexcept {
+    return ((index * (index + 1U)) - (first * (first + 1U))) / 2U;
+  }
+};
+
+/// @brief mapping of a column of an upper triangle packed row by row, where
+///        the distance between consecutive elements shrinks by one each row
+struct PackedUpperColumnMapping {
+  /// @brief first stored logical index, i.e. always the first row
+  std::size_t first;
+
+  /// @brief past the last stored logical index, i.e. past the diagonal
+  std::size_t last;
+
+  /// @brief number of rows, and columns, of the matrix
+  std::size_t size;
+
+  /// @brief method to check whether an index is stored or is a zero
+  /// @param index logical index in the line
+  /// @return true if the element at the index is stored
+  [[nodiscard]] constexpr auto isStored(std::size_t index) const noexcept {
+    return index >= first && index < last;
+  }
+
+  /// @brief method to map a stored logical index to its storage offset
+  /// @param index logical index in the line
+  /// @return offset from the element of the first row
+  [[nodiscard]] constexpr auto offset(std::size_t index) const noexcept {
+    return (index * ((2U * size) - index - 1U)) / 2U;
+  }
+};
+
+/// @brief mapping of a row, or a column, of a symmetric matrix of which only
+///        the lower triangle is packed row by row, the line is read along its
+///        packed row up to the diagonal, then down its packed column
+struct PackedSymmetricMapping {
+  /// @brief first stored logical index, i.e. always zero
+  std::size_t first;
+
+  /// @brief past the last stored logical index, i.e. the size of the line
+  std::size_t last;
+
+  /// @brief index of the line, i.e. of its element on the diagonal
+  std::size_t line;
+
+  /// @brief method to check whether an index is stored or is a zero
+  /// @param index logical index in the line
+  /// @return true if the element at the index is stored
+  [[nodiscard]] constexpr auto isStored(std::size_t index) const noexcept {
+    return index >= first && index < last;
+  }
+
+  /// @brief method to map a stored logical index to its storage offset
+  /// @param index logical index in the line
+  /// @return offset from the first element of the packed row of the line
+  [[nodiscard]] constexpr auto offset(std::size_t index) const noexcept {
+    if (index <= line) {
+      return index;
+    }
+
+    return ((index * (index + 1U)) / 2U) + line - ((line * (line + 1U)) / 2U);
+  }
+};
+
+/// @brief non-owning view of a row or a column of a matrix, reading the
+///        elements directly from the storage of the matrix
+/// @tparam T type of the elements
+/// @tparam Mapping mapping of logical indices to storage offsets
+/// @note the view must not outlive the matrix it was taken from
+template <typename T, typename Mapping = StridedMapping>
+class LineView {
+public:
+  /// @brief iterator over all the elements of the line, zeros included
+  struct Iterator {
+    /// @brief C++ expects some properties from an iterator
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = void;
+    using reference = T;
+
+    /// @brief dereference operator
+    constexpr auto operator*() const { return (*m_view)[m_index]; }
+
+    /// @brief prefix increment operator
+    /// @return incremented iterator
+    constexpr auto operator++() noexcept -> Iterator& {
+      ++m_index;
+      return *this;
+    }
+
+    /// @brief postfix increment operator
+    /// @return iterator before incrementing
+    constexpr auto operator++(int) noexcept -> Iterator {
+      auto copy{*this};
+      ++m_index;
+      return copy;
+    }
+
+    /// @brief equality operator
+    constexpr auto operator==(const Iterator& other) const noexcept
+        -> bool = default;
+
+    /// @brief the view iterated over
+    const LineView* m_view{nullptr};
+
+    /// @brief logical index the iterator is pointing at
+    std::size_t m_index{0U};
+  };
+
+  /// @brief type alias for T, as for standard containers
+  using value_type = T;
+
+  /// @brief default constructor of an empty view
+  constexpr LineView() = default;
+
+  /// @brief constructor of a view
+  /// @param data pointer to the first stored element of the line
+  /// @param size logical length of the line, zeros included
+  /// @param mapping mapping of logical indices to storage offsets
+  constexpr LineView(const T* data, std::size_t size, Mapping mapping) noexcept
+      : m_data{data}, m_size{size}, m_mapping{mapping} {}
+
+  /// @brief method to show the length of the line, zeros included
+  /// @return length of the line
+  [[nodiscard]] constexpr auto size() const noexcept { return m_size; }
+
+  /// @brief method to return the pointer to the first stored element
+  /// @return pointer to the first stored element
+  [[nodiscard]] constexpr auto data() const noexcept { return m_data; }
+
+  /// @brief method to return the mapping of the view
+  /// @return mapping of logical indices to storage offsets
+  [[nodiscard]] constexpr auto mapping() const noexcept { return m_mapping; }
+
+  /// @brief subscript operator
+  /// @param index logical index in the line
+  /// @return the element at the index, zero if it is not stored
+  constexpr auto operator[](std::size_t index) const -> T {
+    return m_mapping.isStored(index) ? m_data[m_mapping.offset(index)] : T{};
+  }
+
+  /// @brief method that returns iterator to first element
+  [[nodiscard]] constexpr auto begin() const noexcept {
+    return Iterator{this, 0U};
+  }
+
+  /// @brief method that returns iterator past the last element
+  [[nodiscard]] constexpr auto end() const noexcept {
+    return Iterator{this, m_size};
+  }
+
+  /// @brief method to copy a range of the line, walking the storage directly
+  ///        and writing zeros for the elements that are not stored
+  /// @param begin first logical index to copy
+  /// @param end past the last logical index to copy
+  /// @param out iterator to the beginning of the destination
+  /// @return iterator past the last element written
+  /// @note contiguous elements of 16-bit floating point types copied to
+  ///       floats, or the other way around, are converted by the vectorized
+  ///       kernels, e.g. when such a matrix is packed to be multiplied
+  constexpr auto copyTo(std::size_t begin, std::size_t end, auto out) const {
+    const auto storedBegin{std::clamp(m_mapping.first, begin, end)};
+    const auto storedEnd{std::clamp(m_mapping.last, storedBegin, end)};
+
+    out = std::fill_n(out, storedBegin - begin, T{});
+    if constexpr (std::same_as<Mapping, StridedMapping> &&
+                  std::contiguous_iterator<decltype(out)>) {
+      if constexpr (simd_kernels::VectorConvertible<
+                        T, std::iter_value_t<decltype(out)>>) {
+        if !consteval {
+          if (m_mapping.stride == 1U) {
+            const auto count{storedEnd - storedBegin};
+            simd_kernels::convert(m_data + m_mapping.offset(storedBegin),
+                                  std::to_address(out), count);
+            return std::fill_n(out + static_cast<std::ptrdiff_t>(count),
+                               end - storedEnd, T{});
+          }
+        }
+      }
+    }
+
+    for (auto index{storedBegin}; index < storedEnd; ++index) {
+      *out++ = m_data[m_mapping.offset(index)];
+    }
+
+    return std::fill_n(out, end - storedEnd, T{});
+  }
+
+  /// @brief overload of the method above copying the whole line
+  /// @param out iterator to the beginning of the destination
+  /// @return iterator past the last element written
+  constexpr auto copyTo(auto out) const { return copyTo(0U, m_size, out); }
+
+  /// @brief equality operator with a view of any mapping
+  /// @param other the other view to compare against
+  /// @return whether both lines have the same elements or not
+  template <typename OtherMapping>
+  constexpr auto operator==(const LineView<T, OtherMapping>& other) const
+      -> bool {
+    return m_size == other.size() && std::equal(begin(), end(), other.begin());
+  }
+
+private:
+  /// @brief pointer to the first stored element
+  const T* m_data{nullptr};
+
+  /// @brief logical length of the line, zeros included
+  std::size_t m_size{0U};
+
+  /// @brief mapping of logical indices to storage offsets
+  Mapping m_mapping{};
+};
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief iterator for matrix rows, yielding views of them
+/// @tparam MatrixT type of the matrix iterated over
+template <typename MatrixT>
+struct RowsIterator {
+  /// @brief C++ expects some properties from an iterator
+  using iterator_category = std::forward_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = decltype(std::declval<const MatrixT&>().rowView(0U));
+  using pointer = value_type*;
+  using reference = value_type&;
+
+  /// @brief type alias for const ref to matrix
+  using cmatrix_ref = const MatrixT&;
+
+  /// @brief constructor for the iterator
+  /// @param matrix the matrix  which we are iterating over
+  /// @param index the start index of iteration which defaults
+  ///               to the beginning
+  explicit constexpr RowsIterator(cmatrix_ref matrix, std::size_t index = 0U)
+      : m_matrix{&matrix}, m_index{index} {}
+
+  /// @brief method that returns iterator to first row
+  /// @return iterator pointing to the first row
+  constexpr auto begin() const noexcept { return RowsIterator{*m_matrix}; }
+
+  /// @brief method that returns iterator past the last row
+  /// @return iterator pointing to past the last row
+  constexpr auto end() const noexcept {
+    return RowsIterator{*m_matrix, numberOfRows(*m_matrix)};
+  }
+
+  /// @brief prefix increment operator
+  /// @return incremented iterator
+  constexpr auto operator++() noexcept -> auto& {
+    ++m_index;
+    return *this;
+  }
+
+  /// @brief dereference operator
+  constexpr auto operator*() const { return m_matrix->rowView(m_index); }
+
+  /// @brief unequality operator
+  /// @param other the other iterator to compare against
+  /// @return whether both iterators are not pointing to the same row
+  ///         in the same matrix or not
+  constexpr auto operator!=(const RowsIterator& other) const noexcept -> bool {
+    return (m_matrix != other.m_matrix) || (m_index != other.m_index);
+  };
+
+private:
+  /// @brief pointer to the matrix to be iteraterated over
+  const MatrixT* m_matrix;
+
+  /// @brief index to keep track of the current position of the oterator
+  std::size_t m_index;
+};
+
+/// @brief iterator for matrix columns, yielding views of them
+/// @tparam MatrixT type of the matrix iterated over
+template <typename MatrixT>
+struct ColumnsIterator {
+  /// @brief C++ expects some properties from an iterator
+  using iterator_category = std::forward_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = decltype(std::declval<const MatrixT&>().columnView(0U));
+  using pointer = value_type*;
+  using reference = value_type&;
+
+  /// @brief type alias for const ref to matrix
+  using cmatrix_ref = const MatrixT&;
+
+  /// @brief constructor for the iterator
+  /// @param matrix the matrix  which we are iterating over
+  /// @param index the start index of iteration which defaults
+  ///               to the beginning
+  explicit constexpr ColumnsIterator(cmatrix_ref matrix, std::size_t index = 0U)
+      : m_matrix{&matrix}, m_index{index} {}
+
+  /// @brief method that returns iterator to first column
+  /// @return iterator pointing to the first column
+  constexpr auto begin() const noexcept { return ColumnsIterator{*m_matrix}; }
+
+  /// @brief method that returns iterator past the last column
+  /// @return iterator pointing to past the last column
+  constexpr auto end() const noexcept {
+    return ColumnsIterator{*m_matrix, numberOfColumns(*m_matrix)};
+  }
+
+  /// @brief prefix increment operator
+  /// @return incremented iterator
+  constexpr auto operator++() noexcept -> auto& {
+    ++m_index;
+    return *this;
+  }
+
+  /// @brief dereference operator
+  constexpr auto operator*() const { return m_matrix->columnView(m_index); }
+
+  /// @brief unequality operator
+  /// @param other the other iterator to compare against
+  /// @return whether both iterators are not pointing to the same column
+  ///         in the same matrix or not
+  constexpr auto operator!=(const ColumnsIterator& other) const noexcept
+      -> bool {
+    return (m_matrix != other.m_matrix) || (m_index != other.m_index);
+  };
+
+private:
+  /// @brief pointer to the matrix to be iteraterated over
+  const MatrixT* m_matrix;
+
+  /// @brief index to keep track of the current position of the oterator
+  std::size_t m_index;
+};
+
+}  // namespace matrix_common
+
+}  // namespace data_structures::matrix_types
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/AccumulatedMultiplication.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/HalfPrecision.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixFormat.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief function to convert the elements of a matrix of any type to
+///        another element type, e.g. to store a float matrix in Float16 or
+///        BFloat16, row after row through the vectorized kernels
+/// @tparam To type of the elements of the converted matrix
+/// @param matrix the matrix to be converted
+/// @return NormalMatrix of To elements when the matrix is statically sized,
+///         a DynamicMatrix of them otherwise
+/// @note conversions to 16-bit floating point types round to nearest, ties
+///       to even
+template <typename To>
+auto convertMatrix(const auto& matrix) {
+  using MatrixT = std::remove_cvref_t<decltype(matrix)>;
+
+  const auto columns{matrix_common::numberOfColumns(matrix)};
+  if constexpr (matrix_common::StaticallySized<MatrixT>) {
+    constexpr auto kRows{MatrixT::dimensions().kRows};
+    constexpr auto kColumns{MatrixT::dimensions().kColumns};
+
+    std::array<std::array<To, kColumns>, kRows> elements;
+    matrix_common::forEachContiguousRow(
+        matrix, [&elements, columns](std::size_t rowIndex, const auto* row) {
+          simd_kernels::convert(row, elements[rowIndex].data(), columns);
+        });
+
+    return NormalMatrix<kRows, kColumns, To>{elements};
+  } else {
+    DynamicMatrix<To> result(matrix_common::numberOfRows(matrix), columns);
+    matrix_common::forEachContiguousRow(
+        matrix, [&result, columns](std::size_t rowIndex, const auto* row) {
+          simd_kernels::convert(row, result.rowData(rowIndex), columns);
+        });
+
+    return result;
+  }
+}
+
+/// @brief function to multiply two matrices whose elements may be of
+///        different types, e.g. stored in Float16 or BFloat16 to halve the
+///        memory they are read from, with explicit accumulator and result
+///        types
+/// @tparam Accumulator type the elements are multiplied and accumulated in,
+///         e.g. float
+/// @tparam Result type of the elements of the product, the accumulator type
+///         by default
+/// @param firstMatrix first operand of matrices multiplication
+/// @param secondMatrix second operand of matrices multiplication
+/// @param executor optional executor to run the multiplication on, otherwise
+///        it runs as the products of operator* do
+/// @return NormalMatrix of Result elements when both operands are statically
+///         sized, a DynamicMatrix of them otherwise
+/// @throw std::invalid_argument if dimensions are not compatible
+/// @note the operands are converted to the accumulator type while they are
+///       packed, by the vectorized kernels for 16-bit floating point types,
+///       so that the product itself runs on the kernels of the accumulator
+///       type, as the product of matrices of that type would
+template <typename Accumulator, typename Result = Accumulator>
+auto multiplyMixed(const auto& firstMatrix, const auto& secondMatrix,
+                   common::Executor auto&... executor) {
+  static_assert(
+      std::convertible_to<
+          typename std::remove_cvref_t<decltype(firstMatrix)>::value_type,
+          Accumulator> &&
+          std::convertible_to<
+              typename std::remove_cvref_t<decltype(secondMatrix)>::value_type,
+              Accumulator>,
+      "Elements are not convertible to the accumulator type");
+
+  auto product{
+      matrix_common::multiplyAccumulated<WidenedAccumulation<Accumulator>>(
+          firstMatrix, secondMatrix, executor...)};
+
+  if constexpr (std::same_as<Result, Accumulator>) {
+    return product;
+  } else {
+    return convertMatrix<Result>(product);
+  }
+}
+
+}  // namespace data_structures::matrix_types
@@ -2,17 +2,27 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <concepts>
 #include <cstddef>
 #include <format>
 #include <initializer_list>
 #include <iterator>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
 #include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/FastMultiplication.hpp"
 #include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixFormat.hpp"
+#include "data-structures/matrix-types/MatrixViews.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
 
 /// @brief namespace for matrices types
 namespace data_structures::matrix_types {
@@ -43,116 +53,9 @@ class NormalMatrix {
             common::NaturalNumber auto Cs = COLUMNS>
   using ElementsType = std::array<std::array<T, Cs>, Rs>;
 
-  /// @brief iterator for matrix rows
-  struct RowsIterator {
-    /// @brief C++ expects some properties from an iterator
-    using iterator_category = std::forward_iterator_tag;
-    using difference_type = std::ptrdiff_t;
-    using value_type = RowType<>;
-    using pointer = value_type*;
-    using reference = value_type&;
-
-    /// @brief type alias for const ref to matrix
-    using cmatrix_ref = const NormalMatrix<ROWS, COLUMNS>&;
-
-    /// @brief constructor for the iterator
-    /// @param matrix the matrix  which we are iterating over
-    /// @param index the start index of iteration which defaults
-    ///               to the beginning
-    explicit constexpr RowsIterator(cmatrix_ref matrix, std::size_t index = 0U)
-        : m_matrix{matrix}, m_index{index} {}
-
-    /// @brief method that returns iterator to first row
-    /// @return iterator pointing to the first row
-    constexpr auto begin() const noexcept { return RowsIterator{m_matrix}; }
-
-    /// @brief method that returns iterator past the last row
-    /// @return iterator pointing to past the last row
-    constexpr auto end() const noexcept { return RowsIterator{m_matrix, ROWS}; }
-
-    /// @brief prefix increment operator
-    /// @return incremented iterator
-    constexpr auto operator++() noexcept -> auto& {
-      ++m_index;
-      return *this;
-    }
-
-    /// @brief dereference operator
-    constexpr auto operator*() const { return m_matrix.row(m_index); }
-
-    /// @brief unequality operator
-    /// @param other the other iterator to compare against
-    /// @return whether both iterators are not pointing to the same row
-    ///         in the same matrix or not
-    constexpr auto operator!=(const auto& other) noexcept -> bool {
-      return (&m_matrix != &other.m_matrix) || (m_index != other.m_index);
-    };
-
-  private:
-    /// @brief const reference to the matrix to be iteraterated over
-    // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
-    cmatrix_ref m_matrix;
-
-    /// @brief index to keep track of the current position of the oterator
-    std::size_t m_index;
-  };
-
-  /// @brief iterator for matrix columns
-  struct ColumnsIterator {
-    /// @brief C++ expects some properties from an iterator
-    using iterator_category = std::forward_iterator_tag;
-    using difference_type = std::ptrdiff_t;
-    using value_type = ColumnType<>;
-    using pointer = value_type*;
-    using reference = value_type&;
-
-    /// @brief type alias for const ref to matrix
-    using cmatrix_ref = const NormalMatrix<ROWS, COLUMNS>&;
-
-    /// @brief constructor for the iterator
-    /// @param matrix the matrix  which we are iterating over
-    /// @param index the start index of iteration which defaults
-    ///               to the beginning
-    explicit constexpr ColumnsIterator(cmatrix_ref matrix,
-                                       std::size_t index = 0U)
-        : m_matrix{matrix}, m_index{index} {}
-
-    /// @brief method that returns iterator to first column
-    /// @return iterator pointing to the first column
-    constexpr auto begin() const noexcept { return ColumnsIterator{m_matrix}; }
-
-    /// @brief method that returns iterator past the last column
-    /// @return iterator pointing to past the last column
-    constexpr auto end() const noexcept {
-      return ColumnsIterator{m_matrix, COLUMNS};
-    }
-
-    /// @brief prefix increment operator
-    /// @return incremented iterator
-    constexpr auto operator++() noexcept -> auto& {
-      ++m_index;
-      return *this;
-    }
-
-    /// @brief dereference operator
-    constexpr auto operator*() const { return m_matrix.column(m_index); }
-
-    /// @brief unequality operator
-    /// @param other the other iterator to compare against
-    /// @return whether both iterators are not pointing to the same column
-    ///         in the same matrix or not
-    constexpr auto operator!=(const auto& other) noexcept -> bool {
-      return (&m_matrix != &other.m_matrix) || (m_index != other.m_index);
-    };
-
-  private:
-    /// @brief const reference to the matrix to be iteraterated over
-    // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
-    cmatrix_ref m_matrix;
-
-    /// @brief index to keep track of the current position of the oterator
-    std::size_t m_index{0U};
-  };
+  /// @brief type alias for the storage of the elements, kept flat row by
+  ///        row, so that rows and columns can be viewed with a stride
+  using StorageType = std::array<T, ROWS * COLUMNS>;
 
 public:
   /// @brief constructor that accepts multiple braced init lists
@@ -163,15 +66,17 @@ public:
   ///       are ignored
   template <typename... Rows>
   constexpr explicit NormalMatrix(std::initializer_list<Rows>&&... rows)
-      : m_elements{fillToMatrixRow(
-            std::forward<std::initializer_list<Rows>>(rows))...} {}
+      : m_elements{fillElements(fillToMatrixRow(
+            std::forward<std::initializer_list<Rows>>(rows))...)} {}
 
   /// @brief overload to the constuctor that accepts 2D array to set the
   ///        elements  directly
   /// @param elements elements of the 2D array
   /// @note this constructor is especially useful for multiplication operator
-  constexpr explicit NormalMatrix(ElementsType<> elements)
-      : m_elements{std::move(elements)} {}
+  constexpr explicit NormalMatrix(const ElementsType<>& elements)
+      : m_elements{std::apply(
+            [](const auto&... rows) { return fillElements(rows...); },
+            elements)} {}
 
   /// @brief a constexpr method to return the [n*m] dimensions of the matrix
   /// @return a MatrixDimension object representing [n*m] dimensions
@@ -182,7 +87,12 @@ public:
   /// @brief method to return the row in matrix at a given index
   /// @param index at which row should be returned
   /// @return the row at the given index
-  constexpr auto row(std::size_t index) const { return m_elements[index]; }
+  constexpr auto row(std::size_t index) const {
+    RowType<> row;
+    rowView(index).copyTo(row.begin());
+
+    return row;
+  }
 
   /// @brief method to return the column at the given index
   /// @param index order of the column in the matrix
@@ -194,26 +104,76 @@ public:
     }
 
     ColumnType<> column;
-    std::transform(
-        m_elements.cbegin(), m_elements.cend(), column.begin(),
-        [columnIndex = index](const auto& row) { return row[columnIndex]; });
+    columnView(index).copyTo(column.begin());
 
     return column;
   }
 
+  /// @brief method to return a view of the row at a given index, reading
+  ///        directly from the elements of the matrix
+  /// @param index at which row should be viewed
+  /// @return contiguous view of the row at the given index
+  /// @note no range checking is done here
+  constexpr auto rowView(std::size_t index) const noexcept {
+    return LineView<T>{rowData(index), COLUMNS, {0U, COLUMNS, 1U}};
+  }
+
+  /// @brief method to return a view of the column at a given index, reading
+  ///        directly from the elements of the matrix
+  /// @param index at which column should be viewed
+  /// @return view of the column at the given index, strided by a row
+  /// @note no range checking is done here
+  constexpr auto columnView(std::size_t index) const noexcept {
+    return LineView<T>{m_elements.data() + index, ROWS, {0U, ROWS, COLUMNS}};
+  }
+
+  /// @brief method to return pointer to the first element of a row
+  /// @param index index of the row
+  /// @return pointer to the first element of the row at the given index
+  /// @note no range checking is done here
+  constexpr auto rowData(std::size_t index) const noexcept -> const T* {
+    return m_elements.data() + (index * COLUMNS);
+  }
+
+  /// @brief non-const overload of the method above
+  constexpr auto rowData(std::size_t index) noexcept -> T* {
+    return m_elements.data() + (index * COLUMNS);
+  }
+
   /// @brief method that returns RowsIterator to traverse through each row
-  /// @return RowsIterator object pointing to first row
-  constexpr auto rows() const noexcept { return RowsIterator(*this); }
+  /// @return RowsIterator object pointing to first row, yielding views
+  constexpr auto rows() const noexcept {
+    return matrix_common::RowsIterator<NormalMatrix>(*this);
+  }
 
   /// @brief method that returns ColumnsIterator to traverse through
   ///        each column
-  /// @return ColumnsIterator object pointing to first column
-  constexpr auto columns() const noexcept { return ColumnsIterator(*this); }
+  /// @return ColumnsIterator object pointing to first column, yielding views
+  constexpr auto columns() const noexcept {
+    return matrix_common::ColumnsIterator<NormalMatrix>(*this);
+  }
 
   /// @brief generic multiplication operator
   /// @param otherMatrix the second operand of multiplication
   /// @return NormalMatrix  containing the result of the multiplication
+  /// @note large products run in parallel, see
+  ///       matrix_common::parallelThreshold()
   auto operator*(const auto& otherMatrix) const {
+    return multiply(otherMatrix);
+  }
+
+  /// @brief generic multiplication method that optionally accepts the
+  ///        executor to run on, e.g. a common::ThreadPool shared by several
+  ///        products
+  /// @param otherMatrix the second operand of multiplication
+  /// @param executor optional executor to run the multiplication on
+  /// @return NormalMatrix  containing the result of the multiplication
+  /// @note square products of unsigned or floating point elements switch to
+  ///       Strassen-Winograd from matrix_common::strassenThreshold() on
+  auto multiply(const auto& otherMatrix,
+                common::Executor auto&... executor) const {
+    static_assert(sizeof...(executor) <= 1U, "Only one executor is accepted");
+
     // assert both types are the same
     using OtherMatrixType =
         std::remove_const_t<std::remove_reference_t<decltype(otherMatrix)>>;
@@ -222,60 +182,237 @@ public:
         std::is_same_v<typename OtherMatrixType::value_type, value_type>,
         "Element types are not the same");
 
-    // assert dimensons are compatible
-    static_assert(COLUMNS == otherMatrix.dimensions().kRows);
+    if constexpr (!matrix_common::StaticallySized<OtherMatrixType>) {
+      // dimensions of the result are only known at runtime
+      return multiplyToDynamicMatrix(*this, otherMatrix, executor...);
+    } else {
+      // assert dimensons are compatible
+      static_assert(COLUMNS == otherMatrix.dimensions().kRows);
+
+      constexpr auto kNoOfOtherMatrixColumns{otherMatrix.dimensions().kColumns};
+      if constexpr (kHasPackedRowsV<OtherMatrixType>) {
+        // only the stored part of each row of the other matrix is walked
+        ElementsType<ROWS, kNoOfOtherMatrixColumns> resultElements{};
+        matrix_common::multiplyStoredElements(
+            *this, otherMatrix,
+            [&resultElements](std::size_t rowIndex) {
+              return resultElements[rowIndex].data();
+            },
+            executor...);
+
+        return NormalMatrix<ROWS, kNoOfOtherMatrixColumns, T>{resultElements};
+      } else {
+        ElementsType<ROWS, kNoOfOtherMatrixColumns> resultElements;
+        if constexpr (std::is_same_v<OtherMatrixType, NormalMatrix> &&
+                      ROWS == COLUMNS &&
+                      (std::floating_point<T> || std::unsigned_integral<T>)) {
+          // large square products recurse by Strassen-Winograd, whose
+          // subtractions would overflow signed integers
+          if (ROWS >= matrix_common::strassenThreshold().load(
+                          std::memory_order_relaxed)) {
+            matrix_common::multiplyStrassenWinograd(
+                *this, otherMatrix, resultElements, executor...);
+
+            return NormalMatrix{resultElements};
+          }
+        }
+
+        matrix_common::multiplyRowsByColumns(*this, otherMatrix,
+                                             resultElements, executor...);
+
+        return NormalMatrix<ROWS, kNoOfOtherMatrixColumns, T>{resultElements};
+      }
+    }
+  }
+
+  /// @brief compound addition operator, adding another matrix of the same
+  ///        dimensions to this one in place
+  /// @param otherMatrix the matrix to add, of any matrix type
+  /// @return reference to this matrix
+  /// @throw std::invalid_argument if the other matrix is only sized at
+  ///        runtime, and its dimensions are not the same
+  auto operator+=(const auto& otherMatrix) -> NormalMatrix& {
+    return accumulate(otherMatrix, T{1}, "add");
+  }
+
+  /// @brief compound subtraction operator, subtracting another matrix of the
+  ///        same dimensions from this one in place
+  /// @param otherMatrix the matrix to subtract, of any matrix type
+  /// @return reference to this matrix
+  /// @throw std::invalid_argument if the other matrix is only sized at
+  ///        runtime, and its dimensions are not the same
+  auto operator-=(const auto& otherMatrix) -> NormalMatrix& {
+    return accumulate(otherMatrix, T{} - T{1}, "subtract");
+  }
+
+  /// @brief compound multiplication operator by a square matrix, whose
+  ///        product by this one is a NormalMatrix of the same dimensions
+  /// @tparam OtherMatrixT type of the other matrix
+  /// @param otherMatrix the second operand of multiplication
+  /// @return reference to this matrix
+  /// @note dense products are written over this matrix, both operands being
+  ///       packed first in matrix_common::threadWorkspace(), so repeated
+  ///       products allocate nothing once it has grown. Products skipping the
+  ///       structural zeros of the other matrix are computed on the stack
+  ///       before they are assigned, since their elements depend on the ones
+  ///       they overwrite
+  template <MatrixAdtConcept OtherMatrixT>
+    requires std::is_same_v<decltype(std::declval<const NormalMatrix&>() *
+                                     std::declval<const OtherMatrixT&>()),
+                            NormalMatrix>
+  auto operator*=(const OtherMatrixT& otherMatrix) -> NormalMatrix& {
+    if constexpr (kHasPackedRowsV<OtherMatrixT>) {
+      *this = multiply(otherMatrix);
+    } else {
+      matrix_common::multiplyInto(*this, otherMatrix, *this,
+                                  matrix_common::threadWorkspace<T>());
+    }
+
+    return *this;
+  }
+
+  /// @brief compound multiplication operator by a scalar
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  constexpr auto operator*=(const T& factor) noexcept -> NormalMatrix& {
+    return scale(factor);
+  }
+
+  /// @brief method to multiply all elements by a scalar in place
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  constexpr auto scale(const T& factor) noexcept -> NormalMatrix& {
+    for (auto& element : m_elements) {
+      element *= factor;
+    }
+
+    return *this;
+  }
+
+  /// @brief method to return the transpose of the matrix
+  /// @return new [COLUMNS*ROWS] matrix holding the transpose
+  /// @note the transpose is blocked recursively down to tiles fitting in
+  ///       cache, and each tile is transposed with SIMD shuffles
+  auto transpose() const -> NormalMatrix<COLUMNS, ROWS, T> {
+    NormalMatrix<COLUMNS, ROWS, T> result{};
+    matrix_common::transposeRecursive(m_elements.data(), COLUMNS,
+                                      result.rowData(0U), ROWS, ROWS, COLUMNS);
+
+    return result;
+  }
 
-    constexpr auto kNoOfOtherMatrixColumns{otherMatrix.dimensions().kColumns};
-    ElementsType<ROWS, kNoOfOtherMatrixColumns> resultElements;
-    matrix_common::multiplyRowsByColumns(*this, otherMatrix, resultElements);
+  /// @brief method to transpose a square matrix in place
+  /// @return reference to this matrix
+  auto transposeInPlace() -> NormalMatrix&
+    requires(ROWS == COLUMNS)
+  {
+    matrix_common::transposeSquareInPlace(m_elements.data(), COLUMNS, ROWS);
 
-    return NormalMatrix<ROWS, kNoOfOtherMatrixColumns>{resultElements};
+    return *this;
   }
 
   /// @brief method to check whether matrix type is symmetric or not
   /// @return true if matrix is symmetric, false otherwise
+  /// @note it compares rows against transposed tiles of the mirrored rows
+  ///       instead of walking columns, and stops at the first mismatch
   constexpr auto isSymmetric() const noexcept {
     if constexpr (ROWS != COLUMNS) {
       return false;
     } else {  // it gives compilation errors on different sizes
               // without this else
-      auto rIt{rows().begin()};
-      auto cIt{columns().begin()};
-      for (; rIt != rows().end() && cIt != columns().end(); ++rIt, ++cIt) {
-        if (*rIt != *cIt) {
-          return false;
+      if consteval {
+        for (std::size_t i{0U}; i < ROWS; ++i) {
+          for (std::size_t j{0U}; j < i; ++j) {
+            if (rowData(i)[j] != rowData(j)[i]) {
+              return false;
+            }
+          }
         }
+
+        return true;
+      } else {
+        return matrix_common::isSymmetricSquare(m_elements.data(), COLUMNS,
+                                                ROWS);
       }
     }
+  }
 
-    return true;
+  /// @brief method to check whether all elements are zeros beyond a number of
+  ///        diagonals on both sides of the main one
+  /// @param bandwidth number of diagonals allowed on each side
+  /// @return true if matrix is square and banded, false otherwise
+  /// @note it reads rows in place and stops at the first element off the band
+  constexpr auto isBanded(std::size_t bandwidth) const noexcept -> bool {
+    if constexpr (ROWS != COLUMNS) {
+      return false;
+    } else {
+      return matrix_common::isZeroOutsideBand(m_elements.data(), COLUMNS,
+                                              ROWS, bandwidth, bandwidth);
+    }
   }
 
-  /// @brief method to display elements of the matrix
-  /// @return elements surrounded by matrix symbol
-  [[nodiscard]] constexpr auto display() const noexcept -> std::string {
-    const auto stringifyMatrix{[&matrixElements = m_elements]() {
-      const auto stringifyRow{[](auto&& row) {
-        constexpr auto kRowLength{COLUMNS};
-        std::string result;
-        for (std::size_t i{0U}; i < kRowLength; ++i) {
-          result += std::to_string(row[i]) + (i == kRowLength - 1U ? "" : " ");
-        }
+  /// @brief method to check whether all elements off the diagonal are zeros
+  /// @return true if matrix is square and diagonal, false otherwise
+  constexpr auto isDiagonal() const noexcept -> bool { return isBanded(0U); }
 
-        return std::string{std::format("|{}|", result)};
-      }};
+  /// @brief method to check whether all elements above the diagonal are zeros
+  /// @return true if matrix is square and lower triangular, false otherwise
+  constexpr auto isLowerTriangular() const noexcept -> bool {
+    if constexpr (ROWS != COLUMNS) {
+      return false;
+    } else {
+      return matrix_common::isZeroOutsideBand(m_elements.data(), COLUMNS,
+                                              ROWS, ROWS, 0U);
+    }
+  }
 
-      constexpr auto kNumberOfRows{ROWS};
-      std::string result;
-      for (std::size_t i{0U}; i < kNumberOfRows; ++i) {
-        result += stringifyRow(matrixElements[i]) +
-                  (i == kNumberOfRows - 1U ? "" : "\n");
-      }
+  /// @brief method to multiply the matrix by a vector and to accumulate the
+  ///        scaled product into another vector, y = alpha * A * x + beta * y
+  ///        (GEMV), on the given executor
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @param executor executor to run blocks of rows on
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  /// @note each row is multiplied by x on the vectorized dot product kernel;
+  ///       x and y must not overlap
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result,
+                      common::Executor auto& executor) const {
+    matrix_common::checkGemvLengths(*this, vector.size(), result.size());
+    matrix_common::multiplyRowsByVector(
+        alpha, beta, result,
+        [this, vector](std::size_t rowIndex) {
+          return simd_kernels::dot(rowData(rowIndex), vector.data(),
+                                   std::size_t{COLUMNS});
+        },
+        executor);
+  }
+
+  /// @brief overload of the method above that runs serially, unless the
+  ///        product has as many multiply-adds as parallelThreshold(), then
+  ///        it runs over common::ThreadPool::shared()
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result) const {
+    matrix_common::runMatrixVectorProduct(
+        std::size_t{ROWS} * COLUMNS, [&](auto& executor) {
+          multiplyVector(alpha, vector, beta, result, executor);
+        });
+  }
 
-      return result;
-    }};
+  /// @brief method to display elements of the matrix
+  /// @return elements surrounded by matrix symbol
+  [[nodiscard]] constexpr auto display() const noexcept -> std::string {
+    std::string result;
+    formatMatrixTo(std::back_inserter(result), *this);
 
-    return stringifyMatrix();
+    return result;
   }
 
   /// @brief type alias for T, used for assertions
@@ -283,8 +420,52 @@ public:
 
 private:
   /// @brief elements of the matrix
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
-  const ElementsType<> m_elements{};
+  StorageType m_elements{};
+
+  /// @brief helper method to add another matrix scaled by a factor to this
+  ///        one in place
+  /// @param otherMatrix the matrix to add
+  /// @param factor factor to scale the other matrix by
+  /// @param operation name of the operation, used in error messages
+  /// @return reference to this matrix
+  auto accumulate(const auto& otherMatrix, const T& factor,
+                  const char* operation) -> NormalMatrix& {
+    using OtherMatrixType = std::remove_cvref_t<decltype(otherMatrix)>;
+
+    static_assert(
+        std::is_same_v<typename OtherMatrixType::value_type, value_type>,
+        "Element types are not the same");
+    matrix_common::checkSameDimensions(*this, otherMatrix, operation);
+
+    if constexpr (std::is_same_v<OtherMatrixType, NormalMatrix>) {
+      // both are stored the same, hence added in one pass
+      simd_kernels::multiplyAdd(std::array<T, 1U>{factor},
+                                otherMatrix.m_elements.data(),
+                                std::array<T*, 1U>{m_elements.data()},
+                                m_elements.size());
+    } else {
+      matrix_common::accumulateStoredRows(
+          otherMatrix, factor,
+          [this](std::size_t rowIndex) { return rowData(rowIndex); });
+    }
+
+    return *this;
+  }
+
+  /// @brief helper method to lay filled matrix rows out one after another
+  /// @tparam ...Rows types of the filled matrix rows
+  /// @param ...rows filled matrix rows, missing ones are set to zero
+  /// @return the elements of the matrix stored row by row
+  template <typename... Rows>
+  static constexpr auto fillElements(const Rows&... rows) noexcept {
+    static_assert(sizeof...(rows) <= ROWS, "Too many rows are passed");
+
+    StorageType elements{};
+    [[maybe_unused]] auto output{elements.begin()};
+    ((output = std::copy(rows.begin(), rows.end(), output)), ...);
+
+    return elements;
+  }
 
   /// @brief helper method to take braced init list passed and return a matrix
   ///        row filled with those passed elements
@@ -315,4 +496,12 @@ private:
 template <common::NaturalNumber auto ROWS, common::NaturalNumber auto COLUMNS,
           typename T>
 class IsMatrixAdt<NormalMatrix<COLUMNS, ROWS, T>> : public std::true_type {};
+
+/// @brief normal matrix stores all elements of each row contiguously
+/// @tparam ROWS number of rows of matrix
+/// @tparam COLUMNS number of columns of matrix
+/// @tparam T type of elements of matrix
+template <common::NaturalNumber auto ROWS, common::NaturalNumber auto COLUMNS,
+          typename T>
+class HasDenseRows<NormalMatrix<ROWS, COLUMNS, T>> : public std::true_type {};
 }  // namespace data_structures::matrix_types
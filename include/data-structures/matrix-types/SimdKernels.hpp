@@ -0,0 +1,1256 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "data-structures/matrix-types/HalfPrecision.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+/// @brief namespace for vectorized kernels used by matrices types
+/// @note every kernel here computes destination += factor * source over a
+///       contiguous range for a handful of destinations at once, which is the
+///       innermost step of the blocked multiplication kernel, or with a
+///       factor per element for the element-wise variant, besides the
+///       micro-transposes of small tiles used by the blocked transpose, the
+///       dot products of matrix-vector products and the conversions between
+///       16-bit floating point types and float.
+///       Vector kernels perform exactly the same operations in the same order
+///       as the scalar one (no fused multiply-add is used), hence:
+///       - for integers, results are bit-exact to the scalar kernel, with the
+///         only difference that signed overflow wraps around instead of being
+///         undefined behavior
+///       - for floating point, results are bit-exact to the scalar kernel as
+///         well, and the product of an [m*k] by a [k*n] matrix satisfies the
+///         classical bound of recursive summation for each element:
+///         |computed - exact| <= gamma(k) * sum(|a_ip| * |b_pj|), where
+///         gamma(k) = k*u / (1 - k*u) and u is the unit roundoff of the type,
+///         i.e. 2^-24 for float and 2^-53 for double. Dot products of k
+///         elements sum kDotPartialSums partial sums, so their bound is
+///         gamma(k / kDotPartialSums + kDotPartialSums) instead of gamma(k)
+namespace data_structures::matrix_types::simd_kernels {
+
+/// @brief instruction sets the kernels are specialized for, ordered by width
+enum class InstructionSet : std::uint8_t { kScalar, kSse42, kAvx2, kAvx512 };
+
+/// @brief concept for element types having vectorized kernels
+template <typename T>
+concept Vectorizable = std::same_as<T, float> || std::same_as<T, double> ||
+                       std::same_as<T, std::int32_t> ||
+                       std::same_as<T, std::uint64_t>;
+
+/// @brief helper function to detect the widest instruction set supported
+///        by the running CPU
+/// @return the widest supported instruction set
+inline auto detectInstructionSet() noexcept -> InstructionSet {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")) {
+    return InstructionSet::kAvx512;
+  }
+
+  if (__builtin_cpu_supports("avx2")) {
+    return InstructionSet::kAvx2;
+  }
+
+  if (__builtin_cpu_supports("sse4.2")) {
+    return InstructionSet::kSse42;
+  }
+#endif
+
+  return InstructionSet::kScalar;
+}
+
+/// @brief helper function that holds the instruction set used by the kernels,
+///        which is detected once on first use
+/// @return reference to the instruction set currently in use
+inline auto selectedInstructionSet() noexcept -> std::atomic<InstructionSet>& {
+  static std::atomic<InstructionSet> selected{detectInstructionSet()};
+  return selected;
+}
+
+/// @brief function to restrict the kernels to a narrower instruction set,
+///        e.g. to compare results or throughput of different kernels
+/// @param requested the instruction set to be used
+/// @note requesting an instruction set wider than the one supported by the
+///       running CPU falls back to the widest supported one
+inline void useInstructionSet(InstructionSet requested) noexcept {
+  const auto supported{detectInstructionSet()};
+  selectedInstructionSet().store(requested < supported ? requested : supported,
+                                 std::memory_order_relaxed);
+}
+
+/// @brief helper function to tell whether the running CPU converts between
+///        half-precision numbers and floats, which is detected once
+/// @return true if F16C instructions are supported
+inline auto supportsF16c() noexcept -> bool {
+#if defined(__x86_64__) || defined(__i386__)
+  static const bool supported{__builtin_cpu_supports("f16c") != 0};
+  return supported;
+#else
+  return false;
+#endif
+}
+
+/// @brief scalar kernel, used for the types without vectorized kernels and
+///        for the tails of the vectorized ones
+/// @tparam R number of destinations updated at once
+/// @tparam T type of the elements
+/// @param factors factor of each destination
+/// @param source elements to be scaled by each factor
+/// @param destinations ranges to accumulate the scaled elements into
+/// @param count number of elements of each range
+template <std::size_t R, typename T>
+void multiplyAddScalar(const std::array<T, R>& factors, const T* source,
+                       const std::array<T*, R>& destinations,
+                       std::size_t count) {
+  for (std::size_t i{0U}; i < count; ++i) {
+    for (std::size_t r{0U}; r < R; ++r) {
+      // cast back, as types narrower than int are promoted by arithmetic
+      destinations[r][i] =
+          static_cast<T>(destinations[r][i] + (factors[r] * source[i]));
+    }
+  }
+}
+
+/// @brief scalar kernel of the element-wise multiply-add, used for the types
+///        without vectorized kernels and for the tails of the vectorized ones
+/// @tparam T type of the elements
+/// @param factors factor of each element of the source
+/// @param source elements to be scaled by their factors
+/// @param destination range to accumulate the scaled elements into
+/// @param count number of elements of each range
+template <typename T>
+void multiplyAddElementwiseScalar(const T* factors, const T* source,
+                                  T* destination, std::size_t count) {
+  for (std::size_t i{0U}; i < count; ++i) {
+    destination[i] += factors[i] * source[i];
+  }
+}
+
+/// @brief scalar kernel of the transpose of a block, used for the types
+///        without vectorized kernels and for the edges of the vectorized ones
+/// @tparam T type of the elements
+/// @param source first element of the block, stored row by row
+/// @param sourceStride distance between two consecutive rows of the source
+/// @param destination first element of the transposed block
+/// @param destinationStride distance between two consecutive rows of the
+///        destination
+/// @param rows number of rows of the source block
+/// @param columns number of columns of the source block
+template <typename T>
+void transposeScalar(const T* source, std::size_t sourceStride, T* destination,
+                     std::size_t destinationStride, std::size_t rows,
+                     std::size_t columns) {
+  for (std::size_t i{0U}; i < rows; ++i) {
+    for (std::size_t j{0U}; j < columns; ++j) {
+      destination[(j * destinationStride) + i] = source[(i * sourceStride) + j];
+    }
+  }
+}
+
+/// @brief number of partial sums of the dot product, each product being
+///        accumulated into the partial sum of its index modulo this number,
+///        so that the vectorized kernels, of 16 lanes at most, add the same
+///        products in the same order as the scalar one
+inline constexpr std::size_t kDotPartialSums{16U};
+
+/// @brief scalar kernel of the dot product, used for the types without
+///        vectorized kernels and for the tails of the vectorized ones
+/// @tparam T type of the elements
+/// @param first elements of the first range
+/// @param second elements of the second range
+/// @param count number of elements of each range
+/// @param partials partial sums accumulated so far, by the vectorized kernels
+/// @return the sum of the products of the elements of both ranges, the
+///         partial sums being added up in order
+template <typename T>
+auto dotScalar(const T* first, const T* second, std::size_t count,
+               std::array<T, kDotPartialSums> partials = {}) -> T {
+  for (std::size_t i{0U}; i < count; ++i) {
+    partials[i % kDotPartialSums] += first[i] * second[i];
+  }
+
+  T sum{};
+  for (const auto& partial : partials) {
+    sum += partial;
+  }
+
+  return sum;
+}
+
+/// @brief scalar kernel of the conversion of a range to another element type,
+///        used for the types without vectorized kernels and for the tails of
+///        the vectorized ones
+/// @tparam From type of the elements of the source
+/// @tparam To type of the elements of the destination
+/// @param source elements to be converted
+/// @param destination range to write the converted elements to
+/// @param count number of elements of each range
+template <typename From, typename To>
+void convertScalar(const From* source, To* destination, std::size_t count) {
+  for (std::size_t i{0U}; i < count; ++i) {
+    destination[i] = static_cast<To>(source[i]);
+  }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+/// @brief operations on vector registers of SSE4.2
+/// @tparam T type of the elements
+template <Vectorizable T>
+struct Sse42Ops;
+
+template <>
+struct Sse42Ops<float> {
+  using Register = __m128;
+  static constexpr std::size_t kLanes{4U};
+
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline auto load(
+      const float* src) noexcept {
+    return _mm_loadu_ps(src);
+  }
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline void store(
+      float* dst, Register value) noexcept {
+    _mm_storeu_ps(dst, value);
+  }
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline auto broadcast(
+      float value) noexcept {
+    return _mm_set1_ps(value);
+  }
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline auto multiplyAdd(
+      Register acc, Register factor, Register value) noexcept {
+    return _mm_add_ps(acc, _mm_mul_ps(factor, value));
+  }
+};
+
+template <>
+struct Sse42Ops<double> {
+  using Register = __m128d;
+  static constexpr std::size_t kLanes{2U};
+
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline auto load(
+      const double* src) noexcept {
+    return _mm_loadu_pd(src);
+  }
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline void store(
+      double* dst, Register value) noexcept {
+    _mm_storeu_pd(dst, value);
+  }
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline auto broadcast(
+      double value) noexcept {
+    return _mm_set1_pd(value);
+  }
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline auto multiplyAdd(
+      Register acc, Register factor, Register value) noexcept {
+    return _mm_add_pd(acc, _mm_mul_pd(factor, value));
+  }
+};
+
+template <>
+struct Sse42Ops<std::int32_t> {
+  using Register = __m128i;
+  static constexpr std::size_t kLanes{4U};
+
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline auto load(
+      const std::int32_t* src) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));  // NOLINT
+  }
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline void store(
+      std::int32_t* dst, Register value) noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), value);  // NOLINT
+  }
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline auto broadcast(
+      std::int32_t value) noexcept {
+    return _mm_set1_epi32(value);
+  }
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline auto multiplyAdd(
+      Register acc, Register factor, Register value) noexcept {
+    return _mm_add_epi32(acc, _mm_mullo_epi32(factor, value));
+  }
+};
+
+template <>
+struct Sse42Ops<std::uint64_t> {
+  using Register = __m128i;
+  static constexpr std::size_t kLanes{2U};
+
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline auto load(
+      const std::uint64_t* src) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));  // NOLINT
+  }
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline void store(
+      std::uint64_t* dst, Register value) noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), value);  // NOLINT
+  }
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline auto broadcast(
+      std::uint64_t value) noexcept {
+    return _mm_set1_epi64x(static_cast<long long>(value));
+  }
+  /// @note SSE has no 64-bit multiplication, so it is composed of 32-bit ones:
+  ///       a * b mod 2^64 = lo(a)*lo(b) + ((hi(a)*lo(b) + lo(a)*hi(b)) << 32)
+  [[gnu::target("sse4.2"), gnu::always_inline]] static inline auto multiplyAdd(
+      Register acc, Register factor, Register value) noexcept {
+    const auto low{_mm_mul_epu32(factor, value)};
+    const auto cross{
+        _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(factor, 32), value),
+                      _mm_mul_epu32(factor, _mm_srli_epi64(value, 32)))};
+    return _mm_add_epi64(acc,
+                         _mm_add_epi64(low, _mm_slli_epi64(cross, 32)));
+  }
+};
+
+/// @brief operations on vector registers of AVX2
+/// @tparam T type of the elements
+template <Vectorizable T>
+struct Avx2Ops;
+
+template <>
+struct Avx2Ops<float> {
+  using Register = __m256;
+  static constexpr std::size_t kLanes{8U};
+
+  [[gnu::target("avx2"), gnu::always_inline]] static inline auto load(
+      const float* src) noexcept {
+    return _mm256_loadu_ps(src);
+  }
+  [[gnu::target("avx2"), gnu::always_inline]] static inline void store(
+      float* dst, Register value) noexcept {
+    _mm256_storeu_ps(dst, value);
+  }
+  [[gnu::target("avx2"), gnu::always_inline]] static inline auto broadcast(
+      float value) noexcept {
+    return _mm256_set1_ps(value);
+  }
+  [[gnu::target("avx2"), gnu::always_inline]] static inline auto multiplyAdd(
+      Register acc, Register factor, Register value) noexcept {
+    return _mm256_add_ps(acc, _mm256_mul_ps(factor, value));
+  }
+};
+
+template <>
+struct Avx2Ops<double> {
+  using Register = __m256d;
+  static constexpr std::size_t kLanes{4U};
+
+  [[gnu::target("avx2"), gnu::always_inline]] static inline auto load(
+      const double* src) noexcept {
+    return _mm256_loadu_pd(src);
+  }
+  [[gnu::target("avx2"), gnu::always_inline]] static inline void store(
+      double* dst, Register value) noexcept {
+    _mm256_storeu_pd(dst, value);
+  }
+  [[gnu::target("avx2"), gnu::always_inline]] static inline auto broadcast(
+      double value) noexcept {
+    return _mm256_set1_pd(value);
+  }
+  [[gnu::target("avx2"), gnu::always_inline]] static inline auto multiplyAdd(
+      Register acc, Register factor, Register value) noexcept {
+    return _mm256_add_pd(acc, _mm256_mul_pd(factor, value));
+  }
+};
+
+template <>
+struct Avx2Ops<std::int32_t> {
+  using Register = __m256i;
+  static constexpr std::size_t kLanes{8U};
+
+  [[gnu::target("avx2"), gnu::always_inline]] static inline auto load(
+      const std::int32_t* src) noexcept {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));  // NOLINT
+  }
+  [[gnu::target("avx2"), gnu::always_inline]] static inline void store(
+      std::int32_t* dst, Register value) noexcept {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), value);  // NOLINT
+  }
+  [[gnu::target("avx2"), gnu::always_inline]] static inline auto broadcast(
+      std::int32_t value) noexcept {
+    return _mm256_set1_epi32(value);
+  }
+  [[gnu::target("avx2"), gnu::always_inline]] static inline auto multiplyAdd(
+      Register acc, Register factor, Register value) noexcept {
+    return _mm256_add_epi32(acc, _mm256_mullo_epi32(factor, value));
+  }
+};
+
+template <>
+struct Avx2Ops<std::uint64_t> {
+  using Register = __m256i;
+  static constexpr std::size_t kLanes{4U};
+
+  [[gnu::target("avx2"), gnu::always_inline]] static inline auto load(
+      const std::uint64_t* src) noexcept {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));  // NOLINT
+  }
+  [[gnu::target("avx2"), gnu::always_inline]] static inline void store(
+      std::uint64_t* dst, Register value) noexcept {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), value);  // NOLINT
+  }
+  [[gnu::target("avx2"), gnu::always_inline]] static inline auto broadcast(
+      std::uint64_t value) noexcept {
+    return _mm256_set1_epi64x(static_cast<long long>(value));
+  }
+  /// @note AVX2 has no 64-bit multiplication, it is composed the same way
+  ///       as in Sse42Ops<std::uint64_t>
+  [[gnu::target("avx2"), gnu::always_inline]] static inline auto multiplyAdd(
+      Register acc, Register factor, Register value) noexcept {
+    const auto low{_mm256_mul_epu32(factor, value)};
+    const auto cross{_mm256_add_epi64(
+        _mm256_mul_epu32(_mm256_srli_epi64(factor, 32), value),
+        _mm256_mul_epu32(factor, _mm256_srli_epi64(value, 32)))};
+    return _mm256_add_epi64(
+        acc, _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32)));
+  }
+};
+
+/// @brief operations on vector registers of AVX-512 (F and DQ)
+/// @tparam T type of the elements
+template <Vectorizable T>
+struct Avx512Ops;
+
+template <>
+struct Avx512Ops<float> {
+  using Register = __m512;
+  static constexpr std::size_t kLanes{16U};
+
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline auto
+  load(const float* src) noexcept {
+    return _mm512_loadu_ps(src);
+  }
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline void
+  store(float* dst, Register value) noexcept {
+    _mm512_storeu_ps(dst, value);
+  }
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline auto
+  broadcast(float value) noexcept {
+    return _mm512_set1_ps(value);
+  }
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline auto
+  multiplyAdd(Register acc, Register factor, Register value) noexcept {
+    return _mm512_add_ps(acc, _mm512_mul_ps(factor, value));
+  }
+};
+
+template <>
+struct Avx512Ops<double> {
+  using Register = __m512d;
+  static constexpr std::size_t kLanes{8U};
+
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline auto
+  load(const double* src) noexcept {
+    return _mm512_loadu_pd(src);
+  }
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline void
+  store(double* dst, Register value) noexcept {
+    _mm512_storeu_pd(dst, value);
+  }
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline auto
+  broadcast(double value) noexcept {
+    return _mm512_set1_pd(value);
+  }
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline auto
+  multiplyAdd(Register acc, Register factor, Register value) noexcept {
+    return _mm512_add_pd(acc, _mm512_mul_pd(factor, value));
+  }
+};
+
+template <>
+struct Avx512Ops<std::int32_t> {
+  using Register = __m512i;
+  static constexpr std::size_t kLanes{16U};
+
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline auto
+  load(const std::int32_t* src) noexcept {
+    return _mm512_loadu_si512(src);
+  }
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline void
+  store(std::int32_t* dst, Register value) noexcept {
+    _mm512_storeu_si512(dst, value);
+  }
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline auto
+  broadcast(std::int32_t value) noexcept {
+    return _mm512_set1_epi32(value);
+  }
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline auto
+  multiplyAdd(Register acc, Register factor, Register value) noexcept {
+    return _mm512_add_epi32(acc, _mm512_mullo_epi32(factor, value));
+  }
+};
+
+template <>
+struct Avx512Ops<std::uint64_t> {
+  using Register = __m512i;
+  static constexpr std::size_t kLanes{8U};
+
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline auto
+  load(const std::uint64_t* src) noexcept {
+    return _mm512_loadu_si512(src);
+  }
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline void
+  store(std::uint64_t* dst, Register value) noexcept {
+    _mm512_storeu_si512(dst, value);
+  }
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline auto
+  broadcast(std::uint64_t value) noexcept {
+    return _mm512_set1_epi64(static_cast<long long>(value));
+  }
+  [[gnu::target("avx512f,avx512dq"), gnu::always_inline]] static inline auto
+  multiplyAdd(Register acc, Register factor, Register value) noexcept {
+    return _mm512_add_epi64(acc, _mm512_mullo_epi64(factor, value));
+  }
+};
+
+/// @brief the vectorized kernels, one per instruction set since the target
+///        attribute cannot be a template parameter, they only differ in it
+/// @tparam Ops operations on the vector registers of the instruction set
+/// @tparam R number of destinations updated at once
+/// @tparam T type of the elements
+/// @param factors factor of each destination
+/// @param source elements to be scaled by each factor
+/// @param destinations ranges to accumulate the scaled elements into
+/// @param count number of elements of each range
+template <typename Ops, std::size_t R, typename T>
+[[gnu::target("sse4.2")]] void multiplyAddSse42(
+    const std::array<T, R>& factors, const T* source,
+    const std::array<T*, R>& destinations, std::size_t count) {
+  // a plain array, since std::array drops the alignment of vector registers
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  typename Ops::Register broadcasted[R];
+  for (std::size_t r{0U}; r < R; ++r) {
+    broadcasted[r] = Ops::broadcast(factors[r]);
+  }
+
+  std::size_t i{0U};
+  for (; i + Ops::kLanes <= count; i += Ops::kLanes) {
+    const auto value{Ops::load(source + i)};
+    for (std::size_t r{0U}; r < R; ++r) {
+      Ops::store(destinations[r] + i,
+                 Ops::multiplyAdd(Ops::load(destinations[r] + i),
+                                  broadcasted[r], value));
+    }
+  }
+
+  std::array<T*, R> tails{destinations};
+  for (auto& tail : tails) {
+    tail += i;
+  }
+  multiplyAddScalar(factors, source + i, tails, count - i);
+}
+
+template <typename Ops, std::size_t R, typename T>
+[[gnu::target("avx2")]] void multiplyAddAvx2(
+    const std::array<T, R>& factors, const T* source,
+    const std::array<T*, R>& destinations, std::size_t count) {
+  // a plain array, since std::array drops the alignment of vector registers
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  typename Ops::Register broadcasted[R];
+  for (std::size_t r{0U}; r < R; ++r) {
+    broadcasted[r] = Ops::broadcast(factors[r]);
+  }
+
+  std::size_t i{0U};
+  for (; i + Ops::kLanes <= count; i += Ops::kLanes) {
+    const auto value{Ops::load(source + i)};
+    for (std::size_t r{0U}; r < R; ++r) {
+      Ops::store(destinations[r] + i,
+                 Ops::multiplyAdd(Ops::load(destinations[r] + i),
+                                  broadcasted[r], value));
+    }
+  }
+
+  std::array<T*, R> tails{destinations};
+  for (auto& tail : tails) {
+    tail += i;
+  }
+  multiplyAddScalar(factors, source + i, tails, count - i);
+}
+
+template <typename Ops, std::size_t R, typename T>
+[[gnu::target("avx512f,avx512dq")]] void multiplyAddAvx512(
+    const std::array<T, R>& factors, const T* source,
+    const std::array<T*, R>& destinations, std::size_t count) {
+  // a plain array, since std::array drops the alignment of vector registers
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  typename Ops::Register broadcasted[R];
+  for (std::size_t r{0U}; r < R; ++r) {
+    broadcasted[r] = Ops::broadcast(factors[r]);
+  }
+
+  std::size_t i{0U};
+  for (; i + Ops::kLanes <= count; i += Ops::kLanes) {
+    const auto value{Ops::load(source + i)};
+    for (std::size_t r{0U}; r < R; ++r) {
+      Ops::store(destinations[r] + i,
+                 Ops::multiplyAdd(Ops::load(destinations[r] + i),
+                                  broadcasted[r], value));
+    }
+  }
+
+  std::array<T*, R> tails{destinations};
+  for (auto& tail : tails) {
+    tail += i;
+  }
+  multiplyAddScalar(factors, source + i, tails, count - i);
+}
+
+/// @brief the vectorized element-wise kernels, one per instruction set as well
+/// @tparam Ops operations on the vector registers of the instruction set
+/// @tparam T type of the elements
+/// @param factors factor of each element of the source
+/// @param source elements to be scaled by their factors
+/// @param destination range to accumulate the scaled elements into
+/// @param count number of elements of each range
+template <typename Ops, typename T>
+[[gnu::target("sse4.2")]] void multiplyAddElementwiseSse42(
+    const T* factors, const T* source, T* destination, std::size_t count) {
+  std::size_t i{0U};
+  for (; i + Ops::kLanes <= count; i += Ops::kLanes) {
+    Ops::store(destination + i,
+               Ops::multiplyAdd(Ops::load(destination + i),
+                                Ops::load(factors + i), Ops::load(source + i)));
+  }
+
+  multiplyAddElementwiseScalar(factors + i, source + i, destination + i,
+                               count - i);
+}
+
+template <typename Ops, typename T>
+[[gnu::target("avx2")]] void multiplyAddElementwiseAvx2(
+    const T* factors, const T* source, T* destination, std::size_t count) {
+  std::size_t i{0U};
+  for (; i + Ops::kLanes <= count; i += Ops::kLanes) {
+    Ops::store(destination + i,
+               Ops::multiplyAdd(Ops::load(destination + i),
+                                Ops::load(factors + i), Ops::load(source + i)));
+  }
+
+  multiplyAddElementwiseScalar(factors + i, source + i, destination + i,
+                               count - i);
+}
+
+template <typename Ops, typename T>
+[[gnu::target("avx512f,avx512dq")]] void multiplyAddElementwiseAvx512(
+    const T* factors, const T* source, T* destination, std::size_t count) {
+  std::size_t i{0U};
+  for (; i + Ops::kLanes <= count; i += Ops::kLanes) {
+    Ops::store(destination + i,
+               Ops::multiplyAdd(Ops::load(destination + i),
+                                Ops::load(factors + i), Ops::load(source + i)));
+  }
+
+  multiplyAddElementwiseScalar(factors + i, source + i, destination + i,
+                               count - i);
+}
+
+/// @brief the vectorized dot products, one per instruction set as well,
+///        each register holding kDotPartialSums / kLanes partial sums
+/// @tparam Ops operations on the vector registers of the instruction set
+/// @tparam T type of the elements
+/// @param first elements of the first range
+/// @param second elements of the second range
+/// @param count number of elements of each range
+/// @return the sum of the products of the elements of both ranges
+template <typename Ops, typename T>
+[[gnu::target("sse4.2")]] auto dotSse42(const T* first, const T* second,
+                                        std::size_t count) -> T {
+  constexpr auto kRegisters{kDotPartialSums / Ops::kLanes};
+
+  // a plain array, since std::array drops the alignment of vector registers
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  typename Ops::Register sums[kRegisters];
+  for (auto& sum : sums) {
+    sum = Ops::broadcast(T{});
+  }
+
+  std::size_t i{0U};
+  for (; i + kDotPartialSums <= count; i += kDotPartialSums) {
+    for (std::size_t r{0U}; r < kRegisters; ++r) {
+      const auto offset{i + (r * Ops::kLanes)};
+      sums[r] = Ops::multiplyAdd(sums[r], Ops::load(first + offset),
+                                 Ops::load(second + offset));
+    }
+  }
+
+  std::array<T, kDotPartialSums> partials;
+  for (std::size_t r{0U}; r < kRegisters; ++r) {
+    Ops::store(partials.data() + (r * Ops::kLanes), sums[r]);
+  }
+
+  return dotScalar(first + i, second + i, count - i, partials);
+}
+
+/// @brief dot product with AVX2, the partial sums held in registers of 256
+///        bits, i.e. fewer registers than with SSE for as many partial sums
+/// @tparam Ops operations on the vector registers of the instruction set
+/// @tparam T type of the elements
+/// @param first elements of the first range
+/// @param second elements of the second range
+/// @param count number of elements of each range
+/// @return the sum of the products of the elements of both ranges
+template <typename Ops, typename T>
+[[gnu::target("avx2")]] auto dotAvx2(const T* first, const T* second,
+                                     std::size_t count) -> T {
+  constexpr auto kRegisters{kDotPartialSums / Ops::kLanes};
+
+  // a plain array, since std::array drops the alignment of vector registers
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  typename Ops::Register sums[kRegisters];
+  for (auto& sum : sums) {
+    sum = Ops::broadcast(T{});
+  }
+
+  std::size_t i{0U};
+  for (; i + kDotPartialSums <= count; i += kDotPartialSums) {
+    for (std::size_t r{0U}; r < kRegisters; ++r) {
+      const auto offset{i + (r * Ops::kLanes)};
+      sums[r] = Ops::multiplyAdd(sums[r], Ops::load(first + offset),
+                                 Ops::load(second + offset));
+    }
+  }
+
+  std::array<T, kDotPartialSums> partials;
+  for (std::size_t r{0U}; r < kRegisters; ++r) {
+    Ops::store(partials.data() + (r * Ops::kLanes), sums[r]);
+  }
+
+  return dotScalar(first + i, second + i, count - i, partials);
+}
+
+/// @brief dot product with AVX-512, the partial sums held in registers of 512
+///        bits, the fewest of all instruction sets for as many partial sums
+/// @tparam Ops operations on the vector registers of the instruction set
+/// @tparam T type of the elements
+/// @param first elements of the first range
+/// @param second elements of the second range
+/// @param count number of elements of each range
+/// @return the sum of the products of the elements of both ranges
+template <typename Ops, typename T>
+[[gnu::target("avx512f,avx512dq")]] auto dotAvx512(const T* first,
+                                                   const T* second,
+                                                   std::size_t count) -> T {
+  constexpr auto kRegisters{kDotPartialSums / Ops::kLanes};
+
+  // a plain array, since std::array drops the alignment of vector registers
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  typename Ops::Register sums[kRegisters];
+  for (auto& sum : sums) {
+    sum = Ops::broadcast(T{});
+  }
+
+  std::size_t i{0U};
+  for (; i + kDotPartialSums <= count; i += kDotPartialSums) {
+    for (std::size_t r{0U}; r < kRegisters; ++r) {
+      const auto offset{i + (r * Ops::kLanes)};
+      sums[r] = Ops::multiplyAdd(sums[r], Ops::load(first + offset),
+                                 Ops::load(second + offset));
+    }
+  }
+
+  std::array<T, kDotPartialSums> partials;
+  for (std::size_t r{0U}; r < kRegisters; ++r) {
+    Ops::store(partials.data() + (r * Ops::kLanes), sums[r]);
+  }
+
+  return dotScalar(first + i, second + i, count - i, partials);
+}
+
+/// @brief micro-transpose of a 4x4 tile of 32-bit elements with SSE
+///        shuffles, moving the bits of the elements whatever their type is
+/// @tparam T type of the elements, float or std::int32_t
+/// @param source first element of the tile
+/// @param sourceStride distance between two consecutive rows of the source
+/// @param destination first element of the transposed tile
+/// @param destinationStride distance between two consecutive rows of the
+///        destination
+template <typename T>
+[[gnu::target("sse4.2"), gnu::always_inline]] inline void transpose4x4Sse42(
+    const T* source, std::size_t sourceStride, T* destination,
+    std::size_t destinationStride) noexcept {
+  static_assert(sizeof(T) == sizeof(float));
+
+  // a plain array, since std::array drops the alignment of vector registers
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  __m128 rows[4U];
+  for (std::size_t row{0U}; row < 4U; ++row) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    rows[row] = _mm_castsi128_ps(_mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(source + (row * sourceStride))));
+  }
+
+  const auto low01{_mm_unpacklo_ps(rows[0U], rows[1U])};
+  const auto low23{_mm_unpacklo_ps(rows[2U], rows[3U])};
+  const auto high01{_mm_unpackhi_ps(rows[0U], rows[1U])};
+  const auto high23{_mm_unpackhi_ps(rows[2U], rows[3U])};
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  const __m128 columns[4U]{
+      _mm_movelh_ps(low01, low23), _mm_movehl_ps(low23, low01),
+      _mm_movelh_ps(high01, high23), _mm_movehl_ps(high23, high01)};
+  for (std::size_t row{0U}; row < 4U; ++row) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(destination + (row * destinationStride)),
+        _mm_castps_si128(columns[row]));
+  }
+}
+
+/// @brief micro-transpose of a 4x4 tile of 64-bit elements with AVX2
+///        shuffles, moving the bits of the elements whatever their type is
+/// @tparam T type of the elements, double or std::uint64_t
+/// @param source first element of the tile
+/// @param sourceStride distance between two consecutive rows of the source
+/// @param destination first element of the transposed tile
+/// @param destinationStride distance between two consecutive rows of the
+///        destination
+template <typename T>
+[[gnu::target("avx2"), gnu::always_inline]] inline void transpose4x4Avx2(
+    const T* source, std::size_t sourceStride, T* destination,
+    std::size_t destinationStride) noexcept {
+  static_assert(sizeof(T) == sizeof(double));
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  __m256d rows[4U];
+  for (std::size_t row{0U}; row < 4U; ++row) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    rows[row] = _mm256_castsi256_pd(_mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(source + (row * sourceStride))));
+  }
+
+  // even and odd columns of each pair of rows, within each 128-bit lane
+  const auto even01{_mm256_unpacklo_pd(rows[0U], rows[1U])};
+  const auto odd01{_mm256_unpackhi_pd(rows[0U], rows[1U])};
+  const auto even23{_mm256_unpacklo_pd(rows[2U], rows[3U])};
+  const auto odd23{_mm256_unpackhi_pd(rows[2U], rows[3U])};
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  const __m256d columns[4U]{_mm256_permute2f128_pd(even01, even23, 0x20),
+                            _mm256_permute2f128_pd(odd01, odd23, 0x20),
+                            _mm256_permute2f128_pd(even01, even23, 0x31),
+                            _mm256_permute2f128_pd(odd01, odd23, 0x31)};
+  for (std::size_t row{0U}; row < 4U; ++row) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(destination + (row * destinationStride)),
+        _mm256_castpd_si256(columns[row]));
+  }
+}
+
+/// @brief micro-transpose of an 8x8 tile of 32-bit elements with AVX2
+///        shuffles, moving the bits of the elements whatever their type is
+/// @tparam T type of the elements, float or std::int32_t
+/// @param source first element of the tile
+/// @param sourceStride distance between two consecutive rows of the source
+/// @param destination first element of the transposed tile
+/// @param destinationStride distance between two consecutive rows of the
+///        destination
+template <typename T>
+[[gnu::target("avx2"), gnu::always_inline]] inline void transpose8x8Avx2(
+    const T* source, std::size_t sourceStride, T* destination,
+    std::size_t destinationStride) noexcept {
+  static_assert(sizeof(T) == sizeof(float));
+  constexpr int kLowPairs{0x44};   // elements 0, 1 of both operands
+  constexpr int kHighPairs{0xEE};  // elements 2, 3 of both operands
+
+  // a plain array, since std::array drops the alignment of vector registers
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  __m256 rows[8U];
+  for (std::size_t row{0U}; row < 8U; ++row) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    rows[row] = _mm256_castsi256_ps(_mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(source + (row * sourceStride))));
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  __m256 quarters[8U];
+  for (std::size_t row{0U}; row < 8U; row += 4U) {
+    const auto low01{_mm256_unpacklo_ps(rows[row], rows[row + 1U])};
+    const auto high01{_mm256_unpackhi_ps(rows[row], rows[row + 1U])};
+    const auto low23{_mm256_unpacklo_ps(rows[row + 2U], rows[row + 3U])};
+    const auto high23{_mm256_unpackhi_ps(rows[row + 2U], rows[row + 3U])};
+
+    quarters[row] = _mm256_shuffle_ps(low01, low23, kLowPairs);
+    quarters[row + 1U] = _mm256_shuffle_ps(low01, low23, kHighPairs);
+    quarters[row + 2U] = _mm256_shuffle_ps(high01, high23, kLowPairs);
+    quarters[row + 3U] = _mm256_shuffle_ps(high01, high23, kHighPairs);
+  }
+
+  for (std::size_t row{0U}; row < 4U; ++row) {
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(destination + (row * destinationStride)),
+        _mm256_castps_si256(
+            _mm256_permute2f128_ps(quarters[row], quarters[row + 4U], 0x20)));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(destination +
+                                   ((row + 4U) * destinationStride)),
+        _mm256_castps_si256(
+            _mm256_permute2f128_ps(quarters[row], quarters[row + 4U], 0x31)));
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+  }
+}
+
+/// @brief the vectorized transposes of a block, one per instruction set as
+///        well, walking the block by tiles of the micro-transposes above and
+///        leaving the edges to the scalar kernel
+/// @tparam T type of the elements
+/// @param source first element of the block, stored row by row
+/// @param sourceStride distance between two consecutive rows of the source
+/// @param destination first element of the transposed block
+/// @param destinationStride distance between two consecutive rows of the
+///        destination
+/// @param rows number of rows of the source block
+/// @param columns number of columns of the source block
+template <typename T>
+[[gnu::target("sse4.2")]] void transposeBlockSse42(
+    const T* source, std::size_t sourceStride, T* destination,
+    std::size_t destinationStride, std::size_t rows, std::size_t columns) {
+  constexpr std::size_t kTile{4U};
+  const auto tiledRows{rows - (rows % kTile)};
+  const auto tiledColumns{columns - (columns % kTile)};
+
+  for (std::size_t i{0U}; i < tiledRows; i += kTile) {
+    for (std::size_t j{0U}; j < tiledColumns; j += kTile) {
+      transpose4x4Sse42(source + (i * sourceStride) + j, sourceStride,
+                        destination + (j * destinationStride) + i,
+                        destinationStride);
+    }
+  }
+
+  transposeScalar(source + tiledColumns, sourceStride,
+                  destination + (tiledColumns * destinationStride),
+                  destinationStride, rows, columns - tiledColumns);
+  transposeScalar(source + (tiledRows * sourceStride), sourceStride,
+                  destination + tiledRows, destinationStride,
+                  rows - tiledRows, tiledColumns);
+}
+
+/// @brief transpose of a block with AVX2, by tiles of 8x8 elements of 32 bits
+///        or of 4x4 elements of 64 bits, the edges left to the scalar kernel
+/// @tparam T type of the elements, of 32 or 64 bits
+/// @param source first element of the block, stored row by row
+/// @param sourceStride distance between two consecutive rows of the source
+/// @param destination first element of the transposed block
+/// @param destinationStride distance between two consecutive rows of the
+///        destination
+/// @param rows number of rows of the source block
+/// @param columns number of columns of the source block
+template <typename T>
+[[gnu::target("avx2")]] void transposeBlockAvx2(
+    const T* source, std::size_t sourceStride, T* destination,
+    std::size_t destinationStride, std::size_t rows, std::size_t columns) {
+  // a vector register holds 8 elements of 32 bits, or 4 elements of 64 bits
+  constexpr std::size_t kTile{sizeof(T) == sizeof(float) ? 8U : 4U};
+  const auto tiledRows{rows - (rows % kTile)};
+  const auto tiledColumns{columns - (columns % kTile)};
+
+  for (std::size_t i{0U}; i < tiledRows; i += kTile) {
+    for (std::size_t j{0U}; j < tiledColumns; j += kTile) {
+      if constexpr (kTile == 8U) {
+        transpose8x8Avx2(source + (i * sourceStride) + j, sourceStride,
+                         destination + (j * destinationStride) + i,
+                         destinationStride);
+      } else {
+        transpose4x4Avx2(source + (i * sourceStride) + j, sourceStride,
+                         destination + (j * destinationStride) + i,
+                         destinationStride);
+      }
+    }
+  }
+
+  transposeScalar(source + tiledColumns, sourceStride,
+                  destination + (tiledColumns * destinationStride),
+                  destinationStride, rows, columns - tiledColumns);
+  transposeScalar(source + (tiledRows * sourceStride), sourceStride,
+                  destination + tiledRows, destinationStride,
+                  rows - tiledRows, tiledColumns);
+}
+
+/// @brief F16C kernel converting half-precision numbers to floats, eight at
+///        a time, which is exact as the scalar conversion is
+/// @param source elements to be converted
+/// @param destination range to write the converted elements to
+/// @param count number of elements of each range
+[[gnu::target("avx,f16c")]] inline void convertAvx2(const Float16* source,
+                                                    float* destination,
+                                                    std::size_t count) {
+  constexpr std::size_t kLanes{8U};
+
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    _mm256_storeu_ps(destination + i,
+                     _mm256_cvtph_ps(_mm_loadu_si128(
+                         reinterpret_cast<const __m128i*>(source + i))));
+  }
+
+  convertScalar(source + i, destination + i, count - i);
+}
+
+/// @brief F16C kernel rounding floats to half-precision numbers, eight at a
+///        time, to nearest with ties to even as the scalar conversion does
+/// @param source elements to be converted
+/// @param destination range to write the converted elements to
+/// @param count number of elements of each range
+[[gnu::target("avx,f16c")]] inline void convertAvx2(const float* source,
+                                                    Float16* destination,
+                                                    std::size_t count) {
+  constexpr std::size_t kLanes{8U};
+
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(destination + i),
+        _mm256_cvtps_ph(_mm256_loadu_ps(source + i),
+                        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+  }
+
+  convertScalar(source + i, destination + i, count - i);
+}
+
+/// @brief AVX2 kernel converting bfloat16 numbers to floats, eight at a
+///        time, by shifting them into the high half of each float
+/// @param source elements to be converted
+/// @param destination range to write the converted elements to
+/// @param count number of elements of each range
+[[gnu::target("avx2")]] inline void convertAvx2(const BFloat16* source,
+                                                float* destination,
+                                                std::size_t count) {
+  constexpr std::size_t kLanes{8U};
+
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto widened{_mm256_cvtepu16_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i)))};
+    _mm256_storeu_ps(destination + i,
+                     _mm256_castsi256_ps(_mm256_slli_epi32(widened, 16)));
+  }
+
+  convertScalar(source + i, destination + i, count - i);
+}
+
+/// @brief AVX2 kernel rounding floats to bfloat16 numbers, eight at a time,
+///        to nearest with ties to even, NaNs being kept quiet, as the scalar
+///        conversion does
+/// @param source elements to be converted
+/// @param destination range to write the converted elements to
+/// @param count number of elements of each range
+[[gnu::target("avx2")]] inline void convertAvx2(const float* source,
+                                                BFloat16* destination,
+                                                std::size_t count) {
+  constexpr std::size_t kLanes{8U};
+
+  const auto one{_mm256_set1_epi32(1)};
+  const auto roundingBias{_mm256_set1_epi32(0x7FFF)};
+  const auto quietBit{_mm256_set1_epi32(0x0040)};
+
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto values{_mm256_loadu_ps(source + i)};
+    const auto bits{_mm256_castps_si256(values)};
+
+    const auto odd{_mm256_and_si256(_mm256_srli_epi32(bits, 16), one)};
+    const auto rounded{_mm256_srli_epi32(
+        _mm256_add_epi32(_mm256_add_epi32(bits, roundingBias), odd), 16)};
+    const auto quiet{
+        _mm256_or_si256(_mm256_srli_epi32(bits, 16), quietBit)};
+    const auto isNan{
+        _mm256_castps_si256(_mm256_cmp_ps(values, values, _CMP_UNORD_Q))};
+    const auto halves{_mm256_blendv_epi8(rounded, quiet, isNan)};
+
+    // packing works within 128-bit lanes, whose halves are then gathered
+    const auto packed{_mm256_permute4x64_epi64(
+        _mm256_packus_epi32(halves, halves), 0b1000)};
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i),
+                     _mm256_castsi256_si128(packed));
+  }
+
+  convertScalar(source + i, destination + i, count - i);
+}
+
+#endif
+
+/// @brief function to accumulate a range scaled by several factors into
+///        several destinations, dispatching at runtime to the widest kernel
+///        supported by the running CPU for the element type
+/// @tparam R number of destinations updated at once
+/// @tparam T type of the elements
+/// @param factors factor of each destination
+/// @param source elements to be scaled by each factor
+/// @param destinations ranges to accumulate the scaled elements into
+/// @param count number of elements of each range
+template <std::size_t R, typename T>
+void multiplyAdd(const std::array<T, R>& factors, const T* source,
+                 const std::array<T*, R>& destinations, std::size_t count) {
+#if defined(__x86_64__) || defined(__i386__)
+  if constexpr (Vectorizable<T>) {
+    switch (selectedInstructionSet().load(std::memory_order_relaxed)) {
+      case InstructionSet::kAvx512:
+        multiplyAddAvx512<Avx512Ops<T>>(factors, source, destinations, count);
+        return;
+      case InstructionSet::kAvx2:
+        multiplyAddAvx2<Avx2Ops<T>>(factors, source, destinations, count);
+        return;
+      case InstructionSet::kSse42:
+        multiplyAddSse42<Sse42Ops<T>>(factors, source, destinations, count);
+        return;
+      case InstructionSet::kScalar:
+        break;
+    }
+  }
+#endif
+
+  multiplyAddScalar(factors, source, destinations, count);
+}
+
+/// @brief function to accumulate the element-wise product of two ranges into
+///        a destination, dispatching at runtime to the widest kernel supported
+///        by the running CPU for the element type, e.g. to scale a vector by
+///        the elements of a diagonal matrix
+/// @tparam T type of the elements
+/// @param factors factor of each element of the source
+/// @param source elements to be scaled by their factors
+/// @param destination range to accumulate the scaled elements into
+/// @param count number of elements of each range
+template <typename T>
+void multiplyAddElementwise(const T* factors, const T* source, T* destination,
+                            std::size_t count) {
+#if defined(__x86_64__) || defined(__i386__)
+  if constexpr (Vectorizable<T>) {
+    switch (selectedInstructionSet().load(std::memory_order_relaxed)) {
+      case InstructionSet::kAvx512:
+        multiplyAddElementwiseAvx512<Avx512Ops<T>>(factors, source,
+                                                   destination, count);
+        return;
+      case InstructionSet::kAvx2:
+        multiplyAddElementwiseAvx2<Avx2Ops<T>>(factors, source, destination,
+                                               count);
+        return;
+      case InstructionSet::kSse42:
+        multiplyAddElementwiseSse42<Sse42Ops<T>>(factors, source, destination,
+                                                 count);
+        return;
+      case InstructionSet::kScalar:
+        break;
+    }
+  }
+#endif
+
+  multiplyAddElementwiseScalar(factors, source, destination, count);
+}
+
+/// @brief function to transpose a block into another, dispatching at runtime
+///        to the widest micro-transposes supported by the running CPU for
+///        the element type
+/// @tparam T type of the elements
+/// @param source first element of the block, stored row by row
+/// @param sourceStride distance between two consecutive rows of the source
+/// @param destination first element of the transposed block
+/// @param destinationStride distance between two consecutive rows of the
+///        destination
+/// @param rows number of rows of the source block
+/// @param columns number of columns of the source block
+/// @note the source and the destination must not overlap
+template <typename T>
+void transposeBlock(const T* source, std::size_t sourceStride, T* destination,
+                    std::size_t destinationStride, std::size_t rows,
+                    std::size_t columns) {
+#if defined(__x86_64__) || defined(__i386__)
+  if constexpr (Vectorizable<T>) {
+    const auto selected{
+        selectedInstructionSet().load(std::memory_order_relaxed)};
+
+    // AVX-512 adds nothing to shuffles of tiles this small, and there is no
+    // SSE micro-transpose of 64-bit elements worth it
+    if (selected >= InstructionSet::kAvx2) {
+      transposeBlockAvx2(source, sourceStride, destination, destinationStride,
+                         rows, columns);
+      return;
+    }
+
+    if constexpr (sizeof(T) == sizeof(float)) {
+      if (selected == InstructionSet::kSse42) {
+        transposeBlockSse42(source, sourceStride, destination,
+                            destinationStride, rows, columns);
+        return;
+      }
+    }
+  }
+#endif
+
+  transposeScalar(source, sourceStride, destination, destinationStride, rows,
+                  columns);
+}
+
+/// @brief function to compute the dot product of two ranges, dispatching at
+///        runtime to the widest kernel supported by the running CPU for the
+///        element type, e.g. to multiply a row of a matrix by a vector
+/// @tparam T type of the elements
+/// @param first elements of the first range
+/// @param second elements of the second range
+/// @param count number of elements of each range
+/// @return the sum of the products of the elements of both ranges
+/// @note the products are summed into kDotPartialSums partial sums whatever
+///       the kernel is, so that all kernels give the same result
+template <typename T>
+auto dot(const T* first, const T* second, std::size_t count) -> T {
+#if defined(__x86_64__) || defined(__i386__)
+  if constexpr (Vectorizable<T>) {
+    switch (selectedInstructionSet().load(std::memory_order_relaxed)) {
+      case InstructionSet::kAvx512:
+        return dotAvx512<Avx512Ops<T>>(first, second, count);
+      case InstructionSet::kAvx2:
+        return dotAvx2<Avx2Ops<T>>(first, second, count);
+      case InstructionSet::kSse42:
+        return dotSse42<Sse42Ops<T>>(first, second, count);
+      case InstructionSet::kScalar:
+        break;
+    }
+  }
+#endif
+
+  return dotScalar(first, second, count);
+}
+
+/// @brief concept for the pairs of element types having vectorized
+///        conversion kernels, i.e. 16-bit floating point types and float
+/// @tparam From type of the elements of the source
+/// @tparam To type of the elements of the destination
+template <typename From, typename To>
+concept VectorConvertible =
+    (HalfPrecision<From> && std::same_as<To, float>) ||
+    (std::same_as<From, float> && HalfPrecision<To>);
+
+/// @brief function to convert a range to another element type, dispatching
+///        at runtime to the vectorized kernels of the running CPU, e.g. to
+///        widen matrices stored in half-precision before they are multiplied
+/// @tparam From type of the elements of the source
+/// @tparam To type of the elements of the destination
+/// @param source elements to be converted
+/// @param destination range to write the converted elements to
+/// @param count number of elements of each range
+/// @note conversions of Float16 need F16C besides AVX2, and all kernels
+///       round as the scalar one does, so results are bit-exact
+template <typename From, typename To>
+void convert(const From* source, To* destination, std::size_t count) {
+#if defined(__x86_64__) || defined(__i386__)
+  if constexpr (VectorConvertible<From, To>) {
+    if (selectedInstructionSet().load(std::memory_order_relaxed) >=
+            InstructionSet::kAvx2 &&
+        (std::same_as<From, BFloat16> || std::same_as<To, BFloat16> ||
+         supportsF16c())) {
+      convertAvx2(source, destination, count);
+      return;
+    }
+  }
+#endif
+
+  convertScalar(source, destination, count);
+}
+
+}  // namespace data_structures::matrix_types::simd_kernels
@@ -0,0 +1,1452 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixFormat.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief a non-zero element of a sparse matrix, with its position
+/// @tparam T type of the element
+template <typename T>
+struct SparseEntry {
+  /// @brief index of the row of the element
+  std::size_t row;
+
+  /// @brief index of the column of the element
+  std::size_t column;
+
+  /// @brief value of the element
+  T value;
+
+  /// @brief equality operator
+  constexpr auto operator==(const SparseEntry&) const -> bool = default;
+};
+
+/// @brief iterator over all the elements of a line of a sparse matrix, zeros
+///        included, reading them through the subscript operator of the view
+/// @tparam View type of the view iterated over
+template <typename View>
+struct SparseLineIterator {
+  /// @brief C++ expects some properties from an iterator
+  using iterator_category = std::input_iterator_tag;
+  using iterator_concept = std::forward_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = typename View::value_type;
+  using pointer = void;
+  using reference = value_type;
+
+  /// @brief dereference operator
+  constexpr auto operator*() const { return (*m_view)[m_index]; }
+
+  /// @brief prefix increment operator
+  /// @return incremented iterator
+  constexpr auto operator++() noexcept -> SparseLineIterator& {
+    ++m_index;
+    return *this;
+  }
+
+  /// @brief postfix increment operator
+  /// @return iterator before incrementing
+  constexpr auto operator++(int) noexcept -> SparseLineIterator {
+    auto copy{*this};
+    ++m_index;
+    return copy;
+  }
+
+  /// @brief equality operator
+  constexpr auto operator==(const SparseLineIterator& other) const noexcept
+      -> bool = default;
+
+  /// @brief the view iterated over
+  const View* m_view{nullptr};
+
+  /// @brief logical index the iterator is pointing at
+  std::size_t m_index{0U};
+};
+
+/// @brief non-owning view of a line of a sparse matrix that is stored
+///        compressed, i.e. as the sorted indices of its non-zero elements
+///        along with their values, e.g. a row of a CSR matrix
+/// @tparam T type of the elements
+/// @note the view must not outlive the matrix it was taken from
+template <typename T>
+class CompressedLineView {
+public:
+  /// @brief type alias for T, as for standard containers
+  using value_type = T;
+
+  /// @brief default constructor of an empty view
+  constexpr CompressedLineView() = default;
+
+  /// @brief constructor of a view
+  /// @param indices sorted indices of the non-zero elements of the line
+  /// @param values values of the non-zero elements of the line
+  /// @param size logical length of the line, zeros included
+  constexpr CompressedLineView(std::span<const std::size_t> indices,
+                               std::span<const T> values,
+                               std::size_t size) noexcept
+      : m_indices{indices}, m_values{values}, m_size{size} {}
+
+  /// @brief method to show the length of the line, zeros included
+  /// @return length of the line
+  [[nodiscard]] constexpr auto size() const noexcept { return m_size; }
+
+  /// @brief method to return the indices of the non-zero elements
+  /// @return sorted indices of the non-zero elements
+  [[nodiscard]] constexpr auto indices() const noexcept { return m_indices; }
+
+  /// @brief method to return the values of the non-zero elements
+  /// @return values of the non-zero elements
+  [[nodiscard]] constexpr auto values() const noexcept { return m_values; }
+
+  /// @brief subscript operator
+  /// @param index logical index in the line
+  /// @return the element at the index, zero if it is not stored
+  constexpr auto operator[](std::size_t index) const -> T {
+    const auto found{std::ranges::lower_bound(m_indices, index)};
+    return (found != m_indices.end() && *found == index)
+               ? m_values[static_cast<std::size_t>(found - m_indices.begin())]
+               : T{};
+  }
+
+  /// @brief method that returns iterator to first element
+  [[nodiscard]] constexpr auto begin() const noexcept {
+    return SparseLineIterator<CompressedLineView>{this, 0U};
+  }
+
+  /// @brief method that returns iterator past the last element
+  [[nodiscard]] constexpr auto end() const noexcept {
+    return SparseLineIterator<CompressedLineView>{this, m_size};
+  }
+
+  /// @brief method to copy a range of the line, writing the zeros between
+  ///        the non-zero elements as they come
+  /// @param begin first logical index to copy
+  /// @param end past the last logical index to copy
+  /// @param out iterator to the beginning of the destination
+  /// @return iterator past the last element written
+  constexpr auto copyTo(std::size_t begin, std::size_t end, auto out) const {
+    auto index{begin};
+    const auto first{std::ranges::lower_bound(m_indices, begin)};
+    for (auto position{static_cast<std::size_t>(first - m_indices.begin())};
+         position < m_indices.size() && m_indices[position] < end;
+         ++position) {
+      out = std::fill_n(out, m_indices[position] - index, T{});
+      *out++ = m_values[position];
+      index = m_indices[position] + 1U;
+    }
+
+    return std::fill_n(out, end - index, T{});
+  }
+
+  /// @brief overload of the method above copying the whole line
+  /// @param out iterator to the beginning of the destination
+  /// @return iterator past the last element written
+  constexpr auto copyTo(auto out) const { return copyTo(0U, m_size, out); }
+
+  /// @brief equality operator with a view of any kind
+  /// @param other the other view to compare against
+  /// @return whether both lines have the same elements or not
+  constexpr auto operator==(const auto& other) const -> bool {
+    return m_size == other.size() && std::equal(begin(), end(), other.begin());
+  }
+
+private:
+  /// @brief sorted indices of the non-zero elements
+  std::span<const std::size_t> m_indices;
+
+  /// @brief values of the non-zero elements
+  std::span<const T> m_values;
+
+  /// @brief logical length of the line, zeros included
+  std::size_t m_size{0U};
+};
+
+/// @brief non-owning view of a line of a sparse matrix that is not stored
+///        compressed along it, e.g. a column of a CSR matrix, its elements
+///        are looked up one by one through element(row, column)
+/// @tparam MatrixT type of the matrix viewed
+/// @note the view must not outlive the matrix it was taken from
+template <typename MatrixT>
+class LookupLineView {
+public:
+  /// @brief type alias for the elements, as for standard containers
+  using value_type = typename MatrixT::value_type;
+
+  /// @brief constructor of a view
+  /// @param matrix the matrix viewed
+  /// @param index index of the line in the matrix
+  /// @param isRow whether the line is a row, or a column
+  constexpr LookupLineView(const MatrixT& matrix, std::size_t index,
+                           bool isRow) noexcept
+      : m_matrix{&matrix}, m_index{index}, m_isRow{isRow} {}
+
+  /// @brief method to show the length of the line, zeros included
+  /// @return length of the line
+  [[nodiscard]] constexpr auto size() const noexcept {
+    return m_isRow ? matrix_common::numberOfColumns(*m_matrix)
+                   : matrix_common::numberOfRows(*m_matrix);
+  }
+
+  /// @brief subscript operator
+  /// @param index logical index in the line
+  /// @return the element at the index, zero if it is not stored
+  constexpr auto operator[](std::size_t index) const -> value_type {
+    return m_isRow ? m_matrix->element(m_index, index)
+                   : m_matrix->element(index, m_index);
+  }
+
+  /// @brief method that returns iterator to first element
+  [[nodiscard]] constexpr auto begin() const noexcept {
+    return SparseLineIterator<LookupLineView>{this, 0U};
+  }
+
+  /// @brief method that returns iterator past the last element
+  [[nodiscard]] constexpr auto end() const noexcept {
+    return SparseLineIterator<LookupLineView>{this, size()};
+  }
+
+  /// @brief method to copy a range of the line
+  /// @param begin first logical index to copy
+  /// @param end past the last logical index to copy
+  /// @param out iterator to the beginning of the destination
+  /// @return iterator past the last element written
+  constexpr auto copyTo(std::size_t begin, std::size_t end, auto out) const {
+    for (auto index{begin}; index < end; ++index) {
+      *out++ = (*this)[index];
+    }
+
+    return out;
+  }
+
+  /// @brief overload of the method above copying the whole line
+  /// @param out iterator to the beginning of the destination
+  /// @return iterator past the last element written
+  constexpr auto copyTo(auto out) const { return copyTo(0U, size(), out); }
+
+  /// @brief equality operator with a view of any kind
+  /// @param other the other view to compare against
+  /// @return whether both lines have the same elements or not
+  constexpr auto operator==(const auto& other) const -> bool {
+    return size() == other.size() && std::equal(begin(), end(), other.begin());
+  }
+
+private:
+  /// @brief pointer to the matrix viewed
+  const MatrixT* m_matrix;
+
+  /// @brief index of the line in the matrix
+  std::size_t m_index;
+
+  /// @brief whether the line is a row, or a column
+  bool m_isRow;
+};
+
+/// @brief axis along which a sparse matrix is compressed
+enum class SparseAxis : std::uint8_t {
+  kRows,    // compressed sparse row (CSR)
+  kColumns  // compressed sparse column (CSC)
+};
+
+/// @brief namespace for common data between matrices types
+namespace matrix_common {
+
+/// @brief helper function to collect the non-zero elements of any matrix type
+/// @param matrix the matrix in question
+/// @return non-zero elements of the matrix
+/// @note sparse matrices types hand over their entries, others are scanned
+///       row by row
+template <typename MatrixT>
+auto collectEntries(const MatrixT& matrix) {
+  using value_type = typename MatrixT::value_type;
+
+  if constexpr (requires { matrix.entries(); }) {
+    return matrix.entries();
+  } else {
+    const auto rows{numberOfRows(matrix)};
+    const auto columns{numberOfColumns(matrix)};
+
+    std::vector<SparseEntry<value_type>> entries;
+    std::vector<value_type> currentRow(columns);
+    for (std::size_t rowIndex{0U}; rowIndex < rows; ++rowIndex) {
+      matrix.rowView(rowIndex).copyTo(currentRow.begin());
+      for (std::size_t columnIndex{0U}; columnIndex < columns; ++columnIndex) {
+        if (currentRow[columnIndex] != value_type{}) {
+          entries.push_back({rowIndex, columnIndex, currentRow[columnIndex]});
+        }
+      }
+    }
+
+    return entries;
+  }
+}
+
+/// @brief helper function to collect the entries of the sum of two matrices,
+///        the second one scaled by a factor
+/// @param first first operand
+/// @param second second operand, of any matrix type
+/// @param factor factor to scale the second operand by, e.g. -1 to subtract
+/// @param operation name of the operation, used in the error message
+/// @return entries of both operands, duplicates are summed up once they are
+///         canonicalized
+/// @throw std::invalid_argument if dimensions are not the same
+template <typename T>
+auto sumEntries(const auto& first, const auto& second, const T& factor,
+                const char* operation) {
+  checkSameDimensions(first, second, operation);
+
+  auto entries{collectEntries(first)};
+  for (auto entry : collectEntries(second)) {
+    entry.value *= factor;
+    entries.push_back(entry);
+  }
+
+  return entries;
+}
+
+/// @brief helper function to check the position of every entry is within the
+///        dimensions of the matrix
+/// @param entries entries of the matrix
+/// @param rows number of rows of the matrix
+/// @param columns number of columns of the matrix
+/// @throw std::out_of_range if any entry is outside the matrix
+template <typename T>
+void checkEntries(const std::vector<SparseEntry<T>>& entries, std::size_t rows,
+                  std::size_t columns) {
+  for (const auto& entry : entries) {
+    if (entry.row >= rows || entry.column >= columns) {
+      throw std::out_of_range(std::format(
+          "Entry at ({}, {}) is outside [{}*{}] matrix", entry.row,
+          entry.column, rows, columns));
+    }
+  }
+}
+
+/// @brief helper function to sort entries in row-major order, summing the
+///        duplicate ones and dropping zeros
+/// @param entries entries to be sorted
+/// @return canonical entries
+template <typename T>
+auto canonicalizeEntries(std::vector<SparseEntry<T>> entries) {
+  std::ranges::sort(entries, [](const auto& lhs, const auto& rhs) {
+    return std::pair{lhs.row, lhs.column} < std::pair{rhs.row, rhs.column};
+  });
+
+  std::vector<SparseEntry<T>> result;
+  result.reserve(entries.size());
+  for (const auto& entry : entries) {
+    if (!result.empty() && result.back().row == entry.row &&
+        result.back().column == entry.column) {
+      result.back().value += entry.value;
+    } else {
+      result.push_back(entry);
+    }
+  }
+  std::erase_if(result, [](const auto& entry) { return entry.value == T{}; });
+
+  return result;
+}
+
+/// @brief helper function to check the length of a vector to be multiplied
+/// @param vector the vector in question
+/// @param columns number of columns of the matrix multiplied
+/// @throw std::invalid_argument if the vector is of different length
+template <typename T>
+void checkVectorLength(std::span<const T> vector, std::size_t columns) {
+  if (vector.size() != columns) {
+    throw std::invalid_argument(
+        std::format("Cannot multiply matrix of {} columns by vector of {} "
+                    "elements",
+                    columns, vector.size()));
+  }
+}
+
+/// @brief compressed storage of a sparse matrix along one axis, the outer one
+///        being the rows for CSR and the columns for CSC
+/// @tparam T type of the elements
+template <typename T>
+struct CompressedStorage {
+  /// @brief position of the first element of each outer line, followed by
+  ///        the number of non-zero elements
+  std::vector<std::size_t> offsets;
+
+  /// @brief inner indices of the non-zero elements, sorted within each line
+  std::vector<std::size_t> indices;
+
+  /// @brief values of the non-zero elements
+  std::vector<T> values;
+};
+
+/// @brief helper function to compress entries along the outer axis, by a
+///        counting sort of their outer indices
+/// @param entries canonical entries, i.e. in row-major order with no duplicate
+/// @param outerCount number of outer lines
+/// @param isRowMajor whether the outer axis is the rows, or the columns
+/// @return the compressed storage
+/// @note since entries are in row-major order, the stable counting sort keeps
+///       inner indices sorted within each outer line for both axes
+template <typename T>
+auto compressEntries(const std::vector<SparseEntry<T>>& entries,
+                     std::size_t outerCount, bool isRowMajor) {
+  const auto outerOf{[isRowMajor](const auto& entry) {
+    return isRowMajor ? entry.row : entry.column;
+  }};
+
+  CompressedStorage<T> storage{std::vector<std::size_t>(outerCount + 1U, 0U),
+                               std::vector<std::size_t>(entries.size()),
+                               std::vector<T>(entries.size())};
+
+  for (const auto& entry : entries) {
+    ++storage.offsets[outerOf(entry) + 1U];
+  }
+  std::partial_sum(storage.offsets.begin(), storage.offsets.end(),
+                   storage.offsets.begin());
+
+  std::vector<std::size_t> positions(storage.offsets.begin(),
+                                     storage.offsets.end() - 1);
+  for (const auto& entry : entries) {
+    const auto position{positions[outerOf(entry)]++};
+    storage.indices[position] = isRowMajor ? entry.column : entry.row;
+    storage.values[position] = entry.value;
+  }
+
+  return storage;
+}
+
+/// @brief helper function to multiply two compressed matrices by Gustavson's
+///        algorithm, i.e. each outer line of the result is accumulated from
+///        the outer lines of the second operand, scaled by the elements of
+///        the corresponding outer line of the first operand
+/// @param first first operand, its inner indices index the outer lines of the
+///        second one
+/// @param second second operand
+/// @param innerSize length of the outer lines of the result
+/// @return the compressed storage of the result
+/// @note for CSR operands this computes first * second, and for CSC ones it
+///       is called with swapped operands to compute second * first
+template <typename T>
+auto multiplyCompressed(const CompressedStorage<T>& first,
+                        const CompressedStorage<T>& second,
+                        std::size_t innerSize) {
+  const auto outerCount{first.offsets.size() - 1U};
+  constexpr auto kUntouched{std::numeric_limits<std::size_t>::max()};
+
+  CompressedStorage<T> result;
+  result.offsets.reserve(outerCount + 1U);
+  result.offsets.push_back(0U);
+
+  // dense accumulator, with the last outer line that touched each element
+  std::vector<T> accumulator(innerSize);
+  std::vector<std::size_t> touchedBy(innerSize, kUntouched);
+  std::vector<std::size_t> touched;
+
+  for (std::size_t outer{0U}; outer < outerCount; ++outer) {
+    touched.clear();
+    for (auto p{first.offsets[outer]}; p < first.offsets[outer + 1U]; ++p) {
+      const auto middle{first.indices[p]};
+      const auto factor{first.values[p]};
+
+      for (auto q{second.offsets[middle]}; q < second.offsets[middle + 1U];
+           ++q) {
+        const auto inner{second.indices[q]};
+        if (touchedBy[inner] != outer) {
+          touchedBy[inner] = outer;
+          accumulator[inner] = T{};
+          touched.push_back(inner);
+        }
+        accumulator[inner] += factor * second.values[q];
+      }
+    }
+
+    std::ranges::sort(touched);
+    for (const auto inner : touched) {
+      if (accumulator[inner] != T{}) {
+        result.indices.push_back(inner);
+        result.values.push_back(accumulator[inner]);
+      }
+    }
+    result.offsets.push_back(result.indices.size());
+  }
+
+  return result;
+}
+
+}  // namespace matrix_common
+
+/// @brief forward declaration of the compressed sparse matrix, which
+///        coordinate matrices are converted to for multiplication
+template <SparseAxis AXIS, typename T>
+class CompressedSparseMatrix;
+
+/// @brief definition of class representing a sparse matrix in coordinate
+///        (COO) format, i.e. a list of its non-zero elements with their
+///        positions, which is mostly useful to assemble sparse matrices
+/// @tparam T type of elements of matrix, default is std::size_t
+/// @note entries are kept in row-major order in separate arrays, so that the
+///       entries of a row are contiguous
+template <typename T = std::size_t>
+class CooMatrix {
+public:
+  /// @brief to handle when passing empty list, resulting in [0*0] matrix
+  CooMatrix() = default;
+
+  /// @brief constructor of a matrix of the given dimensions from its entries
+  /// @param rows number of rows of the matrix
+  /// @param columns number of columns of the matrix
+  /// @param entries non-zero elements of the matrix in any order, duplicate
+  ///        entries are summed up
+  /// @throw std::out_of_range if any entry is outside the matrix
+  CooMatrix(std::size_t rows, std::size_t columns,
+            std::vector<SparseEntry<T>> entries = {})
+      : m_rows{rows}, m_columns{columns} {
+    matrix_common::checkEntries(entries, m_rows, m_columns);
+    for (const auto& entry :
+         matrix_common::canonicalizeEntries(std::move(entries))) {
+      m_rowIndices.push_back(entry.row);
+      m_columnIndices.push_back(entry.column);
+      m_values.push_back(entry.value);
+    }
+  }
+
+  /// @brief overload of the constructor above accepting braced init list
+  /// @param rows number of rows of the matrix
+  /// @param columns number of columns of the matrix
+  /// @param entries non-zero elements of the matrix in any order
+  CooMatrix(std::size_t rows, std::size_t columns,
+            std::initializer_list<SparseEntry<T>> entries)
+      : CooMatrix(rows, columns, std::vector<SparseEntry<T>>(entries)) {}
+
+  /// @brief converting constructor from any other matrix type
+  /// @param matrix the matrix to copy the non-zero elements of
+  template <typename MatrixT>
+    requires(!std::is_same_v<MatrixT, CooMatrix> &&
+             std::is_same_v<typename MatrixT::value_type, T>)
+  explicit CooMatrix(const MatrixT& matrix)
+      : CooMatrix(matrix_common::numberOfRows(matrix),
+                  matrix_common::numberOfColumns(matrix),
+                  matrix_common::collectEntries(matrix)) {}
+
+  /// @brief a method to return the [n*m] dimensions of the matrix
+  /// @return a DynamicDimensions object representing [n*m] dimensions
+  [[nodiscard]] constexpr auto dimensions() const noexcept {
+    return matrix_common::DynamicDimensions{m_rows, m_columns};
+  }
+
+  /// @brief method to show the number of non-zero elements
+  /// @return the number of non-zero elements
+  [[nodiscard]] auto numberOfNonZeros() const noexcept {
+    return m_values.size();
+  }
+
+  /// @brief method to return the non-zero elements of the matrix
+  /// @return non-zero elements in row-major order
+  [[nodiscard]] auto entries() const {
+    std::vector<SparseEntry<T>> result;
+    result.reserve(m_values.size());
+    for (std::size_t i{0U}; i < m_values.size(); ++i) {
+      result.push_back({m_rowIndices[i], m_columnIndices[i], m_values[i]});
+    }
+
+    return result;
+  }
+
+  /// @brief method to return the element at a given position
+  /// @param row index of the row of the element
+  /// @param column index of the column of the element
+  /// @return the element, zero if it is not stored
+  /// @note no range checking is done here
+  [[nodiscard]] auto element(std::size_t row, std::size_t column) const -> T {
+    return rowView(row)[column];
+  }
+
+  /// @brief method to return the row in matrix at a given index
+  /// @param index at which row should be returned
+  /// @return the row at the given index, zeros included
+  auto row(std::size_t index) const -> std::vector<T> {
+    if (m_rows == 0U) {
+      throw std::out_of_range("Matrix has no rows");
+    }
+    if (index >= m_rows) {
+      throw std::out_of_range(
+          std::format("Rows must be within the range: 0 - {}", m_rows - 1U));
+    }
+
+    std::vector<T> result(m_columns);
+    rowView(index).copyTo(result.begin());
+
+    return result;
+  }
+
+  /// @brief method to return the column at the given index
+  /// @param index order of the column in the matrix
+  /// @return the column at the given index, zeros included
+  auto column(std::size_t index) const -> std::vector<T> {
+    if (m_columns == 0U) {
+      throw std::out_of_range("Matrix has no columns");
+    }
+    if (index >= m_columns) {
+      throw std::out_of_range(std::format(
+          "Columns must be within the range: 0 - {}", m_columns - 1U));
+    }
+
+    std::vector<T> result(m_rows);
+    columnView(index).copyTo(result.begin());
+
+    return result;
+  }
+
+  /// @brief method to return a view of the row at a given index, reading
+  ///        directly from the entries of the matrix
+  /// @param index at which row should be viewed
+  /// @return view of the row at the given index
+  /// @note no range checking is done here
+  [[nodiscard]] auto rowView(std::size_t index) const {
+    const auto [first, last]{std::ranges::equal_range(m_rowIndices, index)};
+    const auto begin{static_cast<std::size_t>(first - m_rowIndices.begin())};
+    const auto count{static_cast<std::size_t>(last - first)};
+
+    return CompressedLineView<T>{
+        std::span{m_columnIndices}.subspan(begin, count),
+        std::span{m_values}.subspan(begin, count), m_columns};
+  }
+
+  /// @brief method to return a view of the column at a given index
+  /// @param index at which column should be viewed
+  /// @return view of the column at the given index, looking its elements up
+  /// @note no range checking is done here
+  [[nodiscard]] auto columnView(std::size_t index) const noexcept {
+    return LookupLineView<CooMatrix>{*this, index, false};
+  }
+
+  /// @brief method that returns RowsIterator to traverse through each row
+  /// @return RowsIterator object pointing to first row, yielding views
+  [[nodiscard]] auto rows() const noexcept {
+    return matrix_common::RowsIterator<CooMatrix>(*this);
+  }
+
+  /// @brief method that returns ColumnsIterator to traverse through
+  ///        each column
+  /// @return ColumnsIterator object pointing to first column, yielding views
+  [[nodiscard]] auto columns() const noexcept {
+    return matrix_common::ColumnsIterator<CooMatrix>(*this);
+  }
+
+  /// @brief method to multiply the matrix by a dense vector
+  /// @param vector the vector, of as many elements as columns of the matrix
+  /// @return the product, of as many elements as rows of the matrix
+  /// @throw std::invalid_argument if the vector is of different length
+  auto multiplyVector(std::span<const T> vector) const -> std::vector<T> {
+    matrix_common::checkVectorLength(vector, m_columns);
+
+    std::vector<T> result(m_rows);
+    for (std::size_t i{0U}; i < m_values.size(); ++i) {
+      result[m_rowIndices[i]] += m_values[i] * vector[m_columnIndices[i]];
+    }
+
+    return result;
+  }
+
+  /// @brief method to multiply the matrix by a vector and to accumulate the
+  ///        scaled product into another vector, y = alpha * A * x + beta * y
+  ///        (GEMV)
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  /// @note x and y must not overlap
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result) const {
+    matrix_common::checkGemvLengths(*this, vector.size(), result.size());
+    matrix_common::scaleAccumulated(beta, result);
+
+    for (std::size_t i{0U}; i < m_values.size(); ++i) {
+      result[m_rowIndices[i]] +=
+          alpha * (m_values[i] * vector[m_columnIndices[i]]);
+    }
+  }
+
+  /// @brief generic multiplication operator
+  /// @param otherMatrix the second operand of multiplication
+  /// @return the product, as CSR matrix when multiplied by a sparse matrix,
+  ///         or as DynamicMatrix otherwise
+  /// @throw std::invalid_argument if dimensions are not compatible
+  /// @note the matrix is converted to CSR format for multiplication
+  auto operator*(const auto& otherMatrix) const {
+    return CompressedSparseMatrix<SparseAxis::kRows, T>{*this} * otherMatrix;
+  }
+
+  /// @brief compound addition operator, adding another matrix of the same
+  ///        dimensions to this one
+  /// @param otherMatrix the matrix to add, of any matrix type
+  /// @return reference to this matrix
+  /// @throw std::invalid_argument if dimensions are not the same
+  /// @note the sparsity pattern of the sum differs in general, so the
+  ///       storage is rebuilt from the entries of both
+  auto operator+=(const auto& otherMatrix) -> CooMatrix& {
+    *this = CooMatrix(
+        m_rows, m_columns,
+        matrix_common::sumEntries(*this, otherMatrix, T{1}, "add"));
+    return *this;
+  }
+
+  /// @brief compound subtraction operator, subtracting another matrix of the
+  ///        same dimensions from this one
+  /// @param otherMatrix the matrix to subtract, of any matrix type
+  /// @return reference to this matrix
+  /// @throw std::invalid_argument if dimensions are not the same
+  /// @note the sparsity pattern of the difference differs in general, so the
+  ///       storage is rebuilt from the entries of both
+  auto operator-=(const auto& otherMatrix) -> CooMatrix& {
+    *this = CooMatrix(m_rows, m_columns,
+                      matrix_common::sumEntries(*this, otherMatrix, T{} - T{1},
+                                                "subtract"));
+    return *this;
+  }
+
+  /// @brief compound multiplication operator by a scalar
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  auto operator*=(const T& factor) -> CooMatrix& { return scale(factor); }
+
+  /// @brief method to multiply all non-zero elements by a scalar in place
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  /// @note scaling by zero drops all the entries
+  auto scale(const T& factor) -> CooMatrix& {
+    if (factor == T{}) {
+      *this = CooMatrix(m_rows, m_columns);
+    } else {
+      for (auto& value : m_values) {
+        value *= factor;
+      }
+    }
+
+    return *this;
+  }
+
+  /// @brief method to check whether matrix type is symmetric or not
+  /// @return true if matrix is symmetric, false otherwise
+  [[nodiscard]] auto isSymmetric() const -> bool {
+    if (m_rows != m_columns) {
+      return false;
+    }
+
+    for (std::size_t i{0U}; i < m_values.size(); ++i) {
+      if (element(m_columnIndices[i], m_rowIndices[i]) != m_values[i]) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /// @brief method to check whether all elements are zeros beyond a number of
+  ///        diagonals on both sides of the main one
+  /// @param bandwidth number of diagonals allowed on each side
+  /// @return true if matrix is square and banded, false otherwise
+  [[nodiscard]] auto isBanded(std::size_t bandwidth) const noexcept -> bool {
+    if (m_rows != m_columns) {
+      return false;
+    }
+
+    for (std::size_t i{0U}; i < m_values.size(); ++i) {
+      const auto row{m_rowIndices[i]};
+      const auto column{m_columnIndices[i]};
+      if ((row > column ? row - column : column - row) > bandwidth) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /// @brief method to check whether all elements off the diagonal are zeros
+  /// @return true if matrix is square and diagonal, false otherwise
+  [[nodiscard]] auto isDiagonal() const noexcept -> bool {
+    return isBanded(0U);
+  }
+
+  /// @brief method to check whether all elements above the diagonal are zeros
+  /// @return true if matrix is square and lower triangular, false otherwise
+  [[nodiscard]] auto isLowerTriangular() const noexcept -> bool {
+    if (m_rows != m_columns) {
+      return false;
+    }
+
+    for (std::size_t i{0U}; i < m_values.size(); ++i) {
+      if (m_columnIndices[i] > m_rowIndices[i]) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /// @brief method to display elements of the matrix, zeros included
+  /// @return elements surrounded by matrix symbol
+  [[nodiscard]] auto display() const -> std::string {
+    std::string result;
+    formatMatrixTo(std::back_inserter(result), *this);
+
+    return result;
+  }
+
+  /// @brief type alias for T, used for assertions
+  using value_type = T;
+
+private:
+  /// @brief number of rows of the matrix
+  std::size_t m_rows{0U};
+
+  /// @brief number of columns of the matrix
+  std::size_t m_columns{0U};
+
+  /// @brief row indices of the non-zero elements, in ascending order
+  std::vector<std::size_t> m_rowIndices;
+
+  /// @brief column indices of the non-zero elements, ascending in each row
+  std::vector<std::size_t> m_columnIndices;
+
+  /// @brief values of the non-zero elements
+  std::vector<T> m_values;
+};
+
+/// @brief definition of class representing a sparse matrix compressed along
+///        one axis, i.e. CSR when compressed along the rows and CSC when
+///        compressed along the columns, use the aliases CsrMatrix and
+///        CscMatrix below
+/// @tparam AXIS the axis along which the matrix is compressed
+/// @tparam T type of elements of matrix
+template <SparseAxis AXIS, typename T>
+class CompressedSparseMatrix {
+  /// @brief whether the matrix is compressed along the rows or not
+  static constexpr bool kIsRowMajor{AXIS == SparseAxis::kRows};
+
+public:
+  /// @brief to handle when passing empty list, resulting in [0*0] matrix
+  CompressedSparseMatrix() : m_storage{{0U}, {}, {}} {}
+
+  /// @brief constructor of a matrix of the given dimensions from its entries
+  /// @param rows number of rows of the matrix
+  /// @param columns number of columns of the matrix
+  /// @param entries non-zero elements of the matrix in any order, duplicate
+  ///        entries are summed up
+  /// @throw std::out_of_range if any entry is outside the matrix
+  CompressedSparseMatrix(std::size_t rows, std::size_t columns,
+                         std::vector<SparseEntry<T>> entries = {})
+      : m_rows{rows}, m_columns{columns} {
+    matrix_common::checkEntries(entries, m_rows, m_columns);
+    m_storage = matrix_common::compressEntries(
+        matrix_common::canonicalizeEntries(std::move(entries)), outerCount(),
+        kIsRowMajor);
+  }
+
+  /// @brief overload of the constructor above accepting braced init list
+  /// @param rows number of rows of the matrix
+  /// @param columns number of columns of the matrix
+  /// @param entries non-zero elements of the matrix in any order
+  CompressedSparseMatrix(std::size_t rows, std::size_t columns,
+                         std::initializer_list<SparseEntry<T>> entries)
+      : CompressedSparseMatrix(rows, columns,
+                               std::vector<SparseEntry<T>>(entries)) {}
+
+  /// @brief constructor taking the compressed arrays directly, e.g. those of
+  ///        a graph read from somewhere else
+  /// @param rows number of rows of the matrix
+  /// @param columns number of columns of the matrix
+  /// @param offsets position of the first element of each outer line, i.e.
+  ///        row for CSR and column for CSC, followed by the number of
+  ///        non-zero elements
+  /// @param indices inner indices of the non-zero elements, sorted within
+  ///        each outer line
+  /// @param values values of the non-zero elements
+  /// @throw std::invalid_argument if the arrays are not consistent
+  CompressedSparseMatrix(std::size_t rows, std::size_t columns,
+                         std::vector<std::size_t> offsets,
+                         std::vector<std::size_t> indices,
+                         std::vector<T> values)
+      : m_rows{rows},
+        m_columns{columns},
+        m_storage{std::move(offsets), std::move(indices), std::move(values)} {
+    checkStorage();
+  }
+
+  /// @brief converting constructor from any other matrix type, sparse ones
+  ///        are converted in time proportional to their non-zero elements
+  /// @param matrix the matrix to copy the non-zero elements of
+  template <typename MatrixT>
+    requires(!std::is_same_v<MatrixT, CompressedSparseMatrix> &&
+             std::is_same_v<typename MatrixT::value_type, T>)
+  explicit CompressedSparseMatrix(const MatrixT& matrix)
+      : m_rows{matrix_common::numberOfRows(matrix)},
+        m_columns{matrix_common::numberOfColumns(matrix)},
+        m_storage{matrix_common::compressEntries(
+            matrix_common::collectEntries(matrix), outerCount(),
+            kIsRowMajor)} {}
+
+  /// @brief a method to return the [n*m] dimensions of the matrix
+  /// @return a DynamicDimensions object representing [n*m] dimensions
+  [[nodiscard]] constexpr auto dimensions() const noexcept {
+    return matrix_common::DynamicDimensions{m_rows, m_columns};
+  }
+
+  /// @brief method to show the number of non-zero elements
+  /// @return the number of non-zero elements
+  [[nodiscard]] auto numberOfNonZeros() const noexcept {
+    return m_storage.values.size();
+  }
+
+  /// @brief method to return the position of the first element of each outer
+  ///        line, followed by the number of non-zero elements
+  /// @return offsets of the outer lines
+  [[nodiscard]] auto offsets() const noexcept -> std::span<const std::size_t> {
+    return m_storage.offsets;
+  }
+
+  /// @brief method to return the inner indices of the non-zero elements
+  /// @return inner indices, sorted within each outer line
+  [[nodiscard]] auto indices() const noexcept -> std::span<const std::size_t> {
+    return m_storage.indices;
+  }
+
+  /// @brief method to return the values of the non-zero elements
+  /// @return values of the non-zero elements
+  [[nodiscard]] auto values() const noexcept -> std::span<const T> {
+    return m_storage.values;
+  }
+
+  /// @brief method to return the non-zero elements of the matrix
+  /// @return non-zero elements in row-major order
+  [[nodiscard]] auto entries() const {
+    std::vector<SparseEntry<T>> result;
+    result.reserve(numberOfNonZeros());
+    forEachNonZero([&result](std::size_t row, std::size_t column, T value) {
+      result.push_back({row, column, value});
+    });
+
+    if constexpr (!kIsRowMajor) {
+      // stable, since entries of each column are already sorted by row
+      std::ranges::stable_sort(result, {}, &SparseEntry<T>::row);
+    }
+
+    return result;
+  }
+
+  /// @brief method to return the element at a given position
+  /// @param row index of the row of the element
+  /// @param column index of the column of the element
+  /// @return the element, zero if it is not stored
+  /// @note no range checking is done here
+  [[nodiscard]] auto element(std::size_t row, std::size_t column) const -> T {
+    return kIsRowMajor ? outerView(row)[column] : outerView(column)[row];
+  }
+
+  /// @brief method to return the row in matrix at a given index
+  /// @param index at which row should be returned
+  /// @return the row at the given index, zeros included
+  auto row(std::size_t index) const -> std::vector<T> {
+    if (m_rows == 0U) {
+      throw std::out_of_range("Matrix has no rows");
+    }
+    if (index >= m_rows) {
+      throw std::out_of_range(
+          std::format("Rows must be within the range: 0 - {}", m_rows - 1U));
+    }
+
+    std::vector<T> result(m_columns);
+    rowView(index).copyTo(result.begin());
+
+    return result;
+  }
+
+  /// @brief method to return the column at the given index
+  /// @param index order of the column in the matrix
+  /// @return the column at the given index, zeros included
+  auto column(std::size_t index) const -> std::vector<T> {
+    if (m_columns == 0U) {
+      throw std::out_of_range("Matrix has no columns");
+    }
+    if (index >= m_columns) {
+      throw std::out_of_range(std::format(
+          "Columns must be within the range: 0 - {}", m_columns - 1U));
+    }
+
+    std::vector<T> result(m_rows);
+    columnView(index).copyTo(result.begin());
+
+    return result;
+  }
+
+  /// @brief method to return a view of the row at a given index
+  /// @param index at which row should be viewed
+  /// @return compressed view of the row for CSR, a view looking its elements
+  ///         up for CSC
+  /// @note no range checking is done here
+  [[nodiscard]] auto rowView(std::size_t index) const noexcept {
+    if constexpr (kIsRowMajor) {
+      return outerView(index);
+    } else {
+      return LookupLineView<CompressedSparseMatrix>{*this, index, true};
+    }
+  }
+
+  /// @brief method to return a view of the column at a given index
+  /// @param index at which column should be viewed
+  /// @return compressed view of the column for CSC, a view looking its
+  ///         elements up for CSR
+  /// @note no range checking is done here
+  [[nodiscard]] auto columnView(std::size_t index) const noexcept {
+    if constexpr (kIsRowMajor) {
+      return LookupLineView<CompressedSparseMatrix>{*this, index, false};
+    } else {
+      return outerView(index);
+    }
+  }
+
+  /// @brief method that returns RowsIterator to traverse through each row
+  /// @return RowsIterator object pointing to first row, yielding views
+  [[nodiscard]] auto rows() const noexcept {
+    return matrix_common::RowsIterator<CompressedSparseMatrix>(*this);
+  }
+
+  /// @brief method that returns ColumnsIterator to traverse through
+  ///        each column
+  /// @return ColumnsIterator object pointing to first column, yielding views
+  [[nodiscard]] auto columns() const noexcept {
+    return matrix_common::ColumnsIterator<CompressedSparseMatrix>(*this);
+  }
+
+  /// @brief method to multiply the matrix by a dense vector (SpMV)
+  /// @param vector the vector, of as many elements as columns of the matrix
+  /// @return the product, of as many elements as rows of the matrix
+  /// @throw std::invalid_argument if the vector is of different length
+  /// @note for CSR, products with as many non-zero elements as
+  ///       matrix_common::parallelThreshold() run over
+  ///       common::ThreadPool::shared(), while CSC always runs serially, as
+  ///       its columns scatter into the whole result
+  auto multiplyVector(std::span<const T> vector) const -> std::vector<T> {
+    if constexpr (kIsRowMajor) {
+      if (numberOfNonZeros() >=
+          matrix_common::parallelThreshold().load(std::memory_order_relaxed)) {
+        return multiplyVector(vector, common::ThreadPool::shared());
+      }
+
+      common::SerialExecutor executor;
+      return multiplyVector(vector, executor);
+    } else {
+      matrix_common::checkVectorLength(vector, m_columns);
+
+      std::vector<T> result(m_rows);
+      forEachNonZero([&result, vector](std::size_t row, std::size_t column,
+                                       T value) {
+        result[row] += value * vector[column];
+      });
+
+      return result;
+    }
+  }
+
+  /// @brief overload of the method above that runs on the given executor,
+  ///        blocks of rows of the result being computed independently
+  /// @param vector the vector, of as many elements as columns of the matrix
+  /// @param executor executor to run the multiplication on
+  /// @return the product, of as many elements as rows of the matrix
+  /// @throw std::invalid_argument if the vector is of different length
+  auto multiplyVector(std::span<const T> vector,
+                      common::Executor auto& executor) const -> std::vector<T>
+    requires(kIsRowMajor)
+  {
+    matrix_common::checkVectorLength(vector, m_columns);
+
+    std::vector<T> result(m_rows);
+    constexpr auto kRowsBlock{kSpmvRowsBlock};
+    executor.parallelFor(
+        (m_rows + kRowsBlock - 1U) / kRowsBlock,
+        [this, vector, &result](std::size_t block) {
+          const auto rowEnd{std::min((block + 1U) * kRowsBlock, m_rows)};
+          for (auto rowIndex{block * kRowsBlock}; rowIndex < rowEnd;
+               ++rowIndex) {
+            result[rowIndex] = rowDot(rowIndex, vector);
+          }
+        });
+
+    return result;
+  }
+
+  /// @brief method to multiply the matrix by a vector and to accumulate the
+  ///        scaled product into another vector, y = alpha * A * x + beta * y
+  ///        (GEMV)
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  /// @note for CSR, products with as many non-zero elements as
+  ///       matrix_common::parallelThreshold() run over
+  ///       common::ThreadPool::shared(), while CSC always runs serially, as
+  ///       its columns scatter into the whole y; x and y must not overlap
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result) const {
+    if constexpr (kIsRowMajor) {
+      matrix_common::runMatrixVectorProduct(
+          numberOfNonZeros(), [&](auto& executor) {
+            multiplyVector(alpha, vector, beta, result, executor);
+          });
+    } else {
+      matrix_common::checkGemvLengths(*this, vector.size(), result.size());
+      matrix_common::scaleAccumulated(beta, result);
+
+      forEachNonZero([alpha, vector, result](std::size_t row,
+                                             std::size_t column, T value) {
+        result[row] += alpha * (value * vector[column]);
+      });
+    }
+  }
+
+  /// @brief overload of the method above that runs on the given executor,
+  ///        blocks of rows of y being computed independently
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @param executor executor to run the multiplication on
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result,
+                      common::Executor auto& executor) const
+    requires(kIsRowMajor)
+  {
+    matrix_common::checkGemvLengths(*this, vector.size(), result.size());
+    matrix_common::multiplyRowsByVector(
+        alpha, beta, result,
+        [this, vector](std::size_t rowIndex) {
+          return rowDot(rowIndex, vector);
+        },
+        executor);
+  }
+
+  /// @brief generic multiplication operator
+  /// @param otherMatrix the second operand of multiplication
+  /// @return the product, in the same format when multiplied by a sparse
+  ///         matrix (SpGEMM), or as DynamicMatrix otherwise
+  /// @throw std::invalid_argument if dimensions are not compatible
+  /// @note sparse matrices of other formats are converted to this one first
+  auto operator*(const auto& otherMatrix) const {
+    using OtherMatrixType = std::remove_cvref_t<decltype(otherMatrix)>;
+
+    static_assert(
+        std::is_same_v<typename OtherMatrixType::value_type, value_type>,
+        "Element types are not the same");
+
+    checkMultipliable(otherMatrix);
+
+    if constexpr (std::is_same_v<OtherMatrixType, CompressedSparseMatrix>) {
+      CompressedSparseMatrix result;
+      result.m_rows = m_rows;
+      result.m_columns = otherMatrix.m_columns;
+      result.m_storage =
+          kIsRowMajor ? matrix_common::multiplyCompressed(
+                            m_storage, otherMatrix.m_storage, result.m_columns)
+                      : matrix_common::multiplyCompressed(
+                            otherMatrix.m_storage, m_storage, result.m_rows);
+
+      return result;
+    } else if constexpr (requires { otherMatrix.entries(); }) {
+      return *this * CompressedSparseMatrix{otherMatrix};
+    } else {
+      // each non-zero element scales the stored part of a row of the other
+      // matrix into the corresponding row of the result, whatever the kind
+      // of view the row is read through
+      DynamicMatrix<T> result(m_rows,
+                              matrix_common::numberOfColumns(otherMatrix));
+      forEachNonZero([&result, &otherMatrix](std::size_t row,
+                                             std::size_t column, T value) {
+        matrix_common::accumulateStoredLine(otherMatrix.rowView(column), value,
+                                            result.rowData(row));
+      });
+
+      return result;
+    }
+  }
+
+  /// @brief compound addition operator, adding another matrix of the same
+  ///        dimensions to this one
+  /// @param otherMatrix the matrix to add, of any matrix type
+  /// @return reference to this matrix
+  /// @throw std::invalid_argument if dimensions are not the same
+  /// @note the sparsity pattern of the sum differs in general, so the
+  ///       storage is rebuilt from the entries of both
+  auto operator+=(const auto& otherMatrix) -> CompressedSparseMatrix& {
+    *this = CompressedSparseMatrix(
+        m_rows, m_columns,
+        matrix_common::sumEntries(*this, otherMatrix, T{1}, "add"));
+    return *this;
+  }
+
+  /// @brief compound subtraction operator, subtracting another matrix of the
+  ///        same dimensions from this one
+  /// @param otherMatrix the matrix to subtract, of any matrix type
+  /// @return reference to this matrix
+  /// @throw std::invalid_argument if dimensions are not the same
+  /// @note the sparsity pattern of the difference differs in general, so the
+  ///       storage is rebuilt from the entries of both
+  auto operator-=(const auto& otherMatrix) -> CompressedSparseMatrix& {
+    *this = CompressedSparseMatrix(
+        m_rows, m_columns,
+        matrix_common::sumEntries(*this, otherMatrix, T{} - T{1},
+                                  "subtract"));
+    return *this;
+  }
+
+  /// @brief compound multiplication operator by a scalar
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  auto operator*=(const T& factor) -> CompressedSparseMatrix& {
+    return scale(factor);
+  }
+
+  /// @brief method to multiply all non-zero elements by a scalar in place
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  /// @note scaling by zero drops all the entries
+  auto scale(const T& factor) -> CompressedSparseMatrix& {
+    if (factor == T{}) {
+      *this = CompressedSparseMatrix(m_rows, m_columns);
+    } else {
+      for (auto& value : m_storage.values) {
+        value *= factor;
+      }
+    }
+
+    return *this;
+  }
+
+  /// @brief method to check whether matrix type is symmetric or not
+  /// @return true if matrix is symmetric, false otherwise
+  [[nodiscard]] auto isSymmetric() const -> bool {
+    if (m_rows != m_columns) {
+      return false;
+    }
+
+    bool isSymmetric{true};
+    forEachNonZero([this, &isSymmetric](std::size_t row, std::size_t column,
+                                        T value) {
+      isSymmetric = isSymmetric && element(column, row) == value;
+    });
+
+    return isSymmetric;
+  }
+
+  /// @brief method to check whether all elements are zeros beyond a number of
+  ///        diagonals on both sides of the main one
+  /// @param bandwidth number of diagonals allowed on each side
+  /// @return true if matrix is square and banded, false otherwise
+  [[nodiscard]] auto isBanded(std::size_t bandwidth) const -> bool {
+    if (m_rows != m_columns) {
+      return false;
+    }
+
+    bool isBanded{true};
+    forEachNonZero(
+        [bandwidth, &isBanded](std::size_t row, std::size_t column, T) {
+          isBanded = isBanded &&
+                     (row > column ? row - column : column - row) <= bandwidth;
+        });
+
+    return isBanded;
+  }
+
+  /// @brief method to check whether all elements off the diagonal are zeros
+  /// @return true if matrix is square and diagonal, false otherwise
+  [[nodiscard]] auto isDiagonal() const -> bool { return isBanded(0U); }
+
+  /// @brief method to check whether all elements above the diagonal are zeros
+  /// @return true if matrix is square and lower triangular, false otherwise
+  [[nodiscard]] auto isLowerTriangular() const -> bool {
+    if (m_rows != m_columns) {
+      return false;
+    }
+
+    bool isLowerTriangular{true};
+    forEachNonZero(
+        [&isLowerTriangular](std::size_t row, std::size_t column, T) {
+          isLowerTriangular = isLowerTriangular && column <= row;
+        });
+
+    return isLowerTriangular;
+  }
+
+  /// @brief method to display elements of the matrix, zeros included
+  /// @return elements surrounded by matrix symbol
+  [[nodiscard]] auto display() const -> std::string {
+    std::string result;
+    formatMatrixTo(std::back_inserter(result), *this);
+
+    return result;
+  }
+
+  /// @brief type alias for T, used for assertions
+  using value_type = T;
+
+private:
+  /// @brief number of rows of the result computed by a task of the SpMV
+  static constexpr std::size_t kSpmvRowsBlock{256U};
+
+  /// @brief number of rows of the matrix
+  std::size_t m_rows{0U};
+
+  /// @brief number of columns of the matrix
+  std::size_t m_columns{0U};
+
+  /// @brief compressed storage of the non-zero elements
+  matrix_common::CompressedStorage<T> m_storage;
+
+  /// @brief friending with compressed matrices of the other axis
+  template <SparseAxis OTHER_AXIS, typename U>
+  friend class CompressedSparseMatrix;
+
+  /// @brief helper method to return the number of outer lines
+  /// @return number of rows for CSR, number of columns for CSC
+  [[nodiscard]] auto outerCount() const noexcept {
+    return kIsRowMajor ? m_rows : m_columns;
+  }
+
+  /// @brief helper method to return the number of elements in an outer line
+  /// @return number of columns for CSR, number of rows for CSC
+  [[nodiscard]] auto innerSize() const noexcept {
+    return kIsRowMajor ? m_columns : m_rows;
+  }
+
+  /// @brief helper method to return a view of an outer line
+  /// @param index index of the outer line
+  /// @return compressed view of the outer line
+  [[nodiscard]] auto outerView(std::size_t index) const noexcept {
+    const auto begin{m_storage.offsets[index]};
+    const auto count{m_storage.offsets[index + 1U] - begin};
+
+    return CompressedLineView<T>{
+        std::span{m_storage.indices}.subspan(begin, count),
+        std::span{m_storage.values}.subspan(begin, count), innerSize()};
+  }
+
+  /// @brief helper method to call a callable for every non-zero element
+  /// @param callable accepting the row, the column and the element
+  void forEachNonZero(const auto& callable) const {
+    for (std::size_t outer{0U}; outer < outerCount(); ++outer) {
+      for (auto p{m_storage.offsets[outer]}; p < m_storage.offsets[outer + 1U];
+           ++p) {
+        if constexpr (kIsRowMajor) {
+          callable(outer, m_storage.indices[p], m_storage.values[p]);
+        } else {
+          callable(m_storage.indices[p], outer, m_storage.values[p]);
+        }
+      }
+    }
+  }
+
+  /// @brief helper method to compute the dot product of a CSR row with a
+  ///        vector, shared by the SpMV and the GEMV
+  /// @param rowIndex index of the row
+  /// @param vector the vector, of as many elements as columns
+  /// @return sum of the non-zero elements of the row times their elements of
+  ///         the vector
+  [[nodiscard]] auto rowDot(std::size_t rowIndex,
+                            std::span<const T> vector) const noexcept -> T
+    requires(kIsRowMajor)
+  {
+    T sum{};
+    for (auto p{m_storage.offsets[rowIndex]};
+         p < m_storage.offsets[rowIndex + 1U]; ++p) {
+      sum += m_storage.values[p] * vector[m_storage.indices[p]];
+    }
+    return sum;
+  }
+
+  /// @brief helper method to check dimensions are compatible for
+  ///        multiplication
+  /// @param otherMatrix the second operand of multiplication
+  /// @throw std::invalid_argument if dimensions are not compatible
+  void checkMultipliable(const auto& otherMatrix) const {
+    if (m_columns != matrix_common::numberOfRows(otherMatrix)) {
+      throw std::invalid_argument(std::format(
+          "Cannot multiply [{}*{}] matrix by [{}*{}] matrix", m_rows,
+          m_columns, matrix_common::numberOfRows(otherMatrix),
+          matrix_common::numberOfColumns(otherMatrix)));
+    }
+  }
+
+  /// @brief helper method to check the compressed arrays are consistent
+  /// @throw std::invalid_argument if the arrays are not consistent
+  void checkStorage() const {
+    const auto& [offsets, indices, values]{m_storage};
+    const auto isConsistent{[&]() {
+      if (offsets.size() != outerCount() + 1U || offsets.front() != 0U ||
+          offsets.back() != indices.size() || indices.size() != values.size() ||
+          !std::ranges::is_sorted(offsets)) {
+        return false;
+      }
+
+      for (std::size_t outer{0U}; outer < outerCount(); ++outer) {
+        const auto line{std::span{indices}.subspan(
+            offsets[outer], offsets[outer + 1U] - offsets[outer])};
+        if (std::ranges::adjacent_find(line, std::greater_equal{}) !=
+                line.end() ||
+            (!line.empty() && line.back() >= innerSize())) {
+          return false;
+        }
+      }
+
+      return true;
+    }};
+
+    if (!isConsistent()) {
+      throw std::invalid_argument(
+          std::format("Compressed arrays are not consistent with [{}*{}] "
+                      "matrix",
+                      m_rows, m_columns));
+    }
+  }
+};
+
+/// @brief type alias for sparse matrices in compressed sparse row format
+/// @tparam T type of elements of matrix, default is std::size_t
+template <typename T = std::size_t>
+using CsrMatrix = CompressedSparseMatrix<SparseAxis::kRows, T>;
+
+/// @brief type alias for sparse matrices in compressed sparse column format
+/// @tparam T type of elements of matrix, default is std::size_t
+template <typename T = std::size_t>
+using CscMatrix = CompressedSparseMatrix<SparseAxis::kColumns, T>;
+
+/// @brief derive in a non-intrusive way of the MatrixAdt type
+/// @tparam T type of elements of matrix
+template <typename T>
+class IsMatrixAdt<CooMatrix<T>> : public std::true_type {};
+
+/// @brief derive in a non-intrusive way of the MatrixAdt type
+/// @tparam AXIS the axis along which the matrix is compressed
+/// @tparam T type of elements of matrix
+template <SparseAxis AXIS, typename T>
+class IsMatrixAdt<CompressedSparseMatrix<AXIS, T>> : public std::true_type {};
+
+}  // namespace data_structures::matrix_types
@@ -0,0 +1,365 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <format>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <string>
+#include <type_traits>
+
+#include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixFormat.hpp"
+#include "data-structures/matrix-types/MatrixViews.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief definition of class representing symmetric Matrix
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix, default is std::size_t
+/// @note only the lower triangle is stored, packed row by row as the one of
+///       lower triangular matrices, the upper one being read from it
+template <common::NaturalNumber auto N, typename T = std::size_t>
+class SymmetricMatrix {
+public:
+  /// @brief to handle when passing empty list
+  constexpr SymmetricMatrix() = default;
+
+  /// @brief constructor that accepts multiple braced init lists
+  /// @tparam ...Rows parameter pack for the braced init lists passed
+  /// @param ...rows parameter pack passes to fill the elements of the lower
+  ///        triangle of the matrix, each row up to its diagonal element
+  /// @note when passing a row shorter than the expected triangle side width,
+  ///       the remaining elements till the diagonal element are set to zero,
+  ///       while when passing a row longer, extra elements are ignored
+  template <typename... Rows>
+  constexpr explicit SymmetricMatrix(std::initializer_list<Rows>&&... rows) {
+    static_assert(sizeof...(rows) <= N);
+
+    std::size_t rowIndex{0U};
+    for (const auto& row : {rows...}) {
+      const auto length{std::min(row.size(), rowIndex + 1U)};
+      std::copy_n(row.begin(), length, rowData(rowIndex++));
+    }
+  }
+
+  /// @brief converting constructor from any other square matrix type of the
+  ///        same size, e.g. to store a dense matrix found symmetric in half
+  ///        the memory
+  /// @param matrix the matrix to copy the lower triangle of
+  /// @note elements above the diagonal are dropped, so isSymmetric() of the
+  ///       matrix tells whether the conversion is lossless
+  template <typename MatrixT>
+    requires(!std::is_same_v<MatrixT, SymmetricMatrix> &&
+             std::is_same_v<typename MatrixT::value_type, T> &&
+             matrix_common::StaticallySized<MatrixT>)
+  constexpr explicit SymmetricMatrix(const MatrixT& matrix) {
+    static_assert(MatrixT::dimensions().kRows == N &&
+                      MatrixT::dimensions().kColumns == N,
+                  "Dimensions are not the same");
+
+    for (std::size_t rowIndex{0U}; rowIndex < N; ++rowIndex) {
+      matrix.rowView(rowIndex).copyTo(0U, rowIndex + 1U, rowData(rowIndex));
+    }
+  }
+
+  /// @brief a constexpr method to return the [n*m] dimensions of the matrix
+  /// @return a MatrixDimension object representing [n*m] dimensions
+  static constexpr auto dimensions() noexcept {
+    return matrix_common::MatrixDimensions<N, N>{};
+  }
+
+  /// @brief method to return the row in matrix at a given index
+  /// @param index at which row should be returned
+  /// @return the row at the given index
+  constexpr auto row(std::size_t index) const {
+    std::array<T, N> result;
+    rowView(index).copyTo(result.begin());
+
+    return result;
+  }
+
+  /// @brief method to return the column at the given index
+  /// @param index at which column should be returned
+  /// @return the column at the given index, the same as the row
+  constexpr auto column(std::size_t index) const { return row(index); }
+
+  /// @brief method to return a view of the row at a given index, reading
+  ///        directly from the packed triangle elements
+  /// @param index at which row should be viewed
+  /// @return view of the row, read along the packed row up to the diagonal
+  ///         then down the packed column
+  /// @note no range checking is done here
+  constexpr auto rowView(std::size_t index) const noexcept {
+    return LineView<T, PackedSymmetricMapping>{rowData(index), N,
+                                               {0U, N, index}};
+  }
+
+  /// @brief method to return a view of the column at a given index, reading
+  ///        directly from the packed triangle elements
+  /// @param index at which column should be viewed
+  /// @return view of the column, the same as the row
+  /// @note no range checking is done here
+  constexpr auto columnView(std::size_t index) const noexcept {
+    return rowView(index);
+  }
+
+  /// @brief method to return pointer to the first element of a packed row of
+  ///        the lower triangle, followed by the other elements of the row up
+  ///        to the diagonal
+  /// @param index index of the row
+  /// @return pointer to the first element of the row at the given index
+  /// @note no range checking is done here
+  constexpr auto rowData(std::size_t index) const noexcept -> const T* {
+    return m_elements.data() + matrix_common::numberOfTriangleElements(index);
+  }
+
+  /// @brief non-const overload of the method above
+  constexpr auto rowData(std::size_t index) noexcept -> T* {
+    return m_elements.data() + matrix_common::numberOfTriangleElements(index);
+  }
+
+  /// @brief method that returns RowsIterator to traverse through each row
+  /// @return RowsIterator object pointing to first row, yielding views
+  constexpr auto rows() const noexcept {
+    return matrix_common::RowsIterator<SymmetricMatrix>(*this);
+  }
+
+  /// @brief method that returns ColumnsIterator to traverse through
+  ///        each column
+  /// @return ColumnsIterator object pointing to first column, yielding views
+  constexpr auto columns() const noexcept {
+    return matrix_common::ColumnsIterator<SymmetricMatrix>(*this);
+  }
+
+  /// @brief generic multiplication operator
+  /// @param otherMatrix the second operand of multiplication
+  /// @return NormalMatrix, or DynamicMatrix if the other operand is only
+  ///         sized at runtime
+  /// @note large products run in parallel, see
+  ///       matrix_common::parallelThreshold()
+  auto operator*(const auto& otherMatrix) const {
+    return multiply(otherMatrix);
+  }
+
+  /// @brief generic multiplication method that optionally accepts the
+  ///        executor to run on, e.g. a common::ThreadPool shared by several
+  ///        products
+  /// @param otherMatrix the second operand of multiplication
+  /// @param executor optional executor to run the multiplication on
+  /// @return NormalMatrix, or DynamicMatrix if the other operand is only
+  ///         sized at runtime
+  /// @note product of symmetric matrices is not symmetric in general, hence
+  ///       the result is dense
+  auto multiply(const auto& otherMatrix,
+                common::Executor auto&... executor) const {
+    static_assert(sizeof...(executor) <= 1U, "Only one executor is accepted");
+
+    using OtherMatrixType = std::remove_cvref_t<decltype(otherMatrix)>;
+
+    static_assert(
+        std::is_same_v<typename OtherMatrixType::value_type, value_type>,
+        "Element types are not the same");
+
+    if constexpr (!matrix_common::StaticallySized<OtherMatrixType>) {
+      // dimensions of the result are only known at runtime
+      return multiplyToDynamicMatrix(*this, otherMatrix, executor...);
+    } else {
+      // assert dimensons are compatible
+      static_assert(N == otherMatrix.dimensions().kRows);
+
+      constexpr auto kNoOfOtherMatrixColumns{
+          otherMatrix.dimensions().kColumns};
+      std::array<std::array<value_type, kNoOfOtherMatrixColumns>, N>
+          resultElements{};
+
+      matrix_common::multiplyStoredElements(
+          *this, otherMatrix,
+          [&resultElements](std::size_t rowIndex) {
+            return resultElements[rowIndex].data();
+          },
+          executor...);
+
+      return NormalMatrix<N, kNoOfOtherMatrixColumns, T>{resultElements};
+    }
+  }
+
+  /// @brief method to multiply the matrix by a vector
+  /// @param vector the vector to multiply by
+  /// @return the product of the matrix by the vector
+  /// @note it is the GEMV below with alpha of one and beta of zero
+  auto multiplyVector(const std::array<T, N>& vector) const
+      -> std::array<T, N> {
+    std::array<T, N> result{};
+    multiplyVector(T{1}, std::span<const T>{vector}, T{}, std::span<T>{result});
+    return result;
+  }
+
+  /// @brief compound addition operator, adding another symmetric or a
+  ///        diagonal matrix to this one in place, the only types keeping it
+  ///        symmetric
+  /// @tparam OtherMatrixT type of the other matrix
+  /// @param otherMatrix the matrix to add
+  /// @return reference to this matrix
+  template <typename OtherMatrixT>
+    requires(std::is_same_v<OtherMatrixT, SymmetricMatrix> ||
+             std::is_same_v<OtherMatrixT, DiagonalMatrix<N, T>>)
+  auto operator+=(const OtherMatrixT& otherMatrix) -> SymmetricMatrix& {
+    return accumulate(otherMatrix, T{1});
+  }
+
+  /// @brief compound subtraction operator, subtracting another symmetric or a
+  ///        diagonal matrix from this one in place
+  /// @tparam OtherMatrixT type of the other matrix
+  /// @param otherMatrix the matrix to subtract
+  /// @return reference to this matrix
+  template <typename OtherMatrixT>
+    requires(std::is_same_v<OtherMatrixT, SymmetricMatrix> ||
+             std::is_same_v<OtherMatrixT, DiagonalMatrix<N, T>>)
+  auto operator-=(const OtherMatrixT& otherMatrix) -> SymmetricMatrix& {
+    return accumulate(otherMatrix, T{} - T{1});
+  }
+
+  /// @brief compound multiplication operator by a scalar
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  constexpr auto operator*=(const T& factor) noexcept -> SymmetricMatrix& {
+    return scale(factor);
+  }
+
+  /// @brief method to multiply all elements by a scalar in place
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  /// @note only the stored triangle is touched
+  constexpr auto scale(const T& factor) noexcept -> SymmetricMatrix& {
+    for (auto& element : m_elements) {
+      element *= factor;
+    }
+
+    return *this;
+  }
+
+  /// @brief method to check whether matrix type is symmetric or not
+  /// @return true
+  /// @note for symmetric matrix, this is always true
+  constexpr auto isSymmetric() const noexcept { return true; }
+
+  /// @brief method to check whether all elements are zeros beyond a number of
+  ///        diagonals on both sides of the main one
+  /// @param bandwidth number of diagonals allowed on each side
+  /// @return true if no element of the triangle is non-zero off the band
+  /// @note only the packed triangle is read, the upper one mirroring it
+  constexpr auto isBanded(std::size_t bandwidth) const noexcept -> bool {
+    // a band covering every diagonal holds the whole matrix, checked first
+    // so that the bounds below cannot wrap
+    if (bandwidth >= N - 1U) {
+      return true;
+    }
+
+    const auto isZero{[](const T& element) { return element == T{}; }};
+
+    for (auto rowIndex{bandwidth + 1U}; rowIndex < N; ++rowIndex) {
+      const auto* const row{rowData(rowIndex)};
+      if (!std::all_of(row, row + (rowIndex - bandwidth), isZero)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /// @brief method to check whether all elements off the diagonal are zeros
+  /// @return true if the triangle holds only its diagonal
+  constexpr auto isDiagonal() const noexcept -> bool { return isBanded(0U); }
+
+  /// @brief method to check whether all elements above the diagonal are zeros
+  /// @return true if the triangle holds only its diagonal, as the upper one
+  ///         mirrors it
+  constexpr auto isLowerTriangular() const noexcept -> bool {
+    return isDiagonal();
+  }
+
+  /// @brief method to multiply the matrix by a vector and to accumulate the
+  ///        scaled product into another vector, y = alpha * A * x + beta * y
+  ///        (GEMV)
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  /// @note each packed row of the lower triangle is read once, both as a row,
+  ///       by the vectorized dot product kernel, and as a column, by the
+  ///       vectorized multiply-add kernel, so it runs serially as the
+  ///       columns scatter into the whole y; x and y must not overlap
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result) const {
+    matrix_common::checkGemvLengths(*this, vector.size(), result.size());
+    matrix_common::scaleAccumulated(beta, result);
+
+    for (std::size_t rowIndex{0U}; rowIndex < N; ++rowIndex) {
+      const auto* const row{rowData(rowIndex)};
+      result[rowIndex] +=
+          alpha * simd_kernels::dot(row, vector.data(), rowIndex + 1U);
+      simd_kernels::multiplyAdd(std::array<T, 1U>{alpha * vector[rowIndex]},
+                                row, std::array<T*, 1U>{result.data()},
+                                rowIndex);
+    }
+  }
+
+  /// @brief method to display elements of the matrix
+  /// @return elements surrounded by matrix symbol
+  [[nodiscard]] constexpr auto display() const noexcept -> std::string {
+    std::string result;
+    formatMatrixTo(std::back_inserter(result), *this);
+
+    return result;
+  }
+
+  /// @brief type alias for T, used for assertions
+  using value_type = T;
+
+private:
+  /// @brief elements of the lower triangle in the matrix
+  std::array<T, matrix_common::numberOfTriangleElements(N)> m_elements{};
+
+  /// @brief helper method to add another matrix scaled by a factor to this
+  ///        one in place
+  /// @param otherMatrix the matrix to add
+  /// @param factor factor to scale the other matrix by
+  /// @return reference to this matrix
+  auto accumulate(const auto& otherMatrix, const T& factor)
+      -> SymmetricMatrix& {
+    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(otherMatrix)>,
+                                 SymmetricMatrix>) {
+      // both triangles are packed the same, hence added in one pass
+      simd_kernels::multiplyAdd(std::array<T, 1U>{factor},
+                                otherMatrix.m_elements.data(),
+                                std::array<T*, 1U>{m_elements.data()},
+                                m_elements.size());
+    } else {
+      // diagonal matrices only store the last element of the packed rows
+      matrix_common::accumulateStoredRows(
+          otherMatrix, factor,
+          [this](std::size_t rowIndex) { return rowData(rowIndex); });
+    }
+
+    return *this;
+  }
+};
+
+/// @brief derive in a non-intrusive way of the MatrixAdt type
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix
+template <common::NaturalNumber auto N, typename T>
+class IsMatrixAdt<SymmetricMatrix<N, T>> : public std::true_type {};
+
+}  // namespace data_structures::matrix_types
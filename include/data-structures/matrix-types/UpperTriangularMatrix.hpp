@@ -0,0 +1,477 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "common/Common.hpp"  // NOLINT(misc-include-cleaner)
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/MatrixFormat.hpp"
+#include "data-structures/matrix-types/MatrixViews.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
+
+/// @brief namespace for matrices types
+namespace data_structures::matrix_types {
+
+/// @brief definition of class representing upper triangular Matrix
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix, default is std::size_t
+/// @note the upper triangle is packed row by row, each row from its diagonal
+///       element to the last column
+template <common::NaturalNumber auto N, typename T = std::size_t>
+class UpperTriangularMatrix {
+public:
+  /// @brief to handle when passing empty list
+  constexpr UpperTriangularMatrix() = default;
+
+  /// @brief constructor that accepts multiple braced init lists
+  /// @tparam ...Rows parameter pack for the braced init lists passed
+  /// @param ...rows parameter pack passes to fill the elements of the matrix,
+  ///        each row starting from its diagonal element
+  /// @note when passing a row shorter than the expected triangle side width,
+  ///       the remaining elements till the last column are set to zero,
+  ///       while when passing a row longer, extra elements are ignored
+  template <typename... Rows>
+  constexpr explicit UpperTriangularMatrix(
+      std::initializer_list<Rows>&&... rows) {
+    static_assert(sizeof...(rows) <= N);
+
+    std::size_t rowIndex{0U};
+    for (const auto& row : {rows...}) {
+      const auto length{std::min(row.size(), N - rowIndex)};
+      std::copy_n(row.begin(), length, rowData(rowIndex++));
+    }
+  }
+
+  /// @brief converting constructor from any other square matrix type of the
+  ///        same size, e.g. to store a dense matrix found upper triangular in
+  ///        the packed triangle
+  /// @param matrix the matrix to copy the upper triangle of
+  /// @note elements below the diagonal are dropped
+  template <typename MatrixT>
+    requires(!std::is_same_v<MatrixT, UpperTriangularMatrix> &&
+             std::is_same_v<typename MatrixT::value_type, T> &&
+             matrix_common::StaticallySized<MatrixT>)
+  constexpr explicit UpperTriangularMatrix(const MatrixT& matrix) {
+    static_assert(MatrixT::dimensions().kRows == N &&
+                      MatrixT::dimensions().kColumns == N,
+                  "Dimensions are not the same");
+
+    for (std::size_t rowIndex{0U}; rowIndex < N; ++rowIndex) {
+      matrix.rowView(rowIndex).copyTo(rowIndex, N, rowData(rowIndex));
+    }
+  }
+
+  /// @brief a constexpr method to return the [n*m] dimensions of the matrix
+  /// @return a MatrixDimension object representing [n*m] dimensions
+  static constexpr auto dimensions() noexcept {
+    return matrix_common::MatrixDimensions<N, N>{};
+  }
+
+  /// @brief method to return the row in matrix at a given index
+  /// @param index at which row should be returned
+  /// @return the row at the given index
+  constexpr auto row(std::size_t index) const {
+    std::array<T, N> result;
+    rowView(index).copyTo(result.begin());
+
+    return result;
+  }
+
+  /// @brief method to return the column at the given index
+  /// @param index at which column should be returned
+  /// @return the column at the given index
+  constexpr auto column(std::size_t index) const {
+    std::array<T, N> result;
+    columnView(index).copyTo(result.begin());
+
+    return result;
+  }
+
+  /// @brief method to return a view of the row at a given index, reading
+  ///        directly from the packed triangle elements
+  /// @param index at which row should be viewed
+  /// @return view of the row, its elements before the diagonal are zeros
+  /// @note no range checking is done here
+  constexpr auto rowView(std::size_t index) const noexcept {
+    return LineView<T>{rowData(index), N, {index, N, 1U}};
+  }
+
+  /// @brief method to return a view of the column at a given index, reading
+  ///        directly from the packed triangle elements
+  /// @param index at which column should be viewed
+  /// @return view of the column, its elements below the diagonal are zeros
+  /// @note no range checking is done here
+  constexpr auto columnView(std::size_t index) const noexcept {
+    return LineView<T, PackedUpperColumnMapping>{
+        m_elements.data() + index, N, {0U, index + 1U, N}};
+  }
+
+  /// @brief method to return pointer to the diagonal element of a packed
+  ///        row, followed by the other elements of the row up to the last
+  ///        column
+  /// @param index index of the row
+  /// @return pointer to the diagonal element of the row at the given index
+  /// @note no range checking is done here
+  constexpr auto rowData(std::size_t index) const noexcept -> const T* {
+    return m_elements.data() + numberOfElementsInRows(index);
+  }
+
+  /// @brief non-const overload of the method above
+  constexpr auto rowData(std::size_t index) noexcept -> T* {
+    return m_elements.data() + numberOfElementsInRows(index);
+  }
+
+  /// @brief method to solve the system U x = b by backward substitution,
+  ///        each unknown being the dot product of a packed row with the
+  ///        unknowns already solved
+  /// @param vector the right-hand side b
+  /// @return the solution x
+  /// @throw std::domain_error if an element of the diagonal is zero
+  auto solve(std::array<T, N> vector) const -> std::array<T, N>
+    requires std::floating_point<T>
+  {
+    for (auto rowIndex{std::size_t{N}}; rowIndex-- > 0U;) {
+      const auto* const row{rowData(rowIndex)};
+
+      auto sum{vector[rowIndex]};
+      for (auto j{rowIndex + 1U}; j < N; ++j) {
+        sum -= row[j - rowIndex] * vector[j];
+      }
+      vector[rowIndex] = sum / diagonalElement(rowIndex);
+    }
+
+    return vector;
+  }
+
+  /// @brief method to solve the system transpose(U) x = b by forward
+  ///        substitution, each unknown solved being subtracted from the ones
+  ///        left scaled by its packed row, so rows are still read in place
+  /// @param vector the right-hand side b
+  /// @return the solution x
+  /// @throw std::domain_error if an element of the diagonal is zero
+  auto solveTransposed(std::array<T, N> vector) const -> std::array<T, N>
+    requires std::floating_point<T>
+  {
+    for (std::size_t rowIndex{0U}; rowIndex < N; ++rowIndex) {
+      vector[rowIndex] /= diagonalElement(rowIndex);
+      simd_kernels::multiplyAdd(std::array<T, 1U>{T{} - vector[rowIndex]},
+                                rowData(rowIndex) + 1U,
+                                std::array<T*, 1U>{vector.data() + rowIndex +
+                                                   1U},
+                                N - rowIndex - 1U);
+    }
+
+    return vector;
+  }
+
+  /// @brief method that returns RowsIterator to traverse through each row
+  /// @return RowsIterator object pointing to first row, yielding views
+  constexpr auto rows() const noexcept {
+    return matrix_common::RowsIterator<UpperTriangularMatrix>(*this);
+  }
+
+  /// @brief method that returns ColumnsIterator to traverse through
+  ///        each column
+  /// @return ColumnsIterator object pointing to first column, yielding views
+  constexpr auto columns() const noexcept {
+    return matrix_common::ColumnsIterator<UpperTriangularMatrix>(*this);
+  }
+
+  /// @brief generic multiplication operator
+  /// @param otherMatrix the second operand of multiplication
+  /// @return UpperTriangularMatrix when multiplied by another upper
+  ///         triangular matrix, NormalMatrix otherwise
+  /// @note large products run in parallel, see
+  ///       matrix_common::parallelThreshold()
+  auto operator*(const auto& otherMatrix) const {
+    return multiply(otherMatrix);
+  }
+
+  /// @brief generic multiplication method that optionally accepts the
+  ///        executor to run on, e.g. a common::ThreadPool shared by several
+  ///        products
+  /// @param otherMatrix the second operand of multiplication
+  /// @param executor optional executor to run the multiplication on
+  /// @return UpperTriangularMatrix when multiplied by another upper
+  ///         triangular matrix, NormalMatrix otherwise
+  /// @note only the stored triangle is walked, skipping the zeros below the
+  ///       diagonal, unless the other operand is only sized at runtime
+  auto multiply(const auto& otherMatrix,
+                common::Executor auto&... executor) const {
+    static_assert(sizeof...(executor) <= 1U, "Only one executor is accepted");
+
+    using OtherMatrixType = std::remove_cvref_t<decltype(otherMatrix)>;
+
+    static_assert(
+        std::is_same_v<typename OtherMatrixType::value_type, value_type>,
+        "Element types are not the same");
+
+    if constexpr (!matrix_common::StaticallySized<OtherMatrixType>) {
+      // dimensions of the result are only known at runtime
+      return multiplyToDynamicMatrix(*this, otherMatrix, executor...);
+    } else {
+      // assert dimensons are compatible
+      static_assert(N == otherMatrix.dimensions().kRows);
+
+      if constexpr (std::is_same_v<OtherMatrixType, UpperTriangularMatrix>) {
+        // product of upper triangular matrices is upper triangular, so it is
+        // accumulated directly into the packed triangle, whose rows are
+        // addressed from their first column although it is not stored
+        UpperTriangularMatrix result{};
+        matrix_common::multiplyStoredElements(
+            *this, otherMatrix,
+            [&result](std::size_t rowIndex) {
+              return result.rowData(rowIndex) - rowIndex;
+            },
+            executor...);
+
+        return result;
+      } else {
+        constexpr auto kNoOfOtherMatrixColumns{
+            otherMatrix.dimensions().kColumns};
+        std::array<std::array<value_type, kNoOfOtherMatrixColumns>, N>
+            resultElements{};
+
+        // only the triangle of this matrix is walked
+        matrix_common::multiplyStoredElements(
+            *this, otherMatrix,
+            [&resultElements](std::size_t rowIndex) {
+              return resultElements[rowIndex].data();
+            },
+            executor...);
+
+        return NormalMatrix<N, kNoOfOtherMatrixColumns, T>{resultElements};
+      }
+    }
+  }
+
+  /// @brief compound addition operator, adding another upper triangular or a
+  ///        diagonal matrix to this one in place, the only types keeping it
+  ///        upper triangular
+  /// @tparam OtherMatrixT type of the other matrix
+  /// @param otherMatrix the matrix to add
+  /// @return reference to this matrix
+  template <typename OtherMatrixT>
+    requires(std::is_same_v<OtherMatrixT, UpperTriangularMatrix> ||
+             std::is_same_v<OtherMatrixT, DiagonalMatrix<N, T>>)
+  auto operator+=(const OtherMatrixT& otherMatrix) -> UpperTriangularMatrix& {
+    return accumulate(otherMatrix, T{1});
+  }
+
+  /// @brief compound subtraction operator, subtracting another upper
+  ///        triangular or a diagonal matrix from this one in place
+  /// @tparam OtherMatrixT type of the other matrix
+  /// @param otherMatrix the matrix to subtract
+  /// @return reference to this matrix
+  template <typename OtherMatrixT>
+    requires(std::is_same_v<OtherMatrixT, UpperTriangularMatrix> ||
+             std::is_same_v<OtherMatrixT, DiagonalMatrix<N, T>>)
+  auto operator-=(const OtherMatrixT& otherMatrix) -> UpperTriangularMatrix& {
+    return accumulate(otherMatrix, T{} - T{1});
+  }
+
+  /// @brief compound multiplication operator by another upper triangular
+  ///        matrix, whose product by this one is upper triangular as well
+  /// @param otherMatrix the second operand of multiplication
+  /// @return reference to this matrix
+  /// @note the product is computed on the stack before it is assigned, since
+  ///       its elements depend on the ones it overwrites
+  auto operator*=(const UpperTriangularMatrix& otherMatrix)
+      -> UpperTriangularMatrix& {
+    *this = multiply(otherMatrix);
+    return *this;
+  }
+
+  /// @brief compound multiplication operator by a scalar
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  constexpr auto operator*=(const T& factor) noexcept
+      -> UpperTriangularMatrix& {
+    return scale(factor);
+  }
+
+  /// @brief method to multiply all elements by a scalar in place
+  /// @param factor the scalar to multiply elements by
+  /// @return reference to this matrix
+  /// @note only the stored triangle is touched
+  constexpr auto scale(const T& factor) noexcept -> UpperTriangularMatrix& {
+    for (auto& element : m_elements) {
+      element *= factor;
+    }
+
+    return *this;
+  }
+
+  /// @brief method to check whether matrix type is symmetric or not
+  /// @return false
+  /// @note for upper triangular matrix, this is always false, as for lower
+  ///       triangular ones
+  constexpr auto isSymmetric() const noexcept { return false; }
+
+  /// @brief method to check whether all elements are zeros beyond a number of
+  ///        diagonals on both sides of the main one
+  /// @param bandwidth number of diagonals allowed on each side
+  /// @return true if no element of the triangle is non-zero off the band
+  /// @note only the packed triangle is read, the lower one being zeros
+  constexpr auto isBanded(std::size_t bandwidth) const noexcept -> bool {
+    // a band covering every diagonal holds the whole matrix, checked first
+    // so that the bounds below cannot wrap
+    if (bandwidth >= N - 1U) {
+      return true;
+    }
+
+    const auto isZero{[](const T& element) { return element == T{}; }};
+
+    for (std::size_t rowIndex{0U}; rowIndex + bandwidth + 1U < N; ++rowIndex) {
+      const auto* const row{rowData(rowIndex)};
+      if (!std::all_of(row + bandwidth + 1U, row + (N - rowIndex), isZero)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /// @brief method to check whether all elements off the diagonal are zeros
+  /// @return true if the triangle holds only its diagonal
+  constexpr auto isDiagonal() const noexcept -> bool { return isBanded(0U); }
+
+  /// @brief method to check whether all elements above the diagonal are zeros
+  /// @return true if the triangle holds only its diagonal
+  constexpr auto isLowerTriangular() const noexcept -> bool {
+    return isDiagonal();
+  }
+
+  /// @brief method to multiply the matrix by a vector and to accumulate the
+  ///        scaled product into another vector, y = alpha * A * x + beta * y
+  ///        (GEMV), on the given executor
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @param executor executor to run blocks of rows on
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  /// @note only the packed triangle of each row, from the diagonal, is
+  ///       multiplied by x; x and y must not overlap
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result,
+                      common::Executor auto& executor) const {
+    matrix_common::checkGemvLengths(*this, vector.size(), result.size());
+    matrix_common::multiplyRowsByVector(
+        alpha, beta, result,
+        [this, vector](std::size_t rowIndex) {
+          return simd_kernels::dot(rowData(rowIndex),
+                                   vector.data() + rowIndex, N - rowIndex);
+        },
+        executor);
+  }
+
+  /// @brief overload of the method above that runs serially, unless the
+  ///        product has as many multiply-adds as parallelThreshold(), then
+  ///        it runs over common::ThreadPool::shared()
+  /// @param alpha factor of the product
+  /// @param vector the vector x, of as many elements as columns
+  /// @param beta factor of y, which is not read when zero
+  /// @param result the vector y, of as many elements as rows
+  /// @throw std::invalid_argument if the vectors are of other lengths
+  void multiplyVector(T alpha, std::span<const T> vector, T beta,
+                      std::span<T> result) const {
+    matrix_common::runMatrixVectorProduct(
+        matrix_common::numberOfTriangleElements(N), [&](auto& executor) {
+          multiplyVector(alpha, vector, beta, result, executor);
+        });
+  }
+
+  /// @brief method to display elements of the matrix
+  /// @return elements surrounded by matrix symbol
+  [[nodiscard]] constexpr auto display() const noexcept -> std::string {
+    std::string result;
+    formatMatrixTo(std::back_inserter(result), *this);
+
+    return result;
+  }
+
+  /// @brief type alias for T, used for assertions
+  using value_type = T;
+
+private:
+  /// @brief helper constexpr method to return the total number of elements
+  ///        stored in the first n rows of an upper triangle
+  /// @param n number of rows
+  /// @return the total number of elements stored in the n rows
+  static constexpr auto numberOfElementsInRows(std::size_t n) noexcept
+      -> std::size_t {
+    // this returns the sum of {N, N - 1, ... , N - n + 1}
+    return (n * N) - ((n * (n - (n > 0U ? 1U : 0U))) / 2U);
+  }
+
+  /// @brief elements of the upper triangle in the matrix
+  std::array<T, numberOfElementsInRows(N)> m_elements{};
+
+  /// @brief helper method to return an element of the diagonal, the pivot of
+  ///        the triangular solves
+  /// @param index index of the row, and column, of the element
+  /// @return the element of the diagonal
+  /// @throw std::domain_error if the element is zero
+  constexpr auto diagonalElement(std::size_t index) const -> T {
+    const auto element{rowData(index)[0U]};
+    if (element == T{}) {
+      throw std::domain_error(std::format(
+          "Cannot solve a singular system, diagonal element {} is zero",
+          index));
+    }
+
+    return element;
+  }
+
+  /// @brief helper method to add another matrix scaled by a factor to this
+  ///        one in place
+  /// @param otherMatrix the matrix to add
+  /// @param factor factor to scale the other matrix by
+  /// @return reference to this matrix
+  auto accumulate(const auto& otherMatrix, const T& factor)
+      -> UpperTriangularMatrix& {
+    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(otherMatrix)>,
+                                 UpperTriangularMatrix>) {
+      // both triangles are packed the same, hence added in one pass
+      simd_kernels::multiplyAdd(std::array<T, 1U>{factor},
+                                otherMatrix.m_elements.data(),
+                                std::array<T*, 1U>{m_elements.data()},
+                                m_elements.size());
+    } else {
+      matrix_common::accumulateStoredRows(
+          otherMatrix, factor, [this](std::size_t rowIndex) {
+            return rowData(rowIndex) - rowIndex;
+          });
+    }
+
+    return *this;
+  }
+};
+
+/// @brief derive in a non-intrusive way of the MatrixAdt type
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix
+template <common::NaturalNumber auto N, typename T>
+class IsMatrixAdt<UpperTriangularMatrix<N, T>> : public std::true_type {};
+
+/// @brief upper triangular matrix stores its rows from the diagonal only
+/// @tparam N number of rows and columns of the matrix
+/// @tparam T type of elements of matrix
+template <common::NaturalNumber auto N, typename T>
+class HasPackedRows<UpperTriangularMatrix<N, T>> : public std::true_type {};
+
+}  // namespace data_structures::matrix_types
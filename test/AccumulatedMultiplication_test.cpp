@@ -0,0 +1,217 @@
+#include "data-structures/matrix-types/AccumulatedMultiplication.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+TEST(TestingAccumulatedMultiplication, WideningElements) {
+  constexpr auto kLarge{std::numeric_limits<std::int32_t>::max()};
+  const NormalMatrix<2U, 2U, std::int32_t> first{{kLarge, kLarge},
+                                                 {-kLarge, 1}};
+  const NormalMatrix<2U, 2U, std::int32_t> second{{kLarge, 2}, {kLarge, -3}};
+
+  const auto product{multiply<WidenedAccumulation<std::int64_t>>(first,
+                                                                 second)};
+  EXPECT_TRUE((std::is_same_v<decltype(product),
+                              const NormalMatrix<2U, 2U, std::int64_t>>));
+
+  constexpr std::int64_t kWide{kLarge};
+  EXPECT_EQ(product.rowData(0U)[0U], 2 * kWide * kWide);
+  EXPECT_EQ(product.rowData(0U)[1U], -kWide);
+  EXPECT_EQ(product.rowData(1U)[0U], (-kWide * kWide) + kWide);
+  EXPECT_EQ(product.rowData(1U)[1U], (-2 * kWide) - 3);
+
+  // the default policy keeps the elements as operator* does, wrapping
+  // around where that is defined, i.e. for unsigned elements
+  constexpr auto kUnsigned{std::numeric_limits<std::uint32_t>::max()};
+  const NormalMatrix<2U, 2U, std::uint32_t> wrapping{{kUnsigned, kUnsigned},
+                                                     {2U, 1U}};
+  const auto wrapped{multiply<WrappingAccumulation>(wrapping, wrapping)};
+  EXPECT_EQ(wrapped.rowData(0U)[0U], kUnsigned);
+  EXPECT_EQ(wrapped.rowData(0U)[1U], 0U);
+  EXPECT_EQ(wrapped.rowData(1U)[0U], 0U);
+  EXPECT_EQ(wrapped.rowData(1U)[1U], kUnsigned);
+  EXPECT_EQ(wrapped.display(), (wrapping * wrapping).display());
+}
+
+TEST(TestingAccumulatedMultiplication, SaturatingElements) {
+  constexpr auto kMax{std::numeric_limits<std::int32_t>::max()};
+  constexpr auto kMin{std::numeric_limits<std::int32_t>::min()};
+  const NormalMatrix<2U, 3U, std::int32_t> first{{kMax, 1, 1}, {-2, 3, 4}};
+  const NormalMatrix<3U, 2U, std::int32_t> second{{2, -2}, {1, 1}, {-5, 1}};
+
+  const auto product{multiply<SaturatingAccumulation>(first, second)};
+  // each multiply-add saturates, in the order of the inner dimension
+  EXPECT_EQ(product.rowData(0U)[0U], kMax - 5);
+  EXPECT_EQ(product.rowData(0U)[1U], kMin + 2);
+  EXPECT_EQ(product.rowData(1U)[0U], -21);
+  EXPECT_EQ(product.rowData(1U)[1U], 11);
+
+  const NormalMatrix<1U, 2U> unsignedFirst{
+      {std::numeric_limits<std::size_t>::max() / 2U, 3U}};
+  const NormalMatrix<2U, 1U> unsignedSecond{{3U}, {1U}};
+  EXPECT_EQ(
+      multiply<SaturatingAccumulation>(unsignedFirst, unsignedSecond)
+          .rowData(0U)[0U],
+      std::numeric_limits<std::size_t>::max());
+
+  // a product beyond the bounds is clamped with the sum, not on its own
+  const NormalMatrix<1U, 2U, std::int32_t> cancelling{{kMin, 1 << 16}};
+  const NormalMatrix<2U, 1U, std::int32_t> halfMax{{1}, {1 << 15}};
+  EXPECT_EQ(multiply<SaturatingAccumulation>(cancelling, halfMax)
+                .rowData(0U)[0U],
+            0);
+
+  constexpr auto kMin64{std::numeric_limits<std::int64_t>::min()};
+  const NormalMatrix<1U, 2U, std::int64_t> cancelling64{
+      {kMin64, std::int64_t{1} << 32}};
+  const NormalMatrix<2U, 1U, std::int64_t> halfMax64{
+      {1}, {std::int64_t{1} << 31}};
+  EXPECT_EQ(multiply<SaturatingAccumulation>(cancelling64, halfMax64)
+                .rowData(0U)[0U],
+            0);
+
+  // products that cannot overflow are the ones of the vectorized kernels
+  const NormalMatrix<2U, 2U, std::int32_t> small{{1, 2}, {3, 4}};
+  EXPECT_EQ(multiply<SaturatingAccumulation>(small, small).display(),
+            (small * small).display());
+}
+
+TEST(TestingAccumulatedMultiplication, CheckingOverflows) {
+  // sums beyond 32 bits are kept whole by 64-bit elements
+  constexpr std::size_t kLarge{std::size_t{1U} << 31U};
+  const NormalMatrix<1U, 3U> row{{kLarge, kLarge, kLarge}};
+  const NormalMatrix<3U, 1U> column{{3U}, {3U}, {3U}};
+  EXPECT_EQ(multiply<CheckedAccumulation>(row, column).rowData(0U)[0U],
+            9U * kLarge);
+
+  const NormalMatrix<1U, 2U> overflowing{
+      {std::numeric_limits<std::size_t>::max(), 1U}};
+  const NormalMatrix<2U, 1U> factors{{1U}, {1U}};
+  EXPECT_THROW((void)multiply<CheckedAccumulation>(overflowing, factors),
+               std::overflow_error);
+
+  const NormalMatrix<2U, 2U, std::int32_t> signedFirst{
+      {std::numeric_limits<std::int32_t>::min(), 0}, {1, 1}};
+  const NormalMatrix<2U, 2U, std::int32_t> minusOne{{-1, 0}, {0, -1}};
+  EXPECT_THROW((void)multiply<CheckedAccumulation>(signedFirst, minusOne),
+               std::overflow_error);
+
+  // operands of packed types are multiplied too
+  const LowerTriangularMatrix<2U, std::int32_t> lower{{2}, {3, 4}};
+  const NormalMatrix<2U, 2U, std::int32_t> small{{1, 2}, {3, 4}};
+  EXPECT_EQ(multiply<CheckedAccumulation>(lower, small).rowData(1U)[1U], 22);
+
+  EXPECT_THROW((void)multiply<CheckedAccumulation>(
+                   DynamicMatrix<std::size_t>(2U, 3U),
+                   DynamicMatrix<std::size_t>(2U, 3U)),
+               std::invalid_argument);
+}
+
+TEST(TestingAccumulatedMultiplication, NarrowElements) {
+  // elements narrower than int are promoted by arithmetic, and must still be
+  // saturated and checked in their own type
+  using Pair16 = std::array<std::int16_t, 2U>;
+  using Single16 = std::array<std::int16_t, 1U>;
+  constexpr auto kMax16{std::numeric_limits<std::int16_t>::max()};
+  constexpr auto kMin16{std::numeric_limits<std::int16_t>::min()};
+  const NormalMatrix<2U, 2U, std::int16_t> first16{
+      std::array{Pair16{kMax16, 1}, Pair16{-2, 3}}};
+  const NormalMatrix<2U, 2U, std::int16_t> second16{
+      std::array{Pair16{2, -2}, Pair16{1, 1}}};
+  const auto saturated16{multiply<SaturatingAccumulation>(first16, second16)};
+  EXPECT_EQ(saturated16.rowData(0U)[0U], kMax16);
+  EXPECT_EQ(saturated16.rowData(0U)[1U], kMin16 + 1);
+  EXPECT_EQ(saturated16.rowData(1U)[0U], -1);
+  EXPECT_EQ(saturated16.rowData(1U)[1U], 7);
+
+  const NormalMatrix<1U, 2U, std::int16_t> checked16{
+      std::array<Pair16, 1U>{Pair16{100, 200}}};
+  const NormalMatrix<2U, 1U, std::int16_t> factors16{
+      std::array{Single16{2}, Single16{3}}};
+  EXPECT_EQ(
+      multiply<CheckedAccumulation>(checked16, factors16).rowData(0U)[0U],
+      800);
+  EXPECT_THROW((void)multiply<CheckedAccumulation>(first16, second16),
+               std::overflow_error);
+
+  using Pair8 = std::array<std::int8_t, 2U>;
+  using Single8 = std::array<std::int8_t, 1U>;
+  constexpr auto kMin8{std::numeric_limits<std::int8_t>::min()};
+  const NormalMatrix<1U, 2U, std::int8_t> first8{
+      std::array<Pair8, 1U>{Pair8{-100, -100}}};
+  const NormalMatrix<2U, 1U, std::int8_t> second8{
+      std::array{Single8{1}, Single8{1}}};
+  EXPECT_EQ(
+      multiply<SaturatingAccumulation>(first8, second8).rowData(0U)[0U],
+      kMin8);
+
+  const NormalMatrix<1U, 2U, std::int8_t> checked8{
+      std::array<Pair8, 1U>{Pair8{10, -3}}};
+  const NormalMatrix<2U, 1U, std::int8_t> factors8{
+      std::array{Single8{5}, Single8{4}}};
+  EXPECT_EQ(multiply<CheckedAccumulation>(checked8, factors8).rowData(0U)[0U],
+            38);
+  const NormalMatrix<1U, 1U, std::int8_t> minimum8{
+      std::array<Single8, 1U>{Single8{kMin8}}};
+  const NormalMatrix<1U, 1U, std::int8_t> minusOne8{
+      std::array<Single8, 1U>{Single8{-1}}};
+  EXPECT_THROW((void)multiply<CheckedAccumulation>(minimum8, minusOne8),
+               std::overflow_error);
+}
+
+TEST(TestingAccumulatedMultiplication, BoundingProducts) {
+  const std::vector<std::int32_t> first{-7, 3, 100};
+  const std::vector<std::int32_t> second{-1000, 20};
+  EXPECT_TRUE(matrix_common::productFitsType(std::span{first},
+                                             std::span{second}, 3U));
+  EXPECT_FALSE(matrix_common::productFitsType(
+      std::span{first}, std::span{second}, std::size_t{1U} << 22U));
+
+  const std::vector<std::int32_t> minimum{
+      std::numeric_limits<std::int32_t>::min()};
+  const std::vector<std::int32_t> one{1};
+  EXPECT_FALSE(matrix_common::productFitsType(std::span{minimum},
+                                              std::span{one}, 1U));
+}
+
+TEST(TestingAccumulatedMultiplication, CheckingOnExecutors) {
+  constexpr std::size_t kSize{200U};
+  DynamicMatrix<std::int32_t> matrix(kSize, kSize);
+  for (std::size_t i{0U}; i < kSize; ++i) {
+    for (std::size_t j{0U}; j < kSize; ++j) {
+      matrix.rowData(i)[j] = static_cast<std::int32_t>((i + j) % 9U) - 4;
+    }
+  }
+
+  common::ThreadPool pool{4U};
+  const auto checked{multiply<CheckedAccumulation>(matrix, matrix, pool)};
+  const auto wrapping{multiply<WrappingAccumulation>(matrix, matrix, pool)};
+  for (std::size_t i{0U}; i < kSize; ++i) {
+    EXPECT_TRUE(checked.rowView(i) == wrapping.rowView(i));
+  }
+
+  // an overflow in a single task is thrown by the executor
+  matrix.rowData(kSize - 1U)[0U] = std::numeric_limits<std::int32_t>::max();
+  matrix.rowData(0U)[kSize - 1U] = std::numeric_limits<std::int32_t>::max();
+  EXPECT_THROW((void)multiply<CheckedAccumulation>(matrix, matrix, pool),
+               std::overflow_error);
+}
+
+}  // namespace data_structures_test::matrixAdt_test
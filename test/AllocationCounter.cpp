@@ -0,0 +1,52 @@
+#include "AllocationCounter.hpp"
+
+#include <cstddef>
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+/// @brief number of allocations made by each thread
+thread_local std::size_t tAllocations{0U};
+
+auto data_structures_test::allocationsOfThisThread() noexcept -> std::size_t {
+  return tAllocations;
+}
+
+// replacements of the global allocation functions counting every allocation
+// of the thread, the array and non-throwing forms forward to these ones
+
+auto operator new(std::size_t size) -> void* {
+  ++tAllocations;
+  if (void* const pointer{std::malloc(size == 0U ? 1U : size)}) {
+    return pointer;
+  }
+
+  throw std::bad_alloc{};
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* {
+  ++tAllocations;
+  const auto boundary{static_cast<std::size_t>(alignment)};
+  const auto rounded{(std::max(size, std::size_t{1U}) + boundary - 1U) /
+                     boundary * boundary};
+  if (void* const pointer{std::aligned_alloc(boundary, rounded)}) {
+    return pointer;
+  }
+
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t /*alignment*/) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/,
+                     std::align_val_t /*alignment*/) noexcept {
+  std::free(pointer);
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+
+/// @brief namespace for helpers shared by the tests
+namespace data_structures_test {
+
+/// @brief function to return the number of allocations made so far by the
+///        calling thread, counted by the replacements of the global
+///        allocation functions in AllocationCounter.cpp
+/// @return number of allocations of the calling thread
+auto allocationsOfThisThread() noexcept -> std::size_t;
+
+}  // namespace data_structures_test
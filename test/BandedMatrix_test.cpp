@@ -0,0 +1,106 @@
+#include "data-structures/matrix-types/BandedMatrix.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+TEST(TestingConstruction, ConstructingBandedMatrices) {
+  EXPECT_NO_THROW({ (TridiagonalMatrix<1U>{}); });
+  EXPECT_NO_THROW({ (BandedMatrix<3U, 0U, 2U>{{1U, 2U, 3U}}); });
+
+  // rows start at their first column within the band
+  const TridiagonalMatrix<4U> tridiagonal{
+      {1U, 2U}, {3U, 4U, 5U}, {6U, 7U, 8U, 9U}, {10U}};
+  EXPECT_STREQ(tridiagonal.display().c_str(),
+               "|1 2 0 0|\n|3 4 5 0|\n|0 6 7 8|\n|0 0 10 0|");
+  EXPECT_EQ(tridiagonal.row(2U),
+            (std::array<std::size_t, 4U>{0U, 6U, 7U, 8U}));
+  EXPECT_EQ(tridiagonal.column(1U),
+            (std::array<std::size_t, 4U>{2U, 4U, 6U, 0U}));
+
+  // only the band of a dense matrix is kept
+  const NormalMatrix<3U, 3U> dense{{1U, 2U, 3U}, {4U, 5U, 6U}, {7U, 8U, 9U}};
+  const BandedMatrix<3U, 2U, 0U> lower{dense};
+  EXPECT_STREQ(lower.display().c_str(), "|1 0 0|\n|4 5 0|\n|7 8 9|");
+  EXPECT_EQ(lower.columnView(0U), dense.columnView(0U));
+}
+
+TEST(TestingMultiplication, BandedMatricesMultiplication) {
+  const TridiagonalMatrix<4U> first{
+      {1U, 2U}, {3U, 4U, 5U}, {6U, 7U, 8U}, {9U, 10U}};
+  const BandedMatrix<4U, 0U, 1U> second{
+      {1U, 1U}, {2U, 2U}, {3U, 3U}, {4U}};
+  const NormalMatrix<4U, 4U> firstDense{
+      {1U, 2U, 0U, 0U}, {3U, 4U, 5U, 0U}, {0U, 6U, 7U, 8U}, {0U, 0U, 9U, 10U}};
+  const NormalMatrix<4U, 4U> secondDense{
+      {1U, 1U, 0U, 0U}, {0U, 2U, 2U, 0U}, {0U, 0U, 3U, 3U}, {0U, 0U, 0U, 4U}};
+  const auto expected{(firstDense * secondDense).display()};
+
+  // bandwidths of the operands add up in the product
+  const auto product{first * second};
+  static_assert(std::is_same_v<std::remove_const_t<decltype(product)>,
+                               BandedMatrix<4U, 1U, 2U>>);
+  EXPECT_STREQ(product.display().c_str(), expected.c_str());
+
+  // a band as wide as the matrix is clamped to it
+  static_assert(
+      std::is_same_v<decltype(product * product), BandedMatrix<4U, 2U, 3U>>);
+  EXPECT_STREQ((product * product).display().c_str(),
+               ((firstDense * secondDense) * (firstDense * secondDense))
+                   .display()
+                   .c_str());
+
+  ::common::ThreadPool pool{2U};
+  EXPECT_STREQ(first.multiply(second, pool).display().c_str(),
+               expected.c_str());
+
+  EXPECT_STREQ((first * secondDense).display().c_str(), expected.c_str());
+  EXPECT_STREQ((firstDense * second).display().c_str(), expected.c_str());
+  EXPECT_STREQ((first * DynamicMatrix<>{secondDense}).display().c_str(),
+               expected.c_str());
+
+  EXPECT_EQ(first.multiplyVector({1U, 2U, 3U, 4U}),
+            (std::array<std::size_t, 4U>{5U, 26U, 65U, 67U}));
+}
+
+TEST(TestingCompoundAssignment, BandedMatricesCompoundAssignment) {
+  TridiagonalMatrix<3U> matrix{{1U, 2U}, {3U, 4U, 5U}, {6U, 7U}};
+
+  matrix += TridiagonalMatrix<3U>{{1U, 1U}, {1U, 1U, 1U}, {1U, 1U}};
+  EXPECT_STREQ(matrix.display().c_str(), "|2 3 0|\n|4 5 6|\n|0 7 8|");
+
+  // narrower bands fit in the band of the matrix
+  matrix -= BandedMatrix<3U, 1U, 0U>{{2U}, {4U, 5U}, {7U, 8U}};
+  EXPECT_STREQ(matrix.display().c_str(), "|0 3 0|\n|0 0 6|\n|0 0 0|");
+
+  matrix += DiagonalMatrix<3U>{1U, 1U, 1U};
+  matrix *= 2U;
+  EXPECT_STREQ(matrix.display().c_str(), "|2 6 0|\n|0 2 12|\n|0 0 2|");
+}
+
+TEST(TestingStructure, DetectStructureOfBandedMatrices) {
+  const TridiagonalMatrix<3U> symmetric{{1U, 2U}, {2U, 3U, 4U}, {4U, 5U}};
+  EXPECT_TRUE(symmetric.isSymmetric());
+  EXPECT_FALSE((TridiagonalMatrix<3U>{{1U, 2U}, {3U, 4U}}).isSymmetric());
+  EXPECT_FALSE((BandedMatrix<3U, 0U, 2U>{{1U, 0U, 2U}}).isSymmetric());
+  EXPECT_TRUE((BandedMatrix<3U, 2U, 0U>{{1U}, {0U, 2U}}).isSymmetric());
+
+  EXPECT_TRUE(symmetric.isBanded(1U));
+  EXPECT_FALSE(symmetric.isBanded(0U));
+  EXPECT_TRUE((BandedMatrix<3U, 2U, 2U>{{1U, 2U}, {3U, 4U, 5U}}).isBanded(1U));
+  EXPECT_FALSE((BandedMatrix<3U, 2U, 2U>{{1U, 0U, 2U}}).isBanded(1U));
+
+  EXPECT_TRUE((TridiagonalMatrix<2U>{{1U}, {2U, 3U}}).isLowerTriangular());
+  EXPECT_FALSE(symmetric.isLowerTriangular());
+  EXPECT_TRUE((TridiagonalMatrix<2U>{{1U}, {0U, 3U}}).isDiagonal());
+}
+
+}  // namespace data_structures_test::matrixAdt_test
@@ -0,0 +1,98 @@
+#include "data-structures/matrix-types/BatchedMultiplication.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+/// @brief helper function to build a batch of distinct matrices
+/// @tparam MatrixT type of the matrices
+/// @param batchSize number of matrices
+/// @param seed offset making the elements of different batches differ
+/// @return the batch
+template <typename MatrixT>
+auto makeBatch(std::size_t batchSize, std::size_t seed) {
+  using value_type = MatrixT::value_type;
+  constexpr auto kRows{MatrixT::dimensions().kRows};
+  constexpr auto kColumns{MatrixT::dimensions().kColumns};
+
+  std::vector<MatrixT> batch(batchSize);
+  for (std::size_t m{0U}; m < batchSize; ++m) {
+    for (std::size_t i{0U}; i < kRows; ++i) {
+      for (std::size_t j{0U}; j < kColumns; ++j) {
+        batch[m].rowData(i)[j] = static_cast<value_type>(
+            ((m * 7U) + (i * 5U) + (j * 3U) + seed) % 17U);
+      }
+    }
+  }
+
+  return batch;
+}
+
+TEST(TestingMultiplication, BatchedNormalMatricesMultiplication) {
+  // not a multiple of the lanes, so that the last group is partial
+  constexpr std::size_t kBatchSize{1000U};
+
+  const auto first{makeBatch<NormalMatrix<3U, 3U>>(kBatchSize, 1U)};
+  const auto second{makeBatch<NormalMatrix<3U, 3U>>(kBatchSize, 2U)};
+  std::vector<NormalMatrix<3U, 3U>> result(kBatchSize);
+  multiplyBatched(std::span{first}, std::span{second}, std::span{result});
+  for (std::size_t m{0U}; m < kBatchSize; ++m) {
+    EXPECT_STREQ(result[m].display().c_str(),
+                 (first[m] * second[m]).display().c_str());
+  }
+
+  const auto firstReals{makeBatch<NormalMatrix<4U, 4U, float>>(kBatchSize, 3U)};
+  const auto secondReals{
+      makeBatch<NormalMatrix<4U, 4U, float>>(kBatchSize, 4U)};
+  std::vector<NormalMatrix<4U, 4U, float>> realResult(kBatchSize);
+  multiplyBatched(firstReals, secondReals, realResult);
+  for (std::size_t m{0U}; m < kBatchSize; ++m) {
+    EXPECT_STREQ(realResult[m].display().c_str(),
+                 (firstReals[m] * secondReals[m]).display().c_str());
+  }
+}
+
+TEST(TestingMultiplication, BatchedRectangularMatricesMultiplication) {
+  constexpr std::size_t kBatchSize{45U};
+
+  const auto first{makeBatch<NormalMatrix<2U, 3U, double>>(kBatchSize, 5U)};
+  const auto second{makeBatch<NormalMatrix<3U, 4U, double>>(kBatchSize, 6U)};
+  std::vector<NormalMatrix<2U, 4U, double>> result(kBatchSize);
+  multiplyBatched(first, second, result);
+  for (std::size_t m{0U}; m < kBatchSize; ++m) {
+    EXPECT_STREQ(result[m].display().c_str(),
+                 (first[m] * second[m]).display().c_str());
+  }
+
+  std::vector<NormalMatrix<2U, 4U, double>> shorter(kBatchSize - 1U);
+  EXPECT_THROW(multiplyBatched(first, second, shorter), std::invalid_argument);
+}
+
+TEST(TestingMultiplication, BatchedMatricesMultiplicationOnThreadPool) {
+  constexpr std::size_t kBatchSize{5000U};
+
+  const auto first{
+      makeBatch<NormalMatrix<8U, 8U, std::int32_t>>(kBatchSize, 7U)};
+  const auto second{
+      makeBatch<NormalMatrix<8U, 8U, std::int32_t>>(kBatchSize, 8U)};
+  std::vector<NormalMatrix<8U, 8U, std::int32_t>> result(kBatchSize);
+
+  common::ThreadPool pool{4U};
+  multiplyBatched(first, second, result, pool);
+  for (std::size_t m{0U}; m < kBatchSize; ++m) {
+    EXPECT_STREQ(result[m].display().c_str(),
+                 (first[m] * second[m]).display().c_str());
+  }
+}
+
+}  // namespace data_structures_test::matrixAdt_test
@@ -1,5 +1,10 @@
 #include "data-structures/matrix-types/DiagonalMatrix.hpp"
 
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
 #include "gtest/gtest.h"
 
 /// @brief namespace for matrixAdt_test tests
@@ -44,6 +49,71 @@ TEST(TestingMultiplication, DiagonalMatricesMultiplication) {
         result.display().c_str(),
         "|6 0 0 0 0|\n|0 14 0 0 0|\n|0 0 24 0 0|\n|0 0 0 36 0|\n|0 0 0 0 50|");
   }
+
+  // product of diagonal matrices stays diagonal
+  static_assert(std::is_same_v<decltype(DiagonalMatrix<3U>{} *
+                                        DiagonalMatrix<3U>{}),
+                               DiagonalMatrix<3U>>);
+}
+
+TEST(TestingMultiplication, DiagonalAndOtherMatricesMultiplication) {
+  {
+    const auto result{DiagonalMatrix<3U>{1U, 2U, 3U} *
+                      LowerTriangularMatrix<3U>{{1U}, {2U, 3U}, {4U, 5U, 6U}}};
+
+    static_assert(std::is_same_v<std::remove_const_t<decltype(result)>,
+                                 LowerTriangularMatrix<3U>>);
+    EXPECT_STREQ(result.display().c_str(), "|1 0 0|\n|4 6 0|\n|12 15 18|");
+  }
+
+  {
+    const auto result{DiagonalMatrix<2U>{2U, 3U} *
+                      NormalMatrix<2U, 3U>{{1U, 2U, 3U}, {4U, 5U, 6U}}};
+
+    EXPECT_STREQ(result.display().c_str(), "|2 4 6|\n|12 15 18|");
+  }
+
+  {
+    // column vectors are scaled element-wise
+    const auto result{DiagonalMatrix<3U>{1U, 2U, 3U} *
+                      NormalMatrix<3U, 1U>{{4U}, {5U}, {6U}}};
+
+    EXPECT_STREQ(result.display().c_str(), "|4|\n|10|\n|18|");
+  }
+
+  {
+    // an odd size, so that the vectorized kernel runs over a tail too, each
+    // element landing in its own row of the result
+    constexpr std::size_t kSize{37U};
+    std::array<std::array<std::size_t, 1U>, kSize> column;
+    for (std::size_t i{0U}; i < kSize; ++i) {
+      column[i][0U] = i + 1U;
+    }
+
+    const auto diagonal{std::apply(
+        [](auto... elements) {
+          return DiagonalMatrix<kSize>{(elements[0U] * 2U)...};
+        },
+        column)};
+    const auto result{diagonal * NormalMatrix<kSize, 1U>{column}};
+    for (std::size_t i{0U}; i < kSize; ++i) {
+      EXPECT_EQ(result.rowData(i)[0U], 2U * (i + 1U) * (i + 1U));
+    }
+  }
+}
+
+TEST(TestingCompoundAssignment, DiagonalMatricesCompoundAssignment) {
+  DiagonalMatrix<3U> matrix{1U, 2U, 3U};
+
+  matrix += DiagonalMatrix<3U>{4U, 5U, 6U};
+  EXPECT_STREQ(matrix.display().c_str(), "|5 0 0|\n|0 7 0|\n|0 0 9|");
+
+  matrix -= DiagonalMatrix<3U>{1U, 1U, 1U};
+  matrix *= DiagonalMatrix<3U>{1U, 2U, 3U};
+  EXPECT_STREQ(matrix.display().c_str(), "|4 0 0|\n|0 12 0|\n|0 0 24|");
+
+  matrix *= 3U;
+  EXPECT_STREQ(matrix.display().c_str(), "|12 0 0|\n|0 36 0|\n|0 0 72|");
 }
 
 TEST(TestingIsSymmetric, CheckSymmetricityOfDiagonalMatricesOfDifferentSizes) {
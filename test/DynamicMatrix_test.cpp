@@ -0,0 +1,232 @@
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "AllocationCounter.hpp"
+#include "data-structures/MatrixAdt.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+TEST(TestingConstruction, ConstructingDynamicMatrices) {
+  EXPECT_NO_THROW({ (DynamicMatrix<>{}); });
+  EXPECT_NO_THROW({ (DynamicMatrix<>(3U, 2U)); });
+  EXPECT_NO_THROW({ (DynamicMatrix<>{{1U, 2U}, {3U, 4U}, {5U, 6U}}); });
+
+  // dimensions whose number of elements wraps around are rejected
+  EXPECT_THROW((DynamicMatrix<>(std::size_t{1U} << 33U,
+                                std::size_t{1U} << 31U)),
+               std::invalid_argument);
+
+  EXPECT_STREQ((DynamicMatrix<>(2U, 3U)).display().c_str(),
+               "|0 0 0|\n|0 0 0|");
+
+  // shorter rows are padded with zeros up to the longest one
+  EXPECT_STREQ((DynamicMatrix<>{{1U}, {2U, 3U, 4U}}).display().c_str(),
+               "|1 0 0|\n|2 3 4|");
+
+  // from statically sized matrices
+  EXPECT_STREQ((DynamicMatrix<>{NormalMatrix<2U, 2U>{{1U, 2U}, {3U, 4U}}})
+                   .display()
+                   .c_str(),
+               "|1 2|\n|3 4|");
+  EXPECT_STREQ(
+      (DynamicMatrix<>{LowerTriangularMatrix<2U>{{1U}, {2U, 3U}}})
+          .display()
+          .c_str(),
+      "|1 0|\n|2 3|");
+}
+
+TEST(TestingConstruction, DynamicMatricesStorageIsAligned) {
+  const DynamicMatrix<double> matrix(13U, 7U);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(matrix.rowData(0U)) %
+                DynamicMatrix<double>::kAlignment,
+            0U);
+}
+
+TEST(TestingDimensions, DimensionsOfDynamicMatricesWithDifferentSizes) {
+  {
+    const auto dimensions{(DynamicMatrix<>{}).dimensions()};
+    EXPECT_EQ(dimensions.kRows, 0U);
+    EXPECT_EQ(dimensions.kColumns, 0U);
+  }
+
+  {
+    const auto dimensions{(DynamicMatrix<>(3U, 2U)).dimensions()};
+    EXPECT_EQ(dimensions.kRows, 3U);
+    EXPECT_EQ(dimensions.kColumns, 2U);
+  }
+}
+
+TEST(TestingRowAndColumn, ReadDynamicMatricesRowsAndColumns) {
+  const DynamicMatrix<> matrix{{1U, 2U, 3U}, {4U, 5U, 6U}};
+
+  EXPECT_EQ(std::vector<std::size_t>(matrix.row(1U).begin(),
+                                     matrix.row(1U).end()),
+            (std::vector<std::size_t>{4U, 5U, 6U}));
+  EXPECT_EQ(matrix.column(2U), (std::vector<std::size_t>{3U, 6U}));
+
+  EXPECT_THROW((void)matrix.row(2U), std::out_of_range);
+  EXPECT_THROW((void)matrix.column(3U), std::out_of_range);
+
+  // an empty matrix has no valid index, nor any range to report
+  const DynamicMatrix<> empty;
+  EXPECT_THROW((void)empty.row(0U), std::out_of_range);
+  EXPECT_THROW((void)empty.column(0U), std::out_of_range);
+}
+
+TEST(TestingMultiplication, DynamicMatricesMultiplication) {
+  const DynamicMatrix<> first{{1U, 2U, 3U}, {4U, 5U, 6U}};
+  const DynamicMatrix<> second{
+      {7U, 8U, 9U, 10U}, {11U, 12U, 13U, 14U}, {15U, 16U, 17U, 18U}};
+
+  EXPECT_STREQ((first * second).display().c_str(),
+               "|74 80 86 92|\n|173 188 203 218|");
+
+  EXPECT_THROW((void)(second * first), std::invalid_argument);
+}
+
+TEST(TestingMultiplication, MixedStaticAndDynamicMatricesMultiplication) {
+  const DynamicMatrix<> dynamicMatrix{{1U, 2U}, {3U, 4U}};
+
+  {
+    const DynamicMatrix<> result{NormalMatrix<3U, 2U>{{1U, 2U}, {3U, 4U},
+                                                      {5U, 6U}} *
+                                 dynamicMatrix};
+    EXPECT_STREQ(result.display().c_str(), "|7 10|\n|15 22|\n|23 34|");
+  }
+
+  {
+    const DynamicMatrix<> result{
+        dynamicMatrix * NormalMatrix<2U, 3U>{{1U, 2U, 3U}, {4U, 5U, 6U}}};
+    EXPECT_STREQ(result.display().c_str(), "|9 12 15|\n|19 26 33|");
+  }
+
+  {
+    const DynamicMatrix<> result{
+        LowerTriangularMatrix<2U>{{1U}, {2U, 3U}} * dynamicMatrix};
+    EXPECT_STREQ(result.display().c_str(), "|1 2|\n|11 16|");
+  }
+
+  {
+    const DynamicMatrix<> result{DiagonalMatrix<2U>{2U, 3U} * dynamicMatrix};
+    EXPECT_STREQ(result.display().c_str(), "|2 4|\n|9 12|");
+  }
+
+  EXPECT_THROW((void)(NormalMatrix<2U, 3U>{} * dynamicMatrix),
+               std::invalid_argument);
+}
+
+TEST(TestingCompoundAssignment, DynamicMatricesCompoundAssignment) {
+  DynamicMatrix<> matrix{{1U, 2U}, {3U, 4U}};
+
+  matrix += DynamicMatrix<>{{1U, 1U}, {1U, 1U}};
+  matrix -= NormalMatrix<2U, 2U>{{1U, 0U}, {0U, 1U}};
+  EXPECT_STREQ(matrix.display().c_str(), "|1 3|\n|4 4|");
+
+  // the number of columns follows the one of the other matrix
+  matrix *= NormalMatrix<2U, 3U>{{1U, 0U, 1U}, {0U, 1U, 1U}};
+  EXPECT_STREQ(matrix.display().c_str(), "|1 3 4|\n|4 4 8|");
+
+  matrix.scale(2U);
+  EXPECT_STREQ(matrix.display().c_str(), "|2 6 8|\n|8 8 16|");
+
+  EXPECT_THROW((matrix += DynamicMatrix<>{{1U, 2U}}), std::invalid_argument);
+
+  // products by square matrices are written over the current storage
+  DynamicMatrix<> fibonacci{{1U, 1U}, {1U, 0U}};
+  const auto* const storage{fibonacci.rowData(0U)};
+  fibonacci *= fibonacci;
+  fibonacci *= fibonacci;
+  EXPECT_STREQ(fibonacci.display().c_str(), "|5 3|\n|3 2|");
+  EXPECT_EQ(fibonacci.rowData(0U), storage);
+}
+
+TEST(TestingCompoundAssignment, RepeatedProductsOfDynamicMatricesDoNotAllocate) {
+  // a cyclic permutation, whose fourth power is the identity
+  const DynamicMatrix<double> permutation{{0.0, 1.0, 0.0, 0.0},
+                                          {0.0, 0.0, 1.0, 0.0},
+                                          {0.0, 0.0, 0.0, 1.0},
+                                          {1.0, 0.0, 0.0, 0.0}};
+  DynamicMatrix<double> matrix(3U, 4U);
+  for (std::size_t i{0U}; i < 3U; ++i) {
+    for (std::size_t j{0U}; j < 4U; ++j) {
+      matrix.rowData(i)[j] = static_cast<double>((i * 4U) + j);
+    }
+  }
+  const auto expected{matrix.display()};
+
+  // the first product may grow the workspace of the thread, later ones reuse
+  // it
+  matrix *= permutation;
+  const auto allocations{allocationsOfThisThread()};
+  for (std::size_t i{0U}; i < 7U; ++i) {
+    matrix *= permutation;
+  }
+  EXPECT_EQ(allocationsOfThisThread(), allocations);
+  EXPECT_EQ(matrix.display(), expected);
+}
+
+TEST(TestingTranspose, TransposeDynamicMatrices) {
+  EXPECT_TRUE((DynamicMatrix<>{}).transpose().isSymmetric());
+
+  // large enough to be split recursively, and not a multiple of any tile
+  DynamicMatrix<double> matrix(131U, 77U);
+  for (std::size_t i{0U}; i < 131U; ++i) {
+    for (std::size_t j{0U}; j < 77U; ++j) {
+      matrix.rowData(i)[j] = static_cast<double>((i * 77U) + j);
+    }
+  }
+
+  auto transposed{matrix.transpose()};
+  const auto asVector{[](const auto& line) {
+    return std::vector<double>(line.begin(), line.end());
+  }};
+  EXPECT_EQ(transposed.dimensions().kRows, 77U);
+  EXPECT_EQ(transposed.column(130U), asVector(matrix.row(130U)));
+  EXPECT_EQ(asVector(transposed.row(76U)), matrix.column(76U));
+
+  // non-square matrices get a new storage
+  transposed.transposeInPlace();
+  EXPECT_EQ(asVector(transposed.row(42U)), asVector(matrix.row(42U)));
+
+  DynamicMatrix<std::int32_t> square{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+  EXPECT_STREQ(square.transposeInPlace().display().c_str(),
+               "|1 4 7|\n|2 5 8|\n|3 6 9|");
+}
+
+TEST(TestingIsSymmetric, CheckSymmetricityOfDynamicMatricesOfDifferentSizes) {
+  EXPECT_TRUE((DynamicMatrix<>{}).isSymmetric());
+  EXPECT_FALSE((DynamicMatrix<>(2U, 3U)).isSymmetric());
+  EXPECT_TRUE((DynamicMatrix<>{{1U, 2U}, {2U, 3U}}).isSymmetric());
+  EXPECT_FALSE((DynamicMatrix<>{{1U, 2U}, {3U, 4U}}).isSymmetric());
+
+  // spanning several tiles, with a mismatch in the last one only
+  DynamicMatrix<float> matrix(70U, 70U);
+  for (std::size_t i{0U}; i < 70U; ++i) {
+    for (std::size_t j{0U}; j < 70U; ++j) {
+      matrix.rowData(i)[j] = static_cast<float>(i + j);
+    }
+  }
+  EXPECT_TRUE(matrix.isSymmetric());
+  matrix.rowData(68U)[69U] = 0.5F;
+  EXPECT_FALSE(matrix.isSymmetric());
+}
+
+TEST(TestingMatrixAdt, DynamicMatricesInMatrixAdt) {
+  using ::data_structures::MatrixAdt;
+
+  const MatrixAdt<DynamicMatrix<>> first{{1U, 2U}, {3U, 4U}};
+  const MatrixAdt<NormalMatrix<2U, 2U>> second{{5U, 6U}, {7U, 8U}};
+
+  EXPECT_STREQ((first * second).display().c_str(), "|19 22|\n|43 50|");
+  EXPECT_STREQ((second * first).display().c_str(), "|23 34|\n|31 46|");
+}
+
+}  // namespace data_structures_test::matrixAdt_test
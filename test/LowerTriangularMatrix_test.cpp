@@ -1,5 +1,11 @@
 #include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
 
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
 #include "gtest/gtest.h"
 
 /// @brief namespace for matrixAdt_test tests
@@ -104,6 +110,57 @@ TEST(TestingMultiplication, LowerTriangularMatricesMultiplication) {
     EXPECT_STREQ(result.display().c_str(),
                  "|11 0 0 0|\n|58 39 0 0|\n|188 155 96 0|\n|469 419 334 200|");
   }
+
+  // product of lower triangular matrices stays packed
+  static_assert(
+      std::is_same_v<decltype(LowerTriangularMatrix<3U>{} *
+                              LowerTriangularMatrix<3U>{}),
+                     LowerTriangularMatrix<3U>>);
+}
+
+TEST(TestingMultiplication, LowerTriangularAndNormalMatricesMultiplication) {
+  {
+    const auto result{
+        LowerTriangularMatrix<3U>{{1U}, {2U, 3U}, {4U, 5U, 6U}} *
+        NormalMatrix<3U, 2U>{{1U, 2U}, {3U, 4U}, {5U, 6U}}};
+
+    EXPECT_STREQ(result.display().c_str(), "|1 2|\n|11 16|\n|49 64|");
+  }
+
+  {
+    const auto result{
+        NormalMatrix<2U, 3U>{{1U, 2U, 3U}, {4U, 5U, 6U}} *
+        LowerTriangularMatrix<3U>{{1U}, {2U, 3U}, {4U, 5U, 6U}}};
+
+    EXPECT_STREQ(result.display().c_str(), "|17 21 18|\n|38 45 36|");
+  }
+
+  {
+    // packed products run on the given executor as well
+    common::ThreadPool pool{2U};
+    const auto result{
+        LowerTriangularMatrix<3U>{{1U}, {2U, 3U}, {4U, 5U, 6U}}.multiply(
+            LowerTriangularMatrix<3U>{{7U}, {8U, 9U}, {10U, 11U, 12U}},
+            pool)};
+
+    EXPECT_STREQ(result.display().c_str(), "|7 0 0|\n|38 27 0|\n|128 111 72|");
+  }
+}
+
+TEST(TestingCompoundAssignment, LowerTriangularMatricesCompoundAssignment) {
+  LowerTriangularMatrix<3U> matrix{{1U}, {2U, 3U}, {4U, 5U, 6U}};
+
+  matrix += LowerTriangularMatrix<3U>{{1U}, {1U, 1U}, {1U, 1U, 1U}};
+  EXPECT_STREQ(matrix.display().c_str(), "|2 0 0|\n|3 4 0|\n|5 6 7|");
+
+  matrix -= DiagonalMatrix<3U>{2U, 4U, 7U};
+  EXPECT_STREQ(matrix.display().c_str(), "|0 0 0|\n|3 0 0|\n|5 6 0|");
+
+  matrix *= LowerTriangularMatrix<3U>{{1U}, {1U, 1U}, {1U, 1U, 1U}};
+  EXPECT_STREQ(matrix.display().c_str(), "|0 0 0|\n|3 0 0|\n|11 6 0|");
+
+  matrix.scale(2U);
+  EXPECT_STREQ(matrix.display().c_str(), "|0 0 0|\n|6 0 0|\n|22 12 0|");
 }
 
 TEST(TestingIsSymmetric,
@@ -118,6 +175,17 @@ TEST(TestingIsSymmetric,
   EXPECT_FALSE((LowerTriangularMatrix<3U>{{1U}, {2U}, {3U}}).isSymmetric());
 }
 
+TEST(TestingStructure, DetectStructureOfLowerTriangularMatrices) {
+  const LowerTriangularMatrix<3U> lower{{1U}, {2U, 3U}, {0U, 4U, 5U}};
+  EXPECT_TRUE(lower.isBanded(1U));
+  EXPECT_FALSE(lower.isDiagonal());
+  EXPECT_FALSE((LowerTriangularMatrix<3U>{{1U}, {0U, 2U}, {3U}}).isBanded(1U));
+
+  // bands wider than the matrix hold all of it, without wrapping bounds
+  EXPECT_TRUE(lower.isBanded(2U));
+  EXPECT_TRUE(lower.isBanded(std::numeric_limits<std::size_t>::max()));
+}
+
 TEST(TestingDisplay, DisplayLowerTriangleMatricesOfDifferentSizes) {
   EXPECT_STREQ((LowerTriangularMatrix<1U>{}).display().c_str(), "|0|");
   EXPECT_STREQ((LowerTriangularMatrix<1U>{{1U}}).display().c_str(), "|1|");
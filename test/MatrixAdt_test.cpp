@@ -1,5 +1,9 @@
 #include "data-structures/MatrixAdt.hpp"
 
+#include <cstddef>
+#include <type_traits>
+
+#include "AllocationCounter.hpp"
 #include "gtest/gtest.h"
 
 /// @brief namespace for matrixAdt_test tests
@@ -87,4 +91,116 @@ TEST(TestingMultiplication, MultiplyingMatricesOfDifferentTypes) {
   }
 }
 
+TEST(TestingCompoundAssignment, CompoundAssignmentOfMatrixAdts) {
+  MatrixAdt<matrix_types::NormalMatrix<2U, 2U>> matrix{{1U, 2U}, {3U, 4U}};
+  const MatrixAdt<matrix_types::DiagonalMatrix<2U>> identity{1U, 1U};
+
+  matrix += identity;
+  EXPECT_STREQ(matrix.display().c_str(), "|2 2|\n|3 5|");
+
+  // expressions are evaluated before they are accumulated
+  matrix -= identity + identity;
+  EXPECT_STREQ(matrix.display().c_str(), "|0 2|\n|3 3|");
+
+  matrix *= identity * 2U;
+  matrix *= 2U;
+  EXPECT_STREQ(matrix.display().c_str(), "|0 8|\n|12 12|");
+
+  // expressions reading other elements of the matrix itself are evaluated
+  // whole before they are accumulated
+  matrix += transpose(matrix);
+  EXPECT_STREQ(matrix.display().c_str(), "|0 20|\n|20 24|");
+  matrix -= matrix - identity * 2U;
+  EXPECT_STREQ(matrix.display().c_str(), "|2 0|\n|0 2|");
+}
+
+TEST(TestingCompoundAssignment, CompoundAssignmentOfExpressionsDoesNotAllocate) {
+  using Matrix = MatrixAdt<matrix_types::DynamicMatrix<double>>;
+  Matrix matrix{{1.0, 2.0}, {3.0, 4.0}};
+  const Matrix upper{{0.0, 1.0}, {0.0, 0.0}};
+  const Matrix lower{{0.0, 0.0}, {1.0, 0.0}};
+  const Matrix swap{{0.0, 1.0}, {1.0, 0.0}};
+  const auto expected{matrix.display()};
+
+  // the sum of both triangles swaps the columns, and the product of swap by
+  // itself is the identity
+  const auto step{[&] {
+    matrix *= upper + lower;
+    matrix *= swap * swap;
+    matrix += upper * 2.0;
+    matrix -= upper * 2.0;
+  }};
+
+  // the first step may grow the buffers of the thread, later ones reuse them
+  step();
+  const auto allocations{allocationsOfThisThread()};
+  for (std::size_t i{0U}; i < 3U; ++i) {
+    step();
+  }
+  EXPECT_EQ(allocationsOfThisThread(), allocations);
+  EXPECT_EQ(matrix.display(), expected);
+}
+
+TEST(TestingMultiplication, MultiplyingMatricesOnExecutor) {
+  common::ThreadPool pool{2U};
+
+  {
+    const auto result{
+        MatrixAdt<matrix_types::NormalMatrix<2U, 2U>>{{1U, 2U}, {3U, 4U}}
+            .multiply(
+                MatrixAdt<matrix_types::NormalMatrix<2U, 2U>>{{5U, 6U},
+                                                              {7U, 8U}},
+                pool)};
+
+    EXPECT_STREQ(result.display().c_str(), "|19 22|\n|43 50|");
+  }
+
+  {
+    const auto result{
+        MatrixAdt<matrix_types::LowerTriangularMatrix<3U>>{
+            {1U}, {2U, 3U}, {4U, 5U, 6U}}
+            .multiply(
+                MatrixAdt<matrix_types::DiagonalMatrix<3U>>{7U, 8U, 9U}, pool)};
+
+    EXPECT_STREQ(result.display().c_str(),
+                 "|7 0 0|\n|14 24 0|\n|28 40 54|");
+  }
+
+  {
+    // matrices types without a parallel multiplication run serially
+    const auto result{
+        MatrixAdt<matrix_types::DiagonalMatrix<2U>>{1U, 2U}.multiply(
+            MatrixAdt<matrix_types::NormalMatrix<2U, 2U>>{{5U, 6U}, {7U, 8U}},
+            pool)};
+
+    EXPECT_STREQ(result.display().c_str(), "|5 6|\n|14 16|");
+  }
+}
+
+TEST(TestingMultiplication, KroneckerAndHadamardProducts) {
+  {
+    const auto result{
+        MatrixAdt<matrix_types::DiagonalMatrix<2U>>{1U, 2U}.kronecker(
+            MatrixAdt<matrix_types::DiagonalMatrix<2U>>{3U, 4U})};
+
+    EXPECT_TRUE(
+        (std::is_same_v<decltype(result),
+                        const MatrixAdt<matrix_types::DiagonalMatrix<4U>>>));
+    EXPECT_STREQ(result.display().c_str(),
+                 "|3 0 0 0|\n|0 4 0 0|\n|0 0 6 0|\n|0 0 0 8|");
+  }
+
+  {
+    const auto result{
+        MatrixAdt<matrix_types::LowerTriangularMatrix<2U>>{{1U}, {2U, 3U}}
+            .hadamard(MatrixAdt<matrix_types::NormalMatrix<2U, 2U>>{
+                {5U, 6U}, {7U, 8U}})};
+
+    EXPECT_TRUE((std::is_same_v<
+                 decltype(result),
+                 const MatrixAdt<matrix_types::LowerTriangularMatrix<2U>>>));
+    EXPECT_STREQ(result.display().c_str(), "|5 0|\n|14 24|");
+  }
+}
+
 }  // namespace data_structures_test::matrixAdt_test
@@ -0,0 +1,141 @@
+#include "data-structures/matrix-types/MatrixExpressions.hpp"
+
+#include <stdexcept>
+#include <type_traits>
+
+#include "data-structures/MatrixAdt.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures;
+
+TEST(TestingExpressions, ElementwiseExpressionsOfMatrixAdts) {
+  const MatrixAdt<matrix_types::NormalMatrix<2U, 2U>> first{{1U, 2U},
+                                                            {3U, 4U}};
+  const MatrixAdt<matrix_types::LowerTriangularMatrix<2U>> second{{5U},
+                                                                  {6U, 7U}};
+  const MatrixAdt<matrix_types::DiagonalMatrix<2U>> third{1U, 1U};
+
+  // nothing is evaluated until the result is needed
+  const auto expression{2U * (first + second) - third};
+  static_assert(matrix_types::MatrixExpression<decltype(expression)>);
+  EXPECT_STREQ(expression.display().c_str(), "|11 4|\n|18 21|");
+
+  // evaluated in a single pass into a new MatrixAdt
+  const MatrixAdt result{first + second * 3U};
+  static_assert(std::is_same_v<decltype(result),
+                               const MatrixAdt<matrix_types::NormalMatrix<
+                                   2U, 2U>>>);
+  EXPECT_STREQ(result.display().c_str(), "|16 2|\n|21 25|");
+
+  EXPECT_STREQ(transpose(first).display().c_str(), "|1 3|\n|2 4|");
+  EXPECT_STREQ(transpose(first + second).display().c_str(), "|6 9|\n|2 11|");
+}
+
+/// @brief helper function building an expression of temporaries, which it
+///        owns, so that it outlives the function
+/// @return expression of the sum of the temporaries
+auto sumOfTemporaries() {
+  return MatrixAdt<matrix_types::NormalMatrix<2U, 2U>>{{1U, 2U}, {3U, 4U}} +
+         MatrixAdt<matrix_types::DiagonalMatrix<2U>>{1U, 1U};
+}
+
+TEST(TestingExpressions, LifetimesOfOperands) {
+  using Matrix = MatrixAdt<matrix_types::NormalMatrix<2U, 2U>>;
+
+  // temporaries are moved into the expression
+  const auto owning{sumOfTemporaries()};
+  EXPECT_STREQ(owning.display().c_str(), "|2 2|\n|3 5|");
+
+  // named operands are referred to, so the expression is evaluated while
+  // they live, into a result owning its elements
+  Matrix result;
+  {
+    const Matrix first{{1U, 2U}, {3U, 4U}};
+    const Matrix second{{1U, 1U}, {1U, 1U}};
+    result = MatrixAdt{first + second};
+  }
+  EXPECT_STREQ(result.display().c_str(), "|2 3|\n|4 5|");
+
+  // const temporaries can neither be referred to nor moved from
+  static_assert(matrix_types::ExpressionOperand<const Matrix&>);
+  static_assert(matrix_types::ExpressionOperand<Matrix>);
+  static_assert(!matrix_types::ExpressionOperand<const Matrix>);
+  static_assert(!std::is_constructible_v<
+                matrix_types::TerminalExpression<
+                    matrix_types::NormalMatrix<2U, 2U>>,
+                const matrix_types::NormalMatrix<2U, 2U>>);
+}
+
+TEST(TestingExpressions, ProductsWithinExpressions) {
+  const MatrixAdt<matrix_types::NormalMatrix<2U, 3U>> first{{1U, 2U, 3U},
+                                                            {4U, 5U, 6U}};
+  const MatrixAdt<matrix_types::NormalMatrix<3U, 2U>> second{
+      {1U, 0U}, {0U, 1U}, {1U, 1U}};
+  const MatrixAdt<matrix_types::DiagonalMatrix<2U>> third{10U, 20U};
+
+  EXPECT_STREQ((first * second + third).display().c_str(),
+               "|14 5|\n|10 31|");
+  EXPECT_STREQ((transpose(second) * transpose(first)).display().c_str(),
+               "|4 10|\n|5 11|");
+
+  // chained products of temporaries own their operands
+  const auto chain{first * MatrixAdt<matrix_types::NormalMatrix<3U, 2U>>{
+                               {1U, 0U}, {0U, 1U}, {1U, 1U}} *
+                   MatrixAdt<matrix_types::DiagonalMatrix<2U>>{2U, 3U}};
+  EXPECT_STREQ(chain.display().c_str(), "|8 15|\n|20 33|");
+
+  // products of matrices keep the structure of their type
+  const MatrixAdt<matrix_types::LowerTriangularMatrix<2U>> lower{{1U},
+                                                                 {2U, 3U}};
+  static_assert(std::is_same_v<decltype(evaluate(lower * lower)),
+                               matrix_types::LowerTriangularMatrix<2U>>);
+}
+
+TEST(TestingExpressions, ExpressionsOfDynamicMatrices) {
+  const MatrixAdt<matrix_types::DynamicMatrix<>> first{{1U, 2U}, {3U, 4U}};
+  const MatrixAdt<matrix_types::NormalMatrix<2U, 2U>> second{{1U, 1U},
+                                                             {1U, 1U}};
+
+  const MatrixAdt result{first + second};
+  static_assert(
+      std::is_same_v<decltype(result),
+                     const MatrixAdt<matrix_types::DynamicMatrix<>>>);
+  EXPECT_STREQ(result.display().c_str(), "|2 3|\n|4 5|");
+
+  const MatrixAdt<matrix_types::DynamicMatrix<>> other{{1U, 2U, 3U}};
+  EXPECT_THROW((void)(first + other), std::invalid_argument);
+  EXPECT_THROW((void)(other * first), std::invalid_argument);
+}
+
+TEST(TestingExpressions, MultiplyingChainsInTheCheapestOrder) {
+  // textbook chain, of which the cheapest order costs 15125 multiply-adds
+  static_assert(matrix_types::matrix_common::optimalChainOrder<6U>(
+                    {30U, 35U, 15U, 5U, 10U, 20U, 25U})
+                    .multiplyAdds == 15125U);
+
+  const MatrixAdt<matrix_types::NormalMatrix<4U, 1U>> column{
+      {1U}, {2U}, {3U}, {4U}};
+  const MatrixAdt<matrix_types::NormalMatrix<1U, 4U>> row{{1U, 1U, 2U, 2U}};
+
+  // (column * row) * column costs 32 multiply-adds, while
+  // column * (row * column) costs only 8
+  const auto chain{multiplyChain(column, row, column)};
+  using ColumnExpression =
+      matrix_types::TerminalExpression<matrix_types::NormalMatrix<4U, 1U>>;
+  using RowExpression =
+      matrix_types::TerminalExpression<matrix_types::NormalMatrix<1U, 4U>>;
+  static_assert(
+      std::is_same_v<decltype(chain),
+                     const matrix_types::ProductExpression<
+                         ColumnExpression,
+                         matrix_types::ProductExpression<RowExpression,
+                                                         ColumnExpression>>>);
+
+  EXPECT_STREQ(chain.display().c_str(),
+               (column * row * column).display().c_str());
+  EXPECT_STREQ(chain.display().c_str(), "|17|\n|34|\n|51|\n|68|");
+}
+
+}  // namespace data_structures_test::matrixAdt_test
@@ -0,0 +1,111 @@
+#include "data-structures/matrix-types/MatrixFactorizations.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+/// @brief helper to check a solution against the expected one, element by
+///        element within a tolerance
+/// @tparam N number of elements
+/// @param actual the solution computed
+/// @param expected the solution expected
+template <std::size_t N>
+void expectNear(const std::array<double, N>& actual,
+                const std::array<double, N>& expected) {
+  for (std::size_t i{0U}; i < N; ++i) {
+    EXPECT_NEAR(actual[i], expected[i], 1e-9) << "at index " << i;
+  }
+}
+
+/// @brief helper to multiply a matrix by a vector, to build right-hand sides
+/// @tparam N number of rows and columns of the matrix
+/// @param matrix the matrix
+/// @param vector the vector
+/// @return the product
+template <std::size_t N>
+auto multiply(const NormalMatrix<N, N, double>& matrix,
+              const std::array<double, N>& vector) {
+  std::array<double, N> result{};
+  for (std::size_t i{0U}; i < N; ++i) {
+    for (std::size_t j{0U}; j < N; ++j) {
+      result[i] += matrix.rowData(i)[j] * vector[j];
+    }
+  }
+
+  return result;
+}
+
+TEST(TestingFactorizations, SolveTriangularSystems) {
+  const LowerTriangularMatrix<2U, double> lower{{2.0}, {1.0, 3.0}};
+
+  expectNear(lower.solve({4.0, 11.0}), {2.0, 3.0});
+  expectNear(lower.solveTransposed({7.0, 9.0}), {2.0, 3.0});
+
+  EXPECT_THROW(
+      (void)(LowerTriangularMatrix<2U, double>{{1.0}, {1.0}}.solve({1.0, 1.0})),
+      std::domain_error);
+}
+
+TEST(TestingFactorizations, LuFactorization) {
+  // the first pivot is zero, so rows must be swapped
+  const NormalMatrix<3U, 3U, double> matrix{
+      {0.0, 2.0, 1.0}, {1.0, 1.0, 1.0}, {2.0, 1.0, 3.0}};
+  const auto factors{luFactorization(matrix)};
+  EXPECT_EQ(factors.permutation[0U], 2U);
+  expectNear(factors.solve({7.0, 6.0, 13.0}), {1.0, 2.0, 3.0});
+
+  // larger than a panel, so that the blocked updates are exercised, with the
+  // largest element of each row off the diagonal, so that rows are swapped
+  constexpr std::size_t kSize{70U};
+  NormalMatrix<kSize, kSize, double> large{};
+  std::array<double, kSize> expected{};
+  for (std::size_t i{0U}; i < kSize; ++i) {
+    for (std::size_t j{0U}; j < kSize; ++j) {
+      large.rowData(i)[j] = static_cast<double>((i * 7U + j * 3U) % 11U);
+    }
+    large.rowData(i)[(i * 3U) % kSize] += 50.0;
+    expected[i] = static_cast<double>(i % 9U) - 4.0;
+  }
+  expectNear(luFactorization(large).solve(multiply(large, expected)),
+             expected);
+
+  EXPECT_THROW((void)luFactorization(NormalMatrix<2U, 2U, double>{
+                   {1.0, 2.0}, {2.0, 4.0}}),
+               std::domain_error);
+}
+
+TEST(TestingFactorizations, CholeskyFactorization) {
+  const auto factor{choleskyFactorization(
+      NormalMatrix<2U, 2U, double>{{4.0, 2.0}, {2.0, 3.0}})};
+  EXPECT_DOUBLE_EQ(factor.rowData(0U)[0U], 2.0);
+  EXPECT_DOUBLE_EQ(factor.rowData(1U)[0U], 1.0);
+  EXPECT_DOUBLE_EQ(factor.rowData(1U)[1U], std::sqrt(2.0));
+
+  // symmetric and strictly diagonally dominant, hence positive-definite
+  constexpr std::size_t kSize{40U};
+  NormalMatrix<kSize, kSize, double> matrix{};
+  std::array<double, kSize> expected{};
+  for (std::size_t i{0U}; i < kSize; ++i) {
+    for (std::size_t j{0U}; j < kSize; ++j) {
+      matrix.rowData(i)[j] = i == j ? 100.0 : 1.0 / static_cast<double>(i + j);
+    }
+    expected[i] = static_cast<double>(i) / 4.0;
+  }
+
+  const auto large{choleskyFactorization(matrix)};
+  expectNear(large.solveTransposed(large.solve(multiply(matrix, expected))),
+             expected);
+
+  EXPECT_THROW((void)choleskyFactorization(NormalMatrix<2U, 2U, double>{
+                   {1.0, 2.0}, {2.0, 1.0}}),
+               std::domain_error);
+}
+
+}  // namespace data_structures_test::matrixAdt_test
@@ -0,0 +1,296 @@
+#include "data-structures/matrix-types/MatrixFile.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
+#include "data-structures/matrix-types/MatrixStorage.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SparseMatrix.hpp"
+#include "data-structures/matrix-types/SymmetricMatrix.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+/// @brief helper function to name a file in the temporary directory, unique
+///        to the running test
+/// @param name name of the file
+/// @return path of the file
+auto temporaryMatrixFile(const std::string& name) {
+  return std::filesystem::temp_directory_path() /
+         (std::string{::testing::UnitTest::GetInstance()
+                          ->current_test_info()
+                          ->name()} +
+          "_" + name);
+}
+
+/// @brief helper function to check that a view reads the same rows and
+///        columns as a matrix
+/// @param view the view in question
+/// @param matrix the matrix it was written from
+void expectSameLines(const auto& view, const auto& matrix) {
+  const auto rows{matrix_common::numberOfRows(matrix)};
+  const auto columns{matrix_common::numberOfColumns(matrix)};
+  ASSERT_EQ(matrix_common::numberOfRows(view), rows);
+  ASSERT_EQ(matrix_common::numberOfColumns(view), columns);
+
+  for (std::size_t i{0U}; i < rows; ++i) {
+    EXPECT_TRUE(view.rowView(i) == matrix.rowView(i));
+  }
+  for (std::size_t j{0U}; j < columns; ++j) {
+    EXPECT_TRUE(view.columnView(j) == matrix.columnView(j));
+  }
+}
+
+TEST(TestingMatrixFile, DenseMatricesRoundTrip) {
+  const auto path{temporaryMatrixFile("dense.mat")};
+  const NormalMatrix<3U, 4U, double> matrix{
+      {1.5, 2.0, 0.0, -4.25}, {5.0, 6.0, 7.0, 8.0}, {9.0, 0.0, 1e-3, 12.0}};
+  writeMatrixFile(path, matrix);
+
+  const MappedMatrixFile file{path};
+  EXPECT_EQ(file.header().storage, MatrixStorage::kDense);
+  EXPECT_EQ(file.header().elementType, ElementType::kFloat64);
+  EXPECT_EQ(file.header().rows, 3U);
+  EXPECT_EQ(file.header().columns, 4U);
+
+  const auto view{file.view<double, MatrixStorage::kDense>()};
+  expectSameLines(view, matrix);
+  EXPECT_EQ(view.rowData(1U)[2U], 7.0);
+
+  // the view is an operand as any other matrix, read in place
+  const DynamicMatrix<double> identity{
+      {1.0, 0.0, 0.0, 0.0}, {0.0, 1.0, 0.0, 0.0}, {0.0, 0.0, 1.0, 0.0},
+      {0.0, 0.0, 0.0, 1.0}};
+  EXPECT_STREQ((DynamicMatrix<double>{view} * identity).display().c_str(),
+               DynamicMatrix<double>{matrix}.display().c_str());
+
+  std::filesystem::remove(path);
+}
+
+TEST(TestingMatrixFile, PackedMatricesRoundTrip) {
+  const auto lowerPath{temporaryMatrixFile("lower.mat")};
+  const LowerTriangularMatrix<4U, float> lower{
+      {1.0F}, {2.0F, 3.0F}, {4.0F, 5.0F, 6.0F}, {7.0F, 8.0F, 9.0F, 10.0F}};
+  writeMatrixFile(lowerPath, lower);
+  EXPECT_EQ(std::filesystem::file_size(lowerPath),
+            sizeof(MatrixFileHeader) + (10U * sizeof(float)));
+  {
+    const MappedMatrixFile file{lowerPath};
+    expectSameLines(file.view<float, MatrixStorage::kLowerTriangular>(), lower);
+  }
+
+  const auto symmetricPath{temporaryMatrixFile("symmetric.mat")};
+  const SymmetricMatrix<3U, std::int32_t> symmetric{{1}, {-2, 3}, {4, 5, -6}};
+  writeMatrixFile(symmetricPath, symmetric);
+  {
+    const MappedMatrixFile file{symmetricPath};
+    expectSameLines(file.view<std::int32_t, MatrixStorage::kSymmetric>(),
+                    symmetric);
+  }
+
+  const auto diagonalPath{temporaryMatrixFile("diagonal.mat")};
+  const DiagonalMatrix<5U> diagonal{1U, 2U, 3U, 4U, 5U};
+  writeMatrixFile(diagonalPath, diagonal);
+  EXPECT_EQ(std::filesystem::file_size(diagonalPath),
+            sizeof(MatrixFileHeader) + (5U * sizeof(std::size_t)));
+  {
+    const MappedMatrixFile file{diagonalPath};
+    expectSameLines(file.view<std::size_t, MatrixStorage::kDiagonal>(),
+                    diagonal);
+  }
+
+  // a dense matrix found lower triangular can be stored packed as well
+  const NormalMatrix<2U, 2U, float> dense{{1.0F, 0.0F}, {2.0F, 3.0F}};
+  writeMatrixFile(lowerPath, dense, MatrixStorage::kLowerTriangular);
+  {
+    const MappedMatrixFile file{lowerPath};
+    expectSameLines(file.view<float, MatrixStorage::kLowerTriangular>(), dense);
+  }
+
+  std::filesystem::remove(lowerPath);
+  std::filesystem::remove(symmetricPath);
+  std::filesystem::remove(diagonalPath);
+}
+
+TEST(TestingMatrixFile, SparseMatricesRoundTrip) {
+  // the rows of sparse matrices are written densely, zeros included
+  const auto csrPath{temporaryMatrixFile("csr.mat")};
+  const CsrMatrix<double> csr(3U, 4U, {0U, 2U, 2U, 4U}, {1U, 3U, 0U, 2U},
+                              {1.5, -2.0, 3.0, 4.25});
+  writeMatrixFile(csrPath, csr);
+  {
+    const MappedMatrixFile file{csrPath};
+    EXPECT_EQ(file.header().storage, MatrixStorage::kDense);
+    expectSameLines(file.view<double, MatrixStorage::kDense>(), csr);
+  }
+
+  const auto cooPath{temporaryMatrixFile("coo.mat")};
+  const CooMatrix<std::int32_t> coo(3U, 3U,
+                                    {{0U, 0U, 2}, {2U, 0U, 5}, {2U, 2U, -1}});
+  writeMatrixFile(cooPath, coo, MatrixStorage::kLowerTriangular);
+  {
+    const MappedMatrixFile file{cooPath};
+    expectSameLines(file.view<std::int32_t, MatrixStorage::kLowerTriangular>(),
+                    coo);
+  }
+
+  std::filesystem::remove(csrPath);
+  std::filesystem::remove(cooPath);
+}
+
+TEST(TestingMatrixFile, StreamingRowBlocks) {
+  const auto path{temporaryMatrixFile("streamed.mat")};
+  constexpr std::size_t kRows{1000U};
+  constexpr std::size_t kColumns{3U};
+  constexpr std::size_t kBlockRows{7U};
+
+  DynamicMatrix<> matrix(kRows, kColumns);
+  for (std::size_t i{0U}; i < kRows; ++i) {
+    for (std::size_t j{0U}; j < kColumns; ++j) {
+      matrix.rowData(i)[j] = (i * kColumns) + j;
+    }
+  }
+
+  {
+    MatrixFileWriter<std::size_t> writer{path, MatrixStorage::kDense, kRows,
+                                         kColumns};
+    for (std::size_t i{0U}; i < kRows; i += kBlockRows) {
+      const auto blockRows{std::min(kBlockRows, kRows - i)};
+      writer.write(std::span{matrix.rowData(i), blockRows * kColumns});
+    }
+
+    EXPECT_EQ(writer.remaining(), 0U);
+    EXPECT_THROW(writer.write(std::span{matrix.rowData(0U), 1U}),
+                 std::length_error);
+    writer.close();
+  }
+
+  const MappedMatrixFile file{path};
+  expectSameLines(file.view<std::size_t, MatrixStorage::kDense>(), matrix);
+
+  {
+    MatrixFileWriter<std::size_t> writer{path, MatrixStorage::kDense, kRows,
+                                         kColumns};
+    writer.write(std::span{matrix.rowData(0U), kColumns});
+    EXPECT_THROW(writer.close(), std::length_error);
+  }
+
+  std::filesystem::remove(path);
+}
+
+TEST(TestingMatrixFile, RejectingInvalidFiles) {
+  const auto path{temporaryMatrixFile("invalid.mat")};
+
+  EXPECT_THROW({ (void)MappedMatrixFile{path}; }, std::system_error);
+
+  EXPECT_THROW(
+      (MatrixFileWriter<float>{path, MatrixStorage::kLowerTriangular, 2U, 3U}),
+      std::invalid_argument);
+  EXPECT_THROW((MatrixFileWriter<float>{path, MatrixStorage::kSparse, 2U, 2U}),
+               std::invalid_argument);
+
+  const NormalMatrix<2U, 2U, float> matrix{{1.0F, 2.0F}, {3.0F, 4.0F}};
+  writeMatrixFile(path, matrix);
+  {
+    const MappedMatrixFile file{path};
+    EXPECT_THROW(
+        { (void)(file.view<double, MatrixStorage::kDense>()); },
+        std::invalid_argument);
+    EXPECT_THROW(
+        { (void)(file.view<float, MatrixStorage::kSymmetric>()); },
+        std::invalid_argument);
+  }
+
+  // truncated files and files of other formats are detected on opening
+  std::filesystem::resize_file(path, sizeof(MatrixFileHeader) + 4U);
+  EXPECT_THROW({ (void)MappedMatrixFile{path}; }, std::runtime_error);
+
+  std::ofstream{path} << "not a matrix file, but long enough to hold a header"
+                         " of a matrix file, which is sixty four bytes";
+  EXPECT_THROW({ (void)MappedMatrixFile{path}; }, std::runtime_error);
+
+  std::filesystem::remove(path);
+}
+
+TEST(TestingMatrixFile, RejectingMalformedHeaders) {
+  const auto path{temporaryMatrixFile("malformed.mat")};
+  const auto writeFile{[&path](const MatrixFileHeader& header,
+                               std::size_t elementBytes) {
+    const auto headerBytes{
+        std::bit_cast<std::array<char, sizeof(MatrixFileHeader)>>(header)};
+    std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+    stream.write(headerBytes.data(), headerBytes.size());
+    const std::vector<char> elements(elementBytes);
+    stream.write(elements.data(), static_cast<std::streamsize>(elementBytes));
+  }};
+
+  // a well-formed header is accepted, as a baseline for the ones below
+  const MatrixFileHeader header{.elementType = ElementType::kInt32,
+                                .storage = MatrixStorage::kDense,
+                                .elementSize = 4U,
+                                .rows = 2U,
+                                .columns = 2U,
+                                .storedElements = 4U};
+  writeFile(header, 16U);
+  EXPECT_NO_THROW({ (void)MappedMatrixFile{path}; });
+
+  // elements tagged 32-bit but of 2 bytes, whose view would read past the
+  // end of the file
+  auto shortElements{header};
+  shortElements.elementSize = 2U;
+  writeFile(shortElements, 8U);
+  EXPECT_THROW({ (void)MappedMatrixFile{path}; }, std::runtime_error);
+
+  // a corrupted tag of no known type, whose size of zero would match an
+  // element size of zero and no bytes of elements
+  auto unknownType{header};
+  unknownType.elementType = static_cast<ElementType>(0xA5U);
+  unknownType.elementSize = 0U;
+  writeFile(unknownType, 0U);
+  EXPECT_THROW({ (void)MappedMatrixFile{path}; }, std::runtime_error);
+
+  // 2^32 * 2^32 elements wrap to zero, matching an empty file
+  auto wrappingDense{header};
+  wrappingDense.rows = std::uint64_t{1U} << 32U;
+  wrappingDense.columns = std::uint64_t{1U} << 32U;
+  wrappingDense.storedElements = 0U;
+  writeFile(wrappingDense, 0U);
+  EXPECT_THROW({ (void)MappedMatrixFile{path}; }, std::runtime_error);
+
+  // a diagonal whose size only wraps once multiplied by the element size
+  auto wrappingBytes{header};
+  wrappingBytes.storage = MatrixStorage::kDiagonal;
+  wrappingBytes.rows = std::uint64_t{1U} << 62U;
+  wrappingBytes.columns = std::uint64_t{1U} << 62U;
+  wrappingBytes.storedElements = std::uint64_t{1U} << 62U;
+  writeFile(wrappingBytes, 0U);
+  EXPECT_THROW({ (void)MappedMatrixFile{path}; }, std::runtime_error);
+
+  auto wrappingTriangle{header};
+  wrappingTriangle.storage = MatrixStorage::kLowerTriangular;
+  wrappingTriangle.rows = std::uint64_t{1U} << 33U;
+  wrappingTriangle.columns = std::uint64_t{1U} << 33U;
+  wrappingTriangle.storedElements = 0U;
+  writeFile(wrappingTriangle, 0U);
+  EXPECT_THROW({ (void)MappedMatrixFile{path}; }, std::runtime_error);
+
+  std::filesystem::remove(path);
+}
+
+}  // namespace data_structures_test::matrixAdt_test
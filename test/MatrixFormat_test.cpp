@@ -0,0 +1,145 @@
+#include "data-structures/matrix-types/MatrixFormat.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "data-structures/MatrixAdt.hpp"
+#include "data-structures/matrix-types/BandedMatrix.hpp"
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SparseMatrix.hpp"
+#include "data-structures/matrix-types/SymmetricMatrix.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+TEST(TestingMatrixFormat, FormattingAsDisplayed) {
+  const NormalMatrix<2U, 3U, double> normal{{1.5, -0.25, 1e10},
+                                            {1.0 / 3.0, -0.0, 42.0}};
+  EXPECT_STREQ(normal.display().c_str(),
+               "|1.500000 -0.250000 10000000000.000000|\n"
+               "|0.333333 -0.000000 42.000000|");
+  EXPECT_EQ(std::format("{}", normal), normal.display());
+
+  const LowerTriangularMatrix<3U, std::int32_t> lower{{1}, {-2, 3}, {4, 5, 6}};
+  EXPECT_STREQ(std::format("{}", lower).c_str(), "|1 0 0|\n|-2 3 0|\n|4 5 6|");
+
+  const DiagonalMatrix<3U> diagonal{7U, 8U, 9U};
+  EXPECT_EQ(std::format("{}", diagonal), diagonal.display());
+
+  const SymmetricMatrix<2U, float> symmetric{{1.0F}, {2.0F, 3.0F}};
+  EXPECT_STREQ(std::format("{}", symmetric).c_str(),
+               "|1.000000 2.000000|\n|2.000000 3.000000|");
+
+  const CsrMatrix<std::int32_t> sparse{
+      DynamicMatrix<std::int32_t>{{0, 1}, {2, 0}}};
+  EXPECT_EQ(std::format("{}", sparse), sparse.display());
+
+  const ::data_structures::MatrixAdt<NormalMatrix<2U, 2U>> adt{{1U, 2U},
+                                                               {3U, 4U}};
+  EXPECT_STREQ(std::format("[{}]", adt).c_str(), "[|1 2|\n|3 4|]");
+}
+
+TEST(TestingMatrixFormat, FormattingToOutputIterators) {
+  const DynamicMatrix<std::int64_t> matrix{{-1, 20}, {300, -4000}};
+
+  std::vector<char> characters;
+  formatMatrixTo(std::back_inserter(characters), matrix);
+  EXPECT_EQ(std::string(characters.begin(), characters.end()),
+            matrix.display());
+
+  std::ostringstream stream;
+  printMatrix(stream, matrix);
+  EXPECT_EQ(stream.str(), matrix.display());
+
+  auto* const file{std::tmpfile()};
+  ASSERT_NE(file, nullptr);
+  printMatrix(file, matrix);
+  std::rewind(file);
+  std::string text(matrix.display().size(), '\0');
+  EXPECT_EQ(std::fread(text.data(), 1U, text.size(), file), text.size());
+  EXPECT_EQ(text, matrix.display());
+  (void)std::fclose(file);
+}
+
+TEST(TestingMatrixFormat, PrintingInBlocks) {
+  // enough rows for several blocks of text
+  constexpr std::size_t kSize{300U};
+  DynamicMatrix<double> matrix(kSize, kSize);
+  for (std::size_t i{0U}; i < kSize; ++i) {
+    for (std::size_t j{0U}; j < kSize; ++j) {
+      matrix.rowData(i)[j] =
+          static_cast<double>(i) - (0.125 * static_cast<double>(j));
+    }
+  }
+
+  std::ostringstream stream;
+  printMatrix(stream, matrix);
+  EXPECT_GT(stream.str().size(), 2U * matrix_common::kFormatBlockBytes);
+  EXPECT_EQ(stream.str(), std::format("{}", matrix));
+
+  // a matrix shown by the formerly concatenated std::to_string() calls
+  std::string expected;
+  for (std::size_t i{0U}; i < kSize; ++i) {
+    expected += i == 0U ? "|" : "\n|";
+    for (std::size_t j{0U}; j < kSize; ++j) {
+      expected += std::to_string(matrix.rowData(i)[j]) +
+                  (j == kSize - 1U ? "|" : " ");
+    }
+  }
+  EXPECT_EQ(stream.str(), expected);
+}
+
+TEST(TestingMatrixFormat, DumpingBinaryElements) {
+  const NormalMatrix<2U, 3U, float> normal{{1.0F, 2.0F, 3.0F},
+                                           {4.0F, 5.0F, 6.0F}};
+  std::ostringstream stream;
+  dumpMatrix(stream, normal);
+  ASSERT_EQ(stream.str().size(), 6U * sizeof(float));
+  EXPECT_EQ(stream.str(), std::string(reinterpret_cast<const char*>(
+                                          normal.rowData(0U)),
+                                      6U * sizeof(float)));
+  EXPECT_EQ(std::format("{:b}", normal), stream.str());
+
+  // packed matrices are dumped with their zeros
+  const LowerTriangularMatrix<2U, std::int32_t> lower{{1}, {2, 3}};
+  const std::vector<std::int32_t> elements{1, 0, 2, 3};
+  const std::string expected(reinterpret_cast<const char*>(elements.data()),
+                             elements.size() * sizeof(std::int32_t));
+  EXPECT_EQ(std::format("{:b}", lower), expected);
+
+  auto* const file{std::tmpfile()};
+  ASSERT_NE(file, nullptr);
+  dumpMatrix(file, lower);
+  std::rewind(file);
+  std::vector<std::int32_t> read(elements.size());
+  EXPECT_EQ(std::fread(read.data(), sizeof(std::int32_t), read.size(), file),
+            read.size());
+  EXPECT_EQ(read, elements);
+  (void)std::fclose(file);
+
+  const BandedMatrix<3U, 1U, 0U, std::int32_t> banded{{1}, {2, 3}, {4, 5}};
+  std::ostringstream bandedStream;
+  dumpMatrix(bandedStream, banded);
+  EXPECT_EQ(bandedStream.str().size(), 9U * sizeof(std::int32_t));
+}
+
+TEST(TestingMatrixFormat, RejectingUnknownSpecifications) {
+  const NormalMatrix<1U, 1U> matrix{{1U}};
+  EXPECT_THROW((void)std::vformat("{:x}", std::make_format_args(matrix)),
+               std::format_error);
+  EXPECT_THROW((void)std::vformat("{:bb}", std::make_format_args(matrix)),
+               std::format_error);
+}
+
+}  // namespace data_structures_test::matrixAdt_test
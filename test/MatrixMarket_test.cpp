@@ -0,0 +1,292 @@
+#include "data-structures/matrix-types/MatrixMarket.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <variant>
+
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SymmetricMatrix.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+/// @brief helper function to check that two dense matrices hold the same
+///        elements
+/// @param matrix the matrix in question
+/// @param expected the matrix it should equal
+void expectSameRows(const DynamicMatrix<double>& matrix,
+                    const DynamicMatrix<double>& expected) {
+  const auto rows{matrix_common::numberOfRows(expected)};
+  ASSERT_EQ(matrix_common::numberOfRows(matrix), rows);
+  ASSERT_EQ(matrix_common::numberOfColumns(matrix),
+            matrix_common::numberOfColumns(expected));
+
+  for (std::size_t i{0U}; i < rows; ++i) {
+    EXPECT_TRUE(matrix.rowView(i) == expected.rowView(i));
+  }
+}
+
+TEST(TestingMatrixMarket, ParsingCoordinateFiles) {
+  const auto result{parseMatrixMarket<double>(
+      "%%MatrixMarket matrix coordinate real general\n"
+      "% a comment line\n"
+      "%\n"
+      "  2 3   4\n"
+      "1 1 1.5\n"
+      "2 3 -2e-1\n"
+      "\n"
+      "1 3 +4\n"
+      "2 2 7\n")};
+
+  EXPECT_EQ(result.header.format, MatrixMarketFormat::kCoordinate);
+  EXPECT_EQ(result.header.field, MatrixMarketField::kReal);
+  EXPECT_EQ(result.header.symmetry, MatrixMarketSymmetry::kGeneral);
+  EXPECT_EQ(result.header.entries, 4U);
+  EXPECT_STREQ(result.matrix.display().c_str(),
+               (DynamicMatrix<double>{{1.5, 0.0, 4.0}, {0.0, 7.0, -0.2}})
+                   .display()
+                   .c_str());
+
+  // keywords of the banner are case-insensitive, patterns hold ones
+  const auto pattern{parseMatrixMarket<std::int32_t>(
+      "%%MatrixMarket MATRIX Coordinate Pattern General\n2 2 2\n1 2\n2 1\n")};
+  EXPECT_EQ(pattern.header.field, MatrixMarketField::kPattern);
+  EXPECT_STREQ(pattern.matrix.display().c_str(),
+               (DynamicMatrix<std::int32_t>{{0, 1}, {1, 0}}).display().c_str());
+
+  // symmetric files list the lower triangle only
+  const auto skew{parseMatrixMarket<std::int32_t>(
+      "%%MatrixMarket matrix coordinate integer skew-symmetric\n"
+      "3 3 2\n2 1 5\n3 2 -1\n")};
+  EXPECT_STREQ(
+      skew.matrix.display().c_str(),
+      (DynamicMatrix<std::int32_t>{{0, -5, 0}, {5, 0, 1}, {0, -1, 0}})
+          .display()
+          .c_str());
+}
+
+TEST(TestingMatrixMarket, ParsingArrayFiles) {
+  // values are listed column after column
+  const auto general{parseMatrixMarket<double>(
+      "%%MatrixMarket matrix array real general\n"
+      "3 2\n1\n2\n3\n4 5 6\n")};
+  EXPECT_EQ(general.header.format, MatrixMarketFormat::kArray);
+  EXPECT_EQ(general.header.entries, 6U);
+  EXPECT_STREQ(general.matrix.display().c_str(),
+               (DynamicMatrix<double>{{1.0, 4.0}, {2.0, 5.0}, {3.0, 6.0}})
+                   .display()
+                   .c_str());
+
+  const auto symmetric{parseMatrixMarket<double>(
+      "%%MatrixMarket matrix array real symmetric\n"
+      "3 3\n1\n2\n3\n4\n5\n6\n")};
+  EXPECT_STREQ(
+      symmetric.matrix.display().c_str(),
+      (DynamicMatrix<double>{{1.0, 2.0, 3.0}, {2.0, 4.0, 5.0}, {3.0, 5.0, 6.0}})
+          .display()
+          .c_str());
+}
+
+TEST(TestingMatrixMarket, ChoosingTheSmallestStorage) {
+  const auto diagonal{parseMatrixMarket<3U, double>(
+      "%%MatrixMarket matrix coordinate real general\n"
+      "3 3 2\n1 1 2\n3 3 4\n")};
+  ASSERT_TRUE((std::holds_alternative<DiagonalMatrix<3U, double>>(
+      diagonal.matrix)));
+  EXPECT_STREQ(
+      (std::get<DiagonalMatrix<3U, double>>(diagonal.matrix)).display().c_str(),
+      (DiagonalMatrix<3U, double>{2.0, 0.0, 4.0}).display().c_str());
+
+  const auto symmetric{parseMatrixMarket<3U, double>(
+      "%%MatrixMarket matrix coordinate real symmetric\n"
+      "3 3 3\n1 1 1\n2 1 2\n3 2 3\n")};
+  ASSERT_TRUE((std::holds_alternative<SymmetricMatrix<3U, double>>(
+      symmetric.matrix)));
+  EXPECT_STREQ(
+      (std::get<SymmetricMatrix<3U, double>>(symmetric.matrix))
+          .display()
+          .c_str(),
+      (SymmetricMatrix<3U, double>{{1.0}, {2.0, 0.0}, {0.0, 3.0, 0.0}})
+          .display()
+          .c_str());
+
+  const auto lower{parseMatrixMarket<2U, double>(
+      "%%MatrixMarket matrix array real general\n2 2\n1\n2\n0\n3\n")};
+  ASSERT_TRUE((std::holds_alternative<LowerTriangularMatrix<2U, double>>(
+      lower.matrix)));
+  EXPECT_STREQ((std::get<LowerTriangularMatrix<2U, double>>(lower.matrix))
+                   .display()
+                   .c_str(),
+               (LowerTriangularMatrix<2U, double>{{1.0}, {2.0, 3.0}})
+                   .display()
+                   .c_str());
+
+  const auto dense{parseMatrixMarket<2U, double>(
+      "%%MatrixMarket matrix array real general\n2 2\n1\n2\n5\n3\n")};
+  ASSERT_TRUE((std::holds_alternative<NormalMatrix<2U, 2U, double>>(
+      dense.matrix)));
+  EXPECT_STREQ(
+      (std::get<NormalMatrix<2U, 2U, double>>(dense.matrix)).display().c_str(),
+      (NormalMatrix<2U, 2U, double>{{1.0, 5.0}, {2.0, 3.0}}).display().c_str());
+
+  EXPECT_THROW((parseMatrixMarket<3U, double>(
+                   "%%MatrixMarket matrix array real general\n2 2\n1 2 3 4\n")),
+               std::invalid_argument);
+}
+
+TEST(TestingMatrixMarket, ReadingLargeFilesInChunks) {
+  // enough entries to span several chunks of the parser
+  constexpr std::size_t kSize{700U};
+  const auto path{std::filesystem::temp_directory_path() /
+                  "ReadingLargeFilesInChunks.mtx"};
+
+  DynamicMatrix<double> expected(kSize, kSize);
+  {
+    std::ofstream file{path};
+    file << "%%MatrixMarket matrix coordinate real general\n"
+         << std::format("{} {} {}\n", kSize, kSize, kSize * kSize);
+    for (std::size_t j{0U}; j < kSize; ++j) {
+      for (std::size_t i{0U}; i < kSize; ++i) {
+        const auto value{static_cast<double>((i * 3U) + j) / 8.0};
+        expected.rowData(i)[j] = value;
+        file << std::format("{} {} {}\n", i + 1U, j + 1U, value);
+      }
+    }
+  }
+  ASSERT_GT(std::filesystem::file_size(path),
+            2U * matrix_common::kMatrixMarketChunkBytes);
+
+  const auto result{readMatrixMarket<double>(path)};
+  EXPECT_EQ(result.bytes, std::filesystem::file_size(path));
+  EXPECT_GT(result.megabytesPerSecond(), 0.0);
+  expectSameRows(result.matrix, expected);
+
+  // the values are placed the same whatever the executor is
+  common::ThreadPool pool{4U};
+  const auto text{matrix_common::readWholeFile(path)};
+  expectSameRows(parseMatrixMarket<double>(text, pool).matrix, expected);
+
+  std::filesystem::remove(path);
+}
+
+TEST(TestingMatrixMarket, ReadingLargeSymmetricArrayFilesInChunks) {
+  // enough values to span several chunks, each of them starting part way
+  // through a column that begins at or below the diagonal
+  constexpr std::size_t kSize{1200U};
+  for (const auto& [symmetry, below] :
+       {std::pair{"symmetric", 0U}, std::pair{"skew-symmetric", 1U}}) {
+    const auto path{std::filesystem::temp_directory_path() /
+                    std::format("ReadingLarge{}ArrayFilesInChunks.mtx",
+                                symmetry)};
+
+    DynamicMatrix<double> expected(kSize, kSize);
+    {
+      std::ofstream file{path};
+      file << std::format("%%MatrixMarket matrix array real {}\n", symmetry)
+           << std::format("{} {}\n", kSize, kSize);
+      for (std::size_t j{0U}; j < kSize; ++j) {
+        for (auto i{j + below}; i < kSize; ++i) {
+          const auto value{static_cast<double>((i * 3U) + j + 1U) / 8.0};
+          expected.rowData(i)[j] = value;
+          expected.rowData(j)[i] = below == 0U ? value : -value;
+          file << std::format("{}\n", value);
+        }
+      }
+    }
+    ASSERT_GT(std::filesystem::file_size(path),
+              2U * matrix_common::kMatrixMarketChunkBytes);
+
+    const auto result{readMatrixMarket<double>(path)};
+    EXPECT_EQ(result.header.entries,
+              ((kSize - below) * (kSize - below + 1U)) / 2U);
+    expectSameRows(result.matrix, expected);
+
+    common::ThreadPool pool{4U};
+    const auto text{matrix_common::readWholeFile(path)};
+    expectSameRows(parseMatrixMarket<double>(text, pool).matrix, expected);
+
+    std::filesystem::remove(path);
+  }
+}
+
+TEST(TestingMatrixMarket, RejectingInvalidFiles) {
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarkt matrix array real "
+                                          "general\n1 1\n1\n")),
+               std::runtime_error);
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix coordinate "
+                                          "complex general\n1 1 1\n1 1 1 0\n")),
+               std::runtime_error);
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix array "
+                                          "pattern general\n1 1\n")),
+               std::runtime_error);
+
+  // entries must be as many as the header tells, and in the matrix
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix coordinate "
+                                          "real general\n2 2 2\n1 1 1\n")),
+               std::runtime_error);
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix coordinate "
+                                          "real general\n2 2 1\n3 1 1\n")),
+               std::runtime_error);
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix coordinate "
+                                          "real symmetric\n2 2 1\n1 2 1\n")),
+               std::runtime_error);
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix array "
+                                          "real general\n1 2\n1 2 3\n")),
+               std::runtime_error);
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix array "
+                                          "real skew-symmetric\n3 3\n1 2 3 "
+                                          "4\n")),
+               std::runtime_error);
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix coordinate "
+                                          "real general\n2 2 1\n1 1 one\n")),
+               std::runtime_error);
+
+  // sizes whose product wraps, to zero or otherwise, are rejected before
+  // the matrix is allocated
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix coordinate "
+                                          "real general\n4294967296 "
+                                          "4294967296 1\n1 1 1.0\n")),
+               std::runtime_error);
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix array real "
+                                          "symmetric\n4294967297 "
+                                          "4294967297\n1\n")),
+               std::runtime_error);
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix coordinate "
+                                          "real general\n1 1 2\n1 1 1\n"
+                                          "1 1 2\n")),
+               std::runtime_error);
+
+  // elements are listed once, and never on the diagonal of skew-symmetric
+  // matrices
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix coordinate "
+                                          "real general\n2 2 2\n1 2 1\n"
+                                          "1 2 2\n")),
+               std::runtime_error);
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix coordinate "
+                                          "real general\n9 9 3\n9 8 1\n"
+                                          "9 9 2\n9 9 3\n")),
+               std::runtime_error);
+  EXPECT_THROW((parseMatrixMarket<double>("%%MatrixMarket matrix coordinate "
+                                          "real skew-symmetric\n2 2 1\n"
+                                          "2 2 1\n")),
+               std::runtime_error);
+
+  EXPECT_THROW((void)readMatrixMarket<double>(
+                   std::filesystem::temp_directory_path() / "missing.mtx"),
+               std::system_error);
+}
+
+}  // namespace data_structures_test::matrixAdt_test
@@ -0,0 +1,128 @@
+#include "data-structures/matrix-types/MatrixPower.hpp"
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+#include "data-structures/MatrixAdt.hpp"
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/UpperTriangularMatrix.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+TEST(TestingPower, NormalMatricesPower) {
+  // powers of the Fibonacci matrix hold consecutive Fibonacci numbers
+  const NormalMatrix<2U, 2U> fibonacci{{1U, 1U}, {1U, 0U}};
+
+  EXPECT_STREQ(pow(fibonacci, 0U).display().c_str(), "|1 0|\n|0 1|");
+  EXPECT_STREQ(pow(fibonacci, 1U).display().c_str(), "|1 1|\n|1 0|");
+  EXPECT_STREQ(pow(fibonacci, 10U).display().c_str(), "|89 55|\n|55 34|");
+  EXPECT_STREQ(pow(fibonacci, 90U).display().c_str(),
+               "|4660046610375530309 2880067194370816120|\n"
+               "|2880067194370816120 1779979416004714189|");
+
+  const NormalMatrix<3U, 3U, double> matrix{
+      {0.5, 0.25, 0.0}, {1.0, 0.0, 0.5}, {0.0, 0.5, 0.25}};
+  auto expected{matrix};
+  for (std::size_t k{2U}; k <= 7U; ++k) {
+    expected = expected * matrix;
+    EXPECT_STREQ(pow(matrix, k).display().c_str(),
+                 expected.display().c_str());
+  }
+}
+
+TEST(TestingPower, DiagonalMatricesPower) {
+  EXPECT_STREQ(pow(DiagonalMatrix<3U>{2U, 3U, 1U}, 20U).display().c_str(),
+               (DiagonalMatrix<3U>{1048576U, 3486784401U, 1U})
+                   .display()
+                   .c_str());
+  EXPECT_STREQ(pow(DiagonalMatrix<2U>{2U, 3U}, 0U).display().c_str(),
+               (DiagonalMatrix<2U>{1U, 1U}).display().c_str());
+
+  // element-wise, so huge exponents cost a few dozens of products only
+  EXPECT_STREQ(
+      pow(DiagonalMatrix<2U, double>{1.0, -1.0}, 1000001U).display().c_str(),
+      (DiagonalMatrix<2U, double>{1.0, -1.0}).display().c_str());
+}
+
+TEST(TestingPower, TriangularMatricesPower) {
+  const LowerTriangularMatrix<3U> lower{{1U}, {1U, 1U}, {1U, 1U, 1U}};
+  EXPECT_STREQ(pow(lower, 5U).display().c_str(),
+               (lower * lower * lower * lower * lower).display().c_str());
+  EXPECT_STREQ(pow(lower, 0U).display().c_str(),
+               (LowerTriangularMatrix<3U>{{1U}, {0U, 1U}, {0U, 0U, 1U}})
+                   .display()
+                   .c_str());
+
+  const UpperTriangularMatrix<3U> upper{
+      {2U, 1U, 1U}, {0U, 1U, 3U}, {0U, 0U, 2U}};
+  EXPECT_STREQ(pow(upper, 6U).display().c_str(),
+               (upper * upper * upper * upper * upper * upper)
+                   .display()
+                   .c_str());
+}
+
+TEST(TestingPower, DynamicMatricesPower) {
+  const DynamicMatrix<> matrix{{1U, 2U, 0U}, {0U, 1U, 3U}, {4U, 0U, 1U}};
+  auto expected{matrix};
+  for (std::size_t k{2U}; k <= 9U; ++k) {
+    expected = expected * matrix;
+    EXPECT_STREQ(pow(matrix, k).display().c_str(),
+                 expected.display().c_str());
+  }
+
+  EXPECT_STREQ(pow(matrix, 0U).display().c_str(),
+               "|1 0 0|\n|0 1 0|\n|0 0 1|");
+  EXPECT_THROW(
+      { (void)pow(DynamicMatrix<>{{1U, 2U, 3U}, {4U, 5U, 6U}}, 2U); },
+      std::invalid_argument);
+}
+
+TEST(TestingPower, LargeMatricesPowerByStrassenWinograd) {
+  constexpr auto kSize{40U};
+
+  std::array<std::array<std::size_t, kSize>, kSize> elements{};
+  DynamicMatrix<> dynamicMatrix(kSize, kSize);
+  for (std::size_t i{0U}; i < kSize; ++i) {
+    for (std::size_t j{0U}; j < kSize; ++j) {
+      elements[i][j] = (i * 7U + j * 3U) % 11U;
+      dynamicMatrix.rowData(i)[j] = elements[i][j];
+    }
+  }
+
+  const NormalMatrix<kSize, kSize> matrix{elements};
+  auto expected{matrix};
+  for (std::size_t k{2U}; k <= 11U; ++k) {
+    expected = expected * matrix;
+  }
+
+  // products of the squaring recurse once, unsigned ones wrap around exactly
+  auto& threshold{matrix_common::strassenThreshold()};
+  const auto previousThreshold{threshold.exchange(16U)};
+
+  EXPECT_STREQ(pow(matrix, 11U).display().c_str(),
+               expected.display().c_str());
+  EXPECT_STREQ(pow(dynamicMatrix, 11U).display().c_str(),
+               expected.display().c_str());
+
+  threshold.store(previousThreshold);
+}
+
+TEST(TestingMatrixAdt, MatrixAdtsPower) {
+  using ::data_structures::MatrixAdt;
+
+  const MatrixAdt<NormalMatrix<2U, 2U>> fibonacci{{1U, 1U}, {1U, 0U}};
+  EXPECT_STREQ(pow(fibonacci, 10U).display().c_str(), "|89 55|\n|55 34|");
+
+  const MatrixAdt<DiagonalMatrix<2U>> diagonal{2U, 5U};
+  EXPECT_STREQ(pow(diagonal, 3U).display().c_str(),
+               (DiagonalMatrix<2U>{8U, 125U}).display().c_str());
+}
+
+}  // namespace data_structures_test::matrixAdt_test
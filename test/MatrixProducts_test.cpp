@@ -0,0 +1,233 @@
+#include "data-structures/matrix-types/MatrixProducts.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
+#include "data-structures/matrix-types/SymmetricMatrix.hpp"
+#include "data-structures/matrix-types/UpperTriangularMatrix.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+TEST(TestingMatrixProducts, KroneckerOfDenseMatrices) {
+  const NormalMatrix<2U, 3U, int> first{{1, 2, 3}, {4, 5, 6}};
+  const NormalMatrix<2U, 2U, int> second{{0, 1}, {-1, 2}};
+
+  const auto product{kronecker(first, second)};
+  EXPECT_TRUE(
+      (std::is_same_v<decltype(product), const NormalMatrix<4U, 6U, int>>));
+  for (std::size_t i{0U}; i < 2U; ++i) {
+    for (std::size_t j{0U}; j < 3U; ++j) {
+      for (std::size_t k{0U}; k < 2U; ++k) {
+        for (std::size_t l{0U}; l < 2U; ++l) {
+          EXPECT_EQ(product.rowData((i * 2U) + k)[(j * 2U) + l],
+                    first.rowData(i)[j] * second.rowData(k)[l]);
+        }
+      }
+    }
+  }
+
+  // operands known at runtime give a DynamicMatrix of the same elements
+  const DynamicMatrix<int> dynamicFirst{{1, 2, 3}, {4, 5, 6}};
+  const auto dynamicProduct{kronecker(dynamicFirst, second)};
+  EXPECT_EQ(dynamicProduct.dimensions().kRows, 4U);
+  EXPECT_EQ(dynamicProduct.dimensions().kColumns, 6U);
+  for (std::size_t i{0U}; i < 4U; ++i) {
+    EXPECT_TRUE(dynamicProduct.rowView(i) == product.rowView(i));
+  }
+
+  // rows not contiguous in storage are read too
+  const SymmetricMatrix<2U, int> symmetric{{1}, {2, 3}};
+  const NormalMatrix<2U, 2U, int> dense{{1, 2}, {2, 3}};
+  EXPECT_EQ(kronecker(symmetric, symmetric).display(),
+            kronecker(dense, dense).display());
+}
+
+TEST(TestingMatrixProducts, KroneckerOfWideMatrices) {
+  // rows of the second operand long enough to be scaled block by block
+  constexpr std::size_t kSize{70U};
+  const LowerTriangularMatrix<2U, int> first{{2}, {-1, 3}};
+  LowerTriangularMatrix<kSize, int> second;
+  for (std::size_t i{0U}; i < kSize; ++i) {
+    for (std::size_t j{0U}; j <= i; ++j) {
+      second.rowData(i)[j] = static_cast<int>((i * j) % 11U) - 5;
+    }
+  }
+
+  const auto product{kronecker(first, second)};
+  EXPECT_TRUE((std::is_same_v<decltype(product),
+                              const LowerTriangularMatrix<2U * kSize, int>>));
+  for (std::size_t i{0U}; i < 2U; ++i) {
+    for (std::size_t j{0U}; j < 2U; ++j) {
+      for (std::size_t k{0U}; k < kSize; ++k) {
+        for (std::size_t l{0U}; l < kSize; ++l) {
+          EXPECT_EQ(product.rowView((i * kSize) + k)[(j * kSize) + l],
+                    first.rowView(i)[j] * second.rowView(k)[l]);
+        }
+      }
+    }
+  }
+}
+
+TEST(TestingMatrixProducts, KroneckerKeepingStructure) {
+  const auto diagonal{kronecker(DiagonalMatrix<2U, int>{2, 3},
+                                DiagonalMatrix<3U, int>{1, -1, 4})};
+  EXPECT_TRUE(
+      (std::is_same_v<decltype(diagonal), const DiagonalMatrix<6U, int>>));
+  EXPECT_EQ(diagonal.display(),
+            (DiagonalMatrix<6U, int>{2, -2, 8, 3, -3, 12}.display()));
+
+  const auto lower{kronecker(LowerTriangularMatrix<2U, int>{{1}, {2, 3}},
+                             DiagonalMatrix<2U, int>{4, 5})};
+  EXPECT_TRUE(
+      (std::is_same_v<decltype(lower), const LowerTriangularMatrix<4U, int>>));
+  EXPECT_EQ(lower.display(),
+            (LowerTriangularMatrix<4U, int>{
+                 {4}, {0, 5}, {8, 0, 12}, {0, 10, 0, 15}}
+                 .display()));
+
+  const UpperTriangularMatrix<2U, int> upperFirst{{1, 2}, {3}};
+  const UpperTriangularMatrix<2U, int> upperSecond{{1, 1}, {2}};
+  const auto upper{kronecker(upperFirst, upperSecond)};
+  EXPECT_TRUE(
+      (std::is_same_v<decltype(upper), const UpperTriangularMatrix<4U, int>>));
+  EXPECT_EQ(upper.display(),
+            (UpperTriangularMatrix<4U, int>{
+                 {1, 1, 2, 2}, {2, 0, 4}, {3, 3}, {6}}
+                 .display()));
+
+  // triangles of opposite sides fill the whole product
+  const auto mixed{kronecker(LowerTriangularMatrix<2U, int>{{1}, {2, 3}},
+                             upperSecond)};
+  EXPECT_TRUE(
+      (std::is_same_v<decltype(mixed), const NormalMatrix<4U, 4U, int>>));
+  EXPECT_EQ(mixed.display(),
+            (NormalMatrix<4U, 4U, int>{
+                 {1, 1, 0, 0}, {0, 2, 0, 0}, {2, 2, 3, 3}, {0, 4, 0, 6}}
+                 .display()));
+}
+
+TEST(TestingMatrixProducts, HadamardKeepingStructure) {
+  const NormalMatrix<3U, 3U, int> dense{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+  const LowerTriangularMatrix<3U, int> lower{{1}, {2, 3}, {4, 5, 6}};
+  const UpperTriangularMatrix<3U, int> upper{{1, 2, 3}, {4, 5}, {6}};
+
+  EXPECT_EQ(hadamard(dense, dense).display(),
+            (NormalMatrix<3U, 3U, int>{{1, 4, 9}, {16, 25, 36}, {49, 64, 81}}
+                 .display()));
+
+  const auto lowerProduct{hadamard(lower, dense)};
+  EXPECT_TRUE((std::is_same_v<decltype(lowerProduct),
+                              const LowerTriangularMatrix<3U, int>>));
+  EXPECT_EQ(lowerProduct.display(),
+            (LowerTriangularMatrix<3U, int>{{1}, {8, 15}, {28, 40, 54}}
+                 .display()));
+
+  const auto upperProduct{hadamard(dense, upper)};
+  EXPECT_TRUE((std::is_same_v<decltype(upperProduct),
+                              const UpperTriangularMatrix<3U, int>>));
+  EXPECT_EQ(upperProduct.display(),
+            (UpperTriangularMatrix<3U, int>{{1, 4, 9}, {20, 30}, {54}}
+                 .display()));
+
+  const auto diagonalProduct{hadamard(lower, upper)};
+  EXPECT_TRUE((std::is_same_v<decltype(diagonalProduct),
+                              const DiagonalMatrix<3U, int>>));
+  EXPECT_EQ(diagonalProduct.display(),
+            (DiagonalMatrix<3U, int>{1, 12, 36}.display()));
+  EXPECT_EQ(hadamard(dense, DiagonalMatrix<3U, int>{1, 0, -1}).display(),
+            (DiagonalMatrix<3U, int>{1, 0, -9}.display()));
+
+  const SymmetricMatrix<3U, int> symmetric{{1}, {2, 3}, {4, 5, 6}};
+  EXPECT_EQ(hadamard(symmetric, dense).display(),
+            (NormalMatrix<3U, 3U, int>{{1, 4, 12}, {8, 15, 30}, {28, 40, 54}}
+                 .display()));
+
+  EXPECT_THROW((void)hadamard(DynamicMatrix<int>(2U, 3U),
+                              DynamicMatrix<int>(3U, 2U)),
+               std::invalid_argument);
+}
+
+TEST(TestingMatrixProducts, OuterProductsOfVectors) {
+  // five rows, so that both the batches of four rows and the tail are used
+  const std::array<int, 5U> first{1, -2, 3, 0, 5};
+  const std::array<int, 3U> second{2, 7, -1};
+
+  // dimensions are the sizes of both std::array, of type std::size_t
+  const auto product{outer(first, second)};
+  EXPECT_TRUE((std::is_same_v<
+               decltype(product),
+               const NormalMatrix<std::size_t{5U}, std::size_t{3U}, int>>));
+  EXPECT_EQ(product.display(),
+            (NormalMatrix<5U, 3U, int>{{2, 7, -1},
+                                       {-4, -14, 2},
+                                       {6, 21, -3},
+                                       {0, 0, 0},
+                                       {10, 35, -5}}
+                 .display()));
+
+  const std::vector<int> dynamicFirst(first.begin(), first.end());
+  const auto dynamicProduct{outer(dynamicFirst, second)};
+  for (std::size_t i{0U}; i < first.size(); ++i) {
+    EXPECT_TRUE(dynamicProduct.rowView(i) == product.rowView(i));
+  }
+}
+
+TEST(TestingMatrixProducts, ProductsMatchEveryInstructionSet) {
+  using namespace simd_kernels;
+
+  // sizes not multiple of any register, so the tails are exercised too
+  constexpr std::size_t kRows{13U};
+  constexpr std::size_t kColumns{19U};
+  DynamicMatrix<double> first(kRows, kColumns);
+  DynamicMatrix<double> second(kRows, kColumns);
+  for (std::size_t i{0U}; i < kRows; ++i) {
+    for (std::size_t j{0U}; j < kColumns; ++j) {
+      first.rowData(i)[j] = std::sin(static_cast<double>((i * kColumns) + j));
+      second.rowData(i)[j] = std::cos(static_cast<double>(i + (3U * j)));
+    }
+  }
+  const std::vector<double> vector(first.rowData(0U),
+                                   first.rowData(0U) + kColumns);
+
+  const auto run{[&]() {
+    std::vector<double> elements;
+    const auto append{[&elements](const auto& matrix) {
+      for (std::size_t i{0U}; i < matrix.dimensions().kRows; ++i) {
+        const auto* const row{matrix.rowData(i)};
+        elements.insert(elements.end(), row,
+                        row + matrix.dimensions().kColumns);
+      }
+    }};
+
+    append(kronecker(first, second));
+    append(hadamard(first, second));
+    append(outer(vector, vector));
+    return elements;
+  }};
+
+  useInstructionSet(InstructionSet::kScalar);
+  const auto expected{run()};
+
+  for (const auto instructionSet : {InstructionSet::kSse42,
+                                    InstructionSet::kAvx2,
+                                    InstructionSet::kAvx512}) {
+    useInstructionSet(instructionSet);
+    EXPECT_EQ(run(), expected);
+  }
+
+  useInstructionSet(detectInstructionSet());
+}
+
+}  // namespace data_structures_test::matrixAdt_test
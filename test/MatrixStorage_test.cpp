@@ -0,0 +1,96 @@
+#include "data-structures/matrix-types/MatrixStorage.hpp"
+
+#include <cstddef>
+#include <variant>
+
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+TEST(TestingStructure, DetectStructureOfDenseMatrices) {
+  const NormalMatrix<3U, 3U> banded{{1U, 2U}, {3U, 4U, 5U}, {0U, 6U, 7U}};
+  EXPECT_TRUE(banded.isBanded(1U));
+  EXPECT_FALSE(banded.isDiagonal());
+  EXPECT_FALSE(banded.isLowerTriangular());
+  EXPECT_FALSE((NormalMatrix<3U, 3U>{{1U}, {0U}, {8U}}).isBanded(1U));
+  EXPECT_FALSE((NormalMatrix<2U, 3U>{}).isDiagonal());
+
+  static_assert(NormalMatrix<2U, 2U>{{1U}, {2U, 3U}}.isLowerTriangular());
+  static_assert(NormalMatrix<2U, 2U>{{1U}, {0U, 3U}}.isDiagonal());
+
+  // large enough to span several tiles, with a single element off the band
+  DynamicMatrix<double> matrix(70U, 70U);
+  for (std::size_t i{0U}; i < 70U; ++i) {
+    matrix.rowData(i)[i] = 1.0;
+  }
+  EXPECT_TRUE(matrix.isDiagonal());
+  matrix.rowData(69U)[2U] = 2.0;
+  EXPECT_FALSE(matrix.isBanded(66U));
+  EXPECT_TRUE(matrix.isBanded(67U));
+  EXPECT_TRUE(matrix.isLowerTriangular());
+}
+
+TEST(TestingStructure, DetectStructureOfStructuredMatrices) {
+  EXPECT_TRUE((LowerTriangularMatrix<3U>{{1U}, {0U, 2U}, {0U, 0U, 3U}})
+                  .isDiagonal());
+  EXPECT_FALSE(
+      (LowerTriangularMatrix<3U>{{1U}, {0U, 2U}, {4U, 0U, 3U}}).isBanded(1U));
+  EXPECT_TRUE((DiagonalMatrix<2U>{1U, 2U}).isLowerTriangular());
+
+  const CsrMatrix<> csr(3U, 3U, {{0U, 0U, 1U}, {2U, 1U, 2U}});
+  EXPECT_TRUE(csr.isLowerTriangular());
+  EXPECT_TRUE(csr.isBanded(1U));
+  EXPECT_FALSE(csr.isDiagonal());
+  EXPECT_FALSE((CooMatrix<>(3U, 3U, {{0U, 2U, 1U}})).isBanded(1U));
+}
+
+TEST(TestingStructure, PickTheCheapestStorage) {
+  const NormalMatrix<3U, 3U> diagonal{{1U}, {0U, 2U}, {0U, 0U, 3U}};
+  const NormalMatrix<3U, 3U> lower{{1U}, {2U, 3U}, {4U, 5U, 6U}};
+  const NormalMatrix<3U, 3U> dense{{1U, 2U, 3U}, {4U, 5U, 6U}, {7U, 8U, 9U}};
+  const NormalMatrix<3U, 3U> sparse{{0U, 0U, 1U}};
+  const NormalMatrix<3U, 3U> symmetric{
+      {1U, 2U, 3U}, {2U, 4U, 5U}, {3U, 5U, 6U}};
+
+  EXPECT_EQ(cheapestStorage(diagonal), MatrixStorage::kDiagonal);
+  EXPECT_EQ(cheapestStorage(lower), MatrixStorage::kLowerTriangular);
+  EXPECT_EQ(cheapestStorage(dense), MatrixStorage::kDense);
+  EXPECT_EQ(cheapestStorage(sparse), MatrixStorage::kSparse);
+  EXPECT_EQ(cheapestStorage(symmetric), MatrixStorage::kSymmetric);
+  EXPECT_EQ(cheapestStorage(DynamicMatrix<>{lower}),
+            MatrixStorage::kLowerTriangular);
+
+  const auto compact{toCheapestStorage(lower)};
+  ASSERT_TRUE(std::holds_alternative<LowerTriangularMatrix<3U>>(compact));
+  EXPECT_STREQ(std::get<LowerTriangularMatrix<3U>>(compact).display().c_str(),
+               lower.display().c_str());
+  EXPECT_STREQ(std::get<DiagonalMatrix<3U>>(toCheapestStorage(diagonal))
+                   .display()
+                   .c_str(),
+               diagonal.display().c_str());
+  EXPECT_TRUE(std::holds_alternative<CsrMatrix<>>(toCheapestStorage(sparse)));
+  EXPECT_STREQ(std::get<SymmetricMatrix<3U>>(toCheapestStorage(symmetric))
+                   .display()
+                   .c_str(),
+               symmetric.display().c_str());
+
+  // a tridiagonal matrix is stored in 3 N elements rather than N (N + 1) / 2
+  NormalMatrix<8U, 8U, double> tridiagonal{};
+  for (std::size_t i{0U}; i < 8U; ++i) {
+    tridiagonal.rowData(i)[i] = 2.0;
+    if (i > 0U) {
+      tridiagonal.rowData(i)[i - 1U] = 1.0;
+      tridiagonal.rowData(i - 1U)[i] = 3.0;
+    }
+  }
+  EXPECT_EQ(cheapestStorage(tridiagonal), MatrixStorage::kTridiagonal);
+  const auto banded{toCheapestStorage(tridiagonal)};
+  using Tridiagonal = TridiagonalMatrix<8U, double>;
+  ASSERT_TRUE(std::holds_alternative<Tridiagonal>(banded));
+  EXPECT_STREQ(std::get<Tridiagonal>(banded).display().c_str(),
+               tridiagonal.display().c_str());
+}
+
+}  // namespace data_structures_test::matrixAdt_test
@@ -0,0 +1,235 @@
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "common/ThreadPool.hpp"
+#include "data-structures/MatrixAdt.hpp"
+#include "data-structures/matrix-types/BandedMatrix.hpp"
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
+#include "data-structures/matrix-types/MatrixCommon.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
+#include "data-structures/matrix-types/SparseMatrix.hpp"
+#include "data-structures/matrix-types/SymmetricMatrix.hpp"
+#include "data-structures/matrix-types/UpperTriangularMatrix.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+/// @brief helper function to compute y = alpha * A * x + beta * y the naive
+///        way, on the elements of every row, zeros included
+/// @param matrix the matrix A
+/// @param alpha factor of the product
+/// @param vector the vector x
+/// @param beta factor of y
+/// @param result the vector y
+/// @return the expected y
+std::vector<double> naiveGemv(const auto& matrix, double alpha,
+                              const std::vector<double>& vector, double beta,
+                              std::vector<double> result) {
+  std::vector<double> row(matrix_common::numberOfColumns(matrix));
+  for (std::size_t i{0U}; i < result.size(); ++i) {
+    matrix.rowView(i).copyTo(row.begin());
+    double sum{0.0};
+    for (std::size_t j{0U}; j < row.size(); ++j) {
+      sum += row[j] * vector[j];
+    }
+    result[i] = (alpha * sum) + (beta * result[i]);
+  }
+
+  return result;
+}
+
+/// @brief helper function to check the GEMV of a matrix against the naive
+///        one, with small integral values so that both are exact
+/// @param matrix the matrix in question
+void expectGemvMatchesNaive(const auto& matrix) {
+  const auto rows{matrix_common::numberOfRows(matrix)};
+  const auto columns{matrix_common::numberOfColumns(matrix)};
+
+  std::vector<double> vector(columns);
+  for (std::size_t j{0U}; j < columns; ++j) {
+    vector[j] = static_cast<double>(j % 5U) - 2.0;
+  }
+  std::vector<double> result(rows);
+  for (std::size_t i{0U}; i < rows; ++i) {
+    result[i] = static_cast<double>(i % 3U);
+  }
+
+  for (const auto& [alpha, beta] :
+       {std::pair{1.0, 0.0}, std::pair{2.0, 1.0}, std::pair{-0.5, 3.0}}) {
+    auto actual{result};
+    matrix.multiplyVector(alpha, vector, beta, std::span{actual});
+    EXPECT_EQ(actual, naiveGemv(matrix, alpha, vector, beta, result));
+  }
+}
+
+TEST(TestingMatrixVector, MultiplyingEveryMatrixType) {
+  constexpr std::size_t kSize{37U};
+  NormalMatrix<kSize, kSize, double> dense;
+  DynamicMatrix<double> dynamic(kSize, kSize);
+  for (std::size_t i{0U}; i < kSize; ++i) {
+    for (std::size_t j{0U}; j < kSize; ++j) {
+      // symmetric, with zeros for the sparse matrices
+      const auto value{(i + j) % 4U == 0U
+                           ? 0.0
+                           : static_cast<double>(((i * j) + i + j) % 7U)};
+      dense.rowData(i)[j] = value;
+      dynamic.rowData(i)[j] = value;
+    }
+  }
+
+  expectGemvMatchesNaive(dense);
+  expectGemvMatchesNaive(dynamic);
+  expectGemvMatchesNaive(LowerTriangularMatrix<kSize, double>{dense});
+  expectGemvMatchesNaive(UpperTriangularMatrix<kSize, double>{dense});
+  expectGemvMatchesNaive(BandedMatrix<kSize, 3U, 5U, double>{dense});
+  expectGemvMatchesNaive(DiagonalMatrix<kSize, double>{dense});
+  expectGemvMatchesNaive(SymmetricMatrix<kSize, double>{dense});
+  expectGemvMatchesNaive(CooMatrix<double>{dynamic});
+  expectGemvMatchesNaive(CsrMatrix<double>{dynamic});
+  expectGemvMatchesNaive(CscMatrix<double>{dynamic});
+
+  // rectangular matrices
+  DynamicMatrix<double> wide(3U, 41U);
+  for (std::size_t i{0U}; i < 3U; ++i) {
+    for (std::size_t j{0U}; j < 41U; ++j) {
+      wide.rowData(i)[j] = static_cast<double>((i + j) % 6U);
+    }
+  }
+  expectGemvMatchesNaive(wide);
+  expectGemvMatchesNaive(CsrMatrix<double>{wide});
+}
+
+TEST(TestingMatrixVector, IgnoringTheResultWhenBetaIsZero) {
+  const NormalMatrix<2U, 3U, double> matrix{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+  const std::vector<double> vector{1.0, 1.0, 2.0};
+  const auto nan{std::numeric_limits<double>::quiet_NaN()};
+
+  std::vector<double> result{nan, nan};
+  matrix.multiplyVector(2.0, vector, 0.0, std::span{result});
+  EXPECT_EQ(result, (std::vector<double>{18.0, 42.0}));
+
+  const SymmetricMatrix<2U, double> symmetric{{1.0}, {2.0, 3.0}};
+  std::vector<double> symmetricResult{nan, nan};
+  symmetric.multiplyVector(1.0, std::span{vector}.first(2U), 0.0,
+                           std::span{symmetricResult});
+  EXPECT_EQ(symmetricResult, (std::vector<double>{3.0, 5.0}));
+
+  // a non-zero beta still reads it
+  result[0] = nan;
+  matrix.multiplyVector(1.0, vector, 1.0, std::span{result});
+  EXPECT_TRUE(std::isnan(result[0]));
+  EXPECT_EQ(result[1], 63.0);
+}
+
+TEST(TestingMatrixVector, RejectingVectorsOfOtherLengths) {
+  const NormalMatrix<2U, 3U, double> matrix{};
+  std::vector<double> result(2U);
+  EXPECT_THROW(matrix.multiplyVector(1.0, std::vector<double>(2U), 0.0,
+                                     std::span{result}),
+               std::invalid_argument);
+  EXPECT_THROW(matrix.multiplyVector(1.0, std::vector<double>(3U), 0.0,
+                                     std::span{result}.first(1U)),
+               std::invalid_argument);
+
+  const CscMatrix<double> sparse(2U, 3U, {});
+  EXPECT_THROW(sparse.multiplyVector(1.0, std::vector<double>(4U), 0.0,
+                                     std::span{result}),
+               std::invalid_argument);
+
+  std::vector<double> longer(3U);
+  EXPECT_THROW(axpy(1.0, std::vector<double>(2U), longer),
+               std::invalid_argument);
+}
+
+TEST(TestingMatrixVector, AccumulatingScaledVectors) {
+  const std::vector<double> vector{1.0, -2.0, 3.0, 0.5, 8.0};
+  std::vector<double> result{1.0, 1.0, 1.0, 1.0, 1.0};
+  axpy(2.0, vector, result);
+  EXPECT_EQ(result, (std::vector<double>{3.0, -3.0, 7.0, 2.0, 17.0}));
+
+  std::vector<float> floats(100U, 1.0F);
+  axpy(0.5F, std::vector<float>(100U, 4.0F), std::span{floats});
+  EXPECT_EQ(floats, std::vector<float>(100U, 3.0F));
+}
+
+TEST(TestingMatrixVector, DotProductsMatchEveryInstructionSet) {
+  using namespace simd_kernels;
+
+  // not a multiple of any register, so the tails are exercised too
+  constexpr std::size_t kCount{1003U};
+  std::vector<double> first(kCount);
+  std::vector<double> second(kCount);
+  std::vector<float> firstFloats(kCount);
+  std::vector<float> secondFloats(kCount);
+  for (std::size_t i{0U}; i < kCount; ++i) {
+    first[i] = 1.0 / static_cast<double>(i + 1U);
+    second[i] = std::sin(static_cast<double>(i));
+    firstFloats[i] = static_cast<float>(first[i]);
+    secondFloats[i] = static_cast<float>(second[i]);
+  }
+
+  useInstructionSet(InstructionSet::kScalar);
+  const auto expected{dot(first.data(), second.data(), kCount)};
+  const auto expectedFloats{
+      dot(firstFloats.data(), secondFloats.data(), kCount)};
+
+  for (const auto instructionSet : {InstructionSet::kSse42,
+                                    InstructionSet::kAvx2,
+                                    InstructionSet::kAvx512}) {
+    useInstructionSet(instructionSet);
+    EXPECT_EQ(dot(first.data(), second.data(), kCount), expected);
+    EXPECT_EQ(dot(firstFloats.data(), secondFloats.data(), kCount),
+              expectedFloats);
+  }
+
+  useInstructionSet(detectInstructionSet());
+}
+
+TEST(TestingMatrixVector, MultiplyingOnExecutors) {
+  constexpr std::size_t kRows{1000U};
+  constexpr std::size_t kColumns{300U};
+  DynamicMatrix<double> matrix(kRows, kColumns);
+  for (std::size_t i{0U}; i < kRows; ++i) {
+    for (std::size_t j{0U}; j < kColumns; ++j) {
+      matrix.rowData(i)[j] = static_cast<double>((i * 7U + j) % 11U);
+    }
+  }
+  const CsrMatrix<double> sparse{matrix};
+  const std::vector<double> vector(kColumns, 0.25);
+
+  std::vector<double> serial(kRows, 1.0);
+  common::SerialExecutor serialExecutor;
+  matrix.multiplyVector(3.0, vector, 2.0, std::span{serial}, serialExecutor);
+
+  // the rows are blocked the same whatever the executor is
+  common::ThreadPool pool{4U};
+  std::vector<double> parallel(kRows, 1.0);
+  matrix.multiplyVector(3.0, vector, 2.0, std::span{parallel}, pool);
+  EXPECT_EQ(parallel, serial);
+
+  std::vector<double> sparseResult(kRows, 1.0);
+  sparse.multiplyVector(3.0, vector, 2.0, std::span{sparseResult}, pool);
+  EXPECT_EQ(sparseResult, serial);
+
+  // crossing the threshold runs over the shared pool
+  std::vector<double> shared(kRows, 1.0);
+  matrix.multiplyVector(3.0, vector, 2.0, std::span{shared});
+  EXPECT_EQ(shared, serial);
+
+  const ::data_structures::MatrixAdt<DynamicMatrix<double>> adt{matrix};
+  std::vector<double> adtResult(kRows, 1.0);
+  adt.multiplyVector(3.0, vector, 2.0, std::span{adtResult}, pool);
+  EXPECT_EQ(adtResult, serial);
+}
+
+}  // namespace data_structures_test::matrixAdt_test
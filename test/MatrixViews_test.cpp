@@ -0,0 +1,95 @@
+#include "data-structures/matrix-types/MatrixViews.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "data-structures/MatrixAdt.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+/// @brief type alias for the elements copied out of a view
+using Elements = std::vector<std::size_t>;
+
+/// @brief helper function to copy all the elements of a view
+/// @param view the view to be copied
+/// @return vector holding the elements of the view
+auto toVector(const auto& view) {
+  return std::vector(view.begin(), view.end());
+}
+
+TEST(TestingViews, ViewingNormalMatrices) {
+  const NormalMatrix<2U, 3U> matrix{{1U, 2U, 3U}, {4U, 5U, 6U}};
+
+  EXPECT_EQ(toVector(matrix.rowView(0U)), (Elements{1U, 2U, 3U}));
+  EXPECT_EQ(toVector(matrix.rowView(1U)), (Elements{4U, 5U, 6U}));
+  EXPECT_EQ(toVector(matrix.columnView(0U)), (Elements{1U, 4U}));
+  EXPECT_EQ(toVector(matrix.columnView(2U)), (Elements{3U, 6U}));
+
+  // views read the elements of the matrix, no copy is made
+  EXPECT_EQ(matrix.rowView(1U).data(), matrix.rowData(1U));
+  EXPECT_EQ(matrix.columnView(2U).data(), matrix.rowData(0U) + 2U);
+
+  // iterators yield views
+  std::vector<Elements> columns;
+  for (const auto& column : matrix.columns()) {
+    columns.push_back(toVector(column));
+  }
+  EXPECT_EQ(columns, (std::vector<Elements>{{1U, 4U}, {2U, 5U}, {3U, 6U}}));
+}
+
+TEST(TestingViews, ViewingLowerTriangularMatrices) {
+  const LowerTriangularMatrix<3U> matrix{{1U}, {2U, 3U}, {4U, 5U, 6U}};
+
+  EXPECT_EQ(toVector(matrix.rowView(0U)), (Elements{1U, 0U, 0U}));
+  EXPECT_EQ(toVector(matrix.rowView(1U)), (Elements{2U, 3U, 0U}));
+  EXPECT_EQ(toVector(matrix.rowView(2U)), (Elements{4U, 5U, 6U}));
+  EXPECT_EQ(toVector(matrix.columnView(0U)), (Elements{1U, 2U, 4U}));
+  EXPECT_EQ(toVector(matrix.columnView(1U)), (Elements{0U, 3U, 5U}));
+  EXPECT_EQ(toVector(matrix.columnView(2U)), (Elements{0U, 0U, 6U}));
+
+  // copying a range walks the stored elements, and fills zeros around them
+  std::array<std::size_t, 2U> range{7U, 7U};
+  matrix.columnView(1U).copyTo(0U, 2U, range.begin());
+  EXPECT_EQ(range, (std::array<std::size_t, 2U>{0U, 3U}));
+  matrix.rowView(1U).copyTo(1U, 3U, range.begin());
+  EXPECT_EQ(range, (std::array<std::size_t, 2U>{3U, 0U}));
+}
+
+TEST(TestingViews, ViewingDiagonalMatrices) {
+  const DiagonalMatrix<3U> matrix{1U, 2U, 3U};
+
+  EXPECT_EQ(toVector(matrix.rowView(1U)), (Elements{0U, 2U, 0U}));
+  EXPECT_EQ(toVector(matrix.columnView(2U)), (Elements{0U, 0U, 3U}));
+  EXPECT_EQ(matrix.rowView(0U)[0U], 1U);
+  EXPECT_EQ(matrix.rowView(0U)[1U], 0U);
+}
+
+TEST(TestingViews, ViewingDynamicMatrices) {
+  const DynamicMatrix<> matrix{{1U, 2U}, {3U, 4U}, {5U, 6U}};
+
+  EXPECT_EQ(toVector(matrix.rowView(2U)), (Elements{5U, 6U}));
+  EXPECT_EQ(toVector(matrix.columnView(1U)), (Elements{2U, 4U, 6U}));
+
+  std::size_t numberOfRows{0U};
+  for (const auto& row : matrix.rows()) {
+    EXPECT_EQ(row.data(), matrix.rowData(numberOfRows++));
+  }
+  EXPECT_EQ(numberOfRows, 3U);
+}
+
+TEST(TestingViews, ComparingViews) {
+  const NormalMatrix<2U, 2U> normal{{1U, 0U}, {2U, 3U}};
+  const LowerTriangularMatrix<2U> lower{{1U}, {2U, 3U}};
+
+  // views of different layouts are compared element by element
+  EXPECT_EQ(normal.rowView(0U), lower.rowView(0U));
+  EXPECT_EQ(normal.columnView(1U), lower.columnView(1U));
+  EXPECT_NE(normal.rowView(0U), lower.rowView(1U));
+  EXPECT_NE(normal.rowView(0U), normal.columnView(0U));
+}
+
+}  // namespace data_structures_test::matrixAdt_test
@@ -0,0 +1,166 @@
+#include "data-structures/matrix-types/MixedPrecision.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DynamicMatrix.hpp"
+#include "data-structures/matrix-types/HalfPrecision.hpp"
+#include "data-structures/matrix-types/NormalMatrix.hpp"
+#include "data-structures/matrix-types/SimdKernels.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+TEST(TestingMixedPrecision, RoundingToFloat16) {
+  EXPECT_EQ(Float16{1.0F}.bits(), 0x3C00U);
+  EXPECT_EQ(Float16{-2.0F}.bits(), 0xC000U);
+  EXPECT_EQ(Float16{65504.0F}.bits(), 0x7BFFU);
+  EXPECT_EQ(Float16{65520.0F}.bits(), 0x7C00U);
+  EXPECT_EQ(Float16{0x1p-24F}.bits(), 0x0001U);
+  EXPECT_EQ(Float16{0x1p-25F}.bits(), 0x0000U);
+  EXPECT_EQ(Float16{0x1.8p-25F}.bits(), 0x0001U);
+
+  // ties are rounded to even
+  EXPECT_EQ(Float16{1.0F + 0x1p-11F}.bits(), 0x3C00U);
+  EXPECT_EQ(Float16{1.0F + 0x3p-11F}.bits(), 0x3C02U);
+  EXPECT_TRUE(std::isnan(
+      static_cast<float>(Float16{std::numeric_limits<float>::quiet_NaN()})));
+
+  // every half-precision number but NaNs is a float, and back
+  for (std::uint32_t bits{0U}; bits <= 0xFFFFU; ++bits) {
+    const auto half{Float16::fromBits(static_cast<std::uint16_t>(bits))};
+    if (!std::isnan(static_cast<float>(half))) {
+      EXPECT_EQ(Float16{static_cast<float>(half)}.bits(), bits);
+    }
+  }
+}
+
+TEST(TestingMixedPrecision, RoundingToBFloat16) {
+  EXPECT_EQ(BFloat16{1.0F}.bits(), 0x3F80U);
+  EXPECT_EQ(BFloat16{-3.0F}.bits(), 0xC040U);
+  EXPECT_EQ(static_cast<float>(BFloat16{1.0F + 0x1p-7F}), 1.0F + 0x1p-7F);
+
+  // ties are rounded to even
+  EXPECT_EQ(BFloat16{1.0F + 0x1p-8F}.bits(), 0x3F80U);
+  EXPECT_EQ(BFloat16{1.0F + 0x3p-8F}.bits(), 0x3F82U);
+  EXPECT_EQ(BFloat16{std::numeric_limits<float>::max()}.bits(), 0x7F80U);
+
+  // NaNs whose payload is in the truncated bits stay NaNs
+  EXPECT_TRUE(std::isnan(
+      static_cast<float>(BFloat16{std::bit_cast<float>(0x7F80'0001U)})));
+}
+
+TEST(TestingMixedPrecision, ConversionsMatchEveryInstructionSet) {
+  using namespace simd_kernels;
+
+  // not a multiple of any register, so the tails are exercised too
+  constexpr std::size_t kCount{1003U};
+  std::vector<float> floats(kCount);
+  for (std::size_t i{0U}; i < kCount; ++i) {
+    floats[i] = std::ldexp(std::sin(static_cast<float>(i)),
+                           static_cast<int>(i % 60U) - 30);
+  }
+  floats[3] = std::numeric_limits<float>::infinity();
+  floats[5] = -0.0F;
+
+  const auto run{[&floats]() {
+    std::vector<Float16> halves(kCount);
+    std::vector<BFloat16> bfloats(kCount);
+    convert(floats.data(), halves.data(), kCount);
+    convert(floats.data(), bfloats.data(), kCount);
+
+    std::vector<float> widened(2U * kCount);
+    convert(halves.data(), widened.data(), kCount);
+    convert(bfloats.data(), widened.data() + kCount, kCount);
+
+    std::vector<std::uint32_t> bits;
+    for (std::size_t i{0U}; i < kCount; ++i) {
+      bits.push_back(halves[i].bits());
+      bits.push_back(bfloats[i].bits());
+    }
+    for (const auto value : widened) {
+      bits.push_back(std::bit_cast<std::uint32_t>(value));
+    }
+    return bits;
+  }};
+
+  useInstructionSet(InstructionSet::kScalar);
+  const auto expected{run()};
+
+  for (const auto instructionSet : {InstructionSet::kSse42,
+                                    InstructionSet::kAvx2,
+                                    InstructionSet::kAvx512}) {
+    useInstructionSet(instructionSet);
+    EXPECT_EQ(run(), expected);
+  }
+
+  useInstructionSet(detectInstructionSet());
+}
+
+TEST(TestingMixedPrecision, MultiplyingHalfPrecisionMatrices) {
+  // integral elements, so that every product is exact
+  constexpr std::size_t kSize{21U};
+  NormalMatrix<kSize, kSize, float> first;
+  NormalMatrix<kSize, kSize, float> second;
+  for (std::size_t i{0U}; i < kSize; ++i) {
+    for (std::size_t j{0U}; j < kSize; ++j) {
+      first.rowData(i)[j] = static_cast<float>((i + (2U * j)) % 7U) - 3.0F;
+      second.rowData(i)[j] = static_cast<float>((i * j) % 5U);
+    }
+  }
+  const auto expected{first * second};
+
+  const auto halfFirst{convertMatrix<Float16>(first)};
+  const auto bfloatSecond{convertMatrix<BFloat16>(second)};
+  EXPECT_TRUE((std::is_same_v<decltype(halfFirst),
+                              const NormalMatrix<kSize, kSize, Float16>>));
+  EXPECT_EQ(halfFirst.display(), first.display());
+
+  const auto product{multiplyMixed<float>(halfFirst, bfloatSecond)};
+  EXPECT_TRUE((std::is_same_v<decltype(product),
+                              const NormalMatrix<kSize, kSize, float>>));
+  EXPECT_EQ(product.display(), expected.display());
+
+  // operands of different types, the product stored in half-precision
+  const auto halfProduct{multiplyMixed<float, Float16>(halfFirst, second)};
+  EXPECT_TRUE((std::is_same_v<decltype(halfProduct),
+                              const NormalMatrix<kSize, kSize, Float16>>));
+  EXPECT_EQ(halfProduct.display(), expected.display());
+}
+
+TEST(TestingMixedPrecision, MultiplyingOnExecutors) {
+  constexpr std::size_t kRows{150U};
+  constexpr std::size_t kColumns{90U};
+  DynamicMatrix<float> first(kRows, kColumns);
+  DynamicMatrix<float> second(kColumns, kRows);
+  for (std::size_t i{0U}; i < kRows; ++i) {
+    for (std::size_t j{0U}; j < kColumns; ++j) {
+      first.rowData(i)[j] = static_cast<float>((i + j) % 9U) * 0.25F;
+      second.rowData(j)[i] = static_cast<float>((i * 3U + j) % 4U) - 1.5F;
+    }
+  }
+  const auto expected{first * second};
+
+  common::ThreadPool pool{4U};
+  const auto product{multiplyMixed<float>(convertMatrix<BFloat16>(first),
+                                          convertMatrix<Float16>(second),
+                                          pool)};
+  for (std::size_t i{0U}; i < kRows; ++i) {
+    EXPECT_TRUE(product.rowView(i) == expected.rowView(i));
+  }
+
+  EXPECT_THROW((void)multiplyMixed<float>(convertMatrix<Float16>(first),
+                                          convertMatrix<Float16>(first)),
+               std::invalid_argument);
+}
+
+}  // namespace data_structures_test::matrixAdt_test
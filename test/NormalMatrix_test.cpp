@@ -1,5 +1,10 @@
 #include "data-structures/matrix-types/NormalMatrix.hpp"
 
+#include <stdexcept>
+
+#include "AllocationCounter.hpp"
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "data-structures/matrix-types/LowerTriangularMatrix.hpp"
 #include "gtest/gtest.h"
 
 /// @brief namespace for matrixAdt_test tests
@@ -299,6 +304,271 @@ TEST(TestingMultiplication, NormalMatricesMultiplication) {
   }
 }
 
+TEST(TestingMultiplication, NormalMatricesMultiplicationAcrossBlocks) {
+  // sizes are chosen not to be multiples of the kernel tiles, so that the
+  // remainders of rows, inner and columns blocks are exercised as well
+  constexpr auto kRows{70U};
+  constexpr auto kInner{67U};
+  constexpr auto kColumns{130U};
+
+  std::array<std::array<std::size_t, kInner>, kRows> firstElements{};
+  for (std::size_t i{0U}; i < kRows; ++i) {
+    for (std::size_t j{0U}; j < kInner; ++j) {
+      firstElements[i][j] = (i * 7U + j * 3U) % 11U;
+    }
+  }
+
+  std::array<std::array<std::size_t, kColumns>, kInner> secondElements{};
+  for (std::size_t i{0U}; i < kInner; ++i) {
+    for (std::size_t j{0U}; j < kColumns; ++j) {
+      secondElements[i][j] = (i * 5U + j) % 13U;
+    }
+  }
+
+  const auto result{NormalMatrix<kRows, kInner>{firstElements} *
+                    NormalMatrix<kInner, kColumns>{secondElements}};
+
+  for (std::size_t i{0U}; i < kRows; ++i) {
+    const auto resultRow{result.row(i)};
+    for (std::size_t j{0U}; j < kColumns; ++j) {
+      std::size_t expected{0U};
+      for (std::size_t k{0U}; k < kInner; ++k) {
+        expected += firstElements[i][k] * secondElements[k][j];
+      }
+
+      EXPECT_EQ(resultRow[j], expected);
+    }
+  }
+}
+
+TEST(TestingMultiplication, NormalMatricesMultiplicationOfDifferentTypes) {
+  {
+    const auto result{
+        NormalMatrix<2U, 3U, float>{{1.5F, 2.0F, 3.0F}, {4.0F, 5.0F, 6.0F}} *
+        NormalMatrix<3U, 2U, float>{
+            {7.0F, 8.0F}, {9.0F, 10.0F}, {11.0F, 12.0F}}};
+
+    EXPECT_EQ(result.row(0U), (std::array{61.5F, 68.0F}));
+    EXPECT_EQ(result.row(1U), (std::array{139.0F, 154.0F}));
+  }
+
+  {
+    const auto result{
+        NormalMatrix<2U, 2U, double>{{0.5, -1.0}, {2.0, 0.25}} *
+        NormalMatrix<2U, 2U, double>{{4.0, 2.0}, {-8.0, 16.0}}};
+
+    EXPECT_EQ(result.row(0U), (std::array{10.0, -15.0}));
+    EXPECT_EQ(result.row(1U), (std::array{6.0, 8.0}));
+  }
+
+  {
+    const auto result{NormalMatrix<2U, 2U, std::int32_t>{{1, -2}, {-3, 4}} *
+                      NormalMatrix<2U, 2U, std::int32_t>{{-5, 6}, {7, -8}}};
+
+    EXPECT_EQ(result.row(0U), (std::array<std::int32_t, 2U>{-19, 22}));
+    EXPECT_EQ(result.row(1U), (std::array<std::int32_t, 2U>{43, -50}));
+  }
+}
+
+TEST(TestingMultiplication, NormalMatricesParallelMultiplication) {
+  constexpr auto kRows{75U};
+  constexpr auto kInner{40U};
+  constexpr auto kColumns{33U};
+
+  std::array<std::array<std::size_t, kInner>, kRows> firstElements{};
+  for (std::size_t i{0U}; i < kRows; ++i) {
+    for (std::size_t j{0U}; j < kInner; ++j) {
+      firstElements[i][j] = (i + j * 3U) % 17U;
+    }
+  }
+
+  std::array<std::array<std::size_t, kColumns>, kInner> secondElements{};
+  for (std::size_t i{0U}; i < kInner; ++i) {
+    for (std::size_t j{0U}; j < kColumns; ++j) {
+      secondElements[i][j] = (i * 2U + j) % 7U;
+    }
+  }
+
+  const NormalMatrix<kRows, kInner> firstMatrix{firstElements};
+  const NormalMatrix<kInner, kColumns> secondMatrix{secondElements};
+
+  common::SerialExecutor serial;
+  const auto expected{firstMatrix.multiply(secondMatrix, serial)};
+
+  // several products sharing a single pool
+  common::ThreadPool pool{4U};
+  EXPECT_STREQ(firstMatrix.multiply(secondMatrix, pool).display().c_str(),
+               expected.display().c_str());
+  EXPECT_STREQ(firstMatrix.multiply(secondMatrix, pool).display().c_str(),
+               expected.display().c_str());
+
+  // products as large as the threshold run on the shared pool
+  auto& threshold{matrix_common::parallelThreshold()};
+  const auto previousThreshold{threshold.exchange(0U)};
+  EXPECT_STREQ((firstMatrix * secondMatrix).display().c_str(),
+               expected.display().c_str());
+  threshold.store(previousThreshold);
+}
+
+TEST(TestingMultiplication, NormalMatricesStrassenWinogradMultiplication) {
+  // odd size, so that the operands are padded before recursing three times
+  constexpr auto kSize{70U};
+
+  std::array<std::array<std::size_t, kSize>, kSize> firstElements{};
+  std::array<std::array<std::size_t, kSize>, kSize> secondElements{};
+  std::array<std::array<double, kSize>, kSize> firstReals{};
+  std::array<std::array<double, kSize>, kSize> secondReals{};
+  for (std::size_t i{0U}; i < kSize; ++i) {
+    for (std::size_t j{0U}; j < kSize; ++j) {
+      firstElements[i][j] = (i * 7U + j * 3U) % 11U;
+      secondElements[i][j] = (i * 5U + j) % 13U;
+      firstReals[i][j] = static_cast<double>(firstElements[i][j]) / 4.0;
+      secondReals[i][j] = static_cast<double>(secondElements[i][j]) / 8.0;
+    }
+  }
+
+  const NormalMatrix<kSize, kSize> firstMatrix{firstElements};
+  const NormalMatrix<kSize, kSize> secondMatrix{secondElements};
+  const NormalMatrix<kSize, kSize, double> firstReal{firstReals};
+  const NormalMatrix<kSize, kSize, double> secondReal{secondReals};
+  const auto expected{firstMatrix * secondMatrix};
+  const auto expectedReal{firstReal * secondReal};
+
+  auto& threshold{matrix_common::strassenThreshold()};
+  const auto previousThreshold{threshold.exchange(16U)};
+
+  // unsigned products wrap around the same, so they are exact
+  EXPECT_STREQ((firstMatrix * secondMatrix).display().c_str(),
+               expected.display().c_str());
+
+  // small dyadic fractions are summed exactly as well
+  EXPECT_STREQ((firstReal * secondReal).display().c_str(),
+               expectedReal.display().c_str());
+
+  common::ThreadPool pool{4U};
+  EXPECT_STREQ(firstMatrix.multiply(secondMatrix, pool).display().c_str(),
+               expected.display().c_str());
+
+  // the arena of the recursion is kept by the thread, so only the first
+  // product grows it
+  common::SerialExecutor serial;
+  auto product{firstReal.multiply(secondReal, serial)};
+  const auto allocations{allocationsOfThisThread()};
+  for (std::size_t i{0U}; i < 3U; ++i) {
+    product = firstReal.multiply(secondReal, serial);
+  }
+  EXPECT_EQ(allocationsOfThisThread(), allocations);
+  EXPECT_STREQ(product.display().c_str(), expectedReal.display().c_str());
+
+  threshold.store(previousThreshold);
+}
+
+TEST(TestingCompoundAssignment, NormalMatricesCompoundAssignment) {
+  NormalMatrix<2U, 2U> matrix{{1U, 2U}, {3U, 4U}};
+
+  matrix += NormalMatrix<2U, 2U>{{1U, 1U}, {1U, 1U}};
+  EXPECT_STREQ(matrix.display().c_str(), "|2 3|\n|4 5|");
+
+  // only the stored elements of packed matrices are added
+  matrix += LowerTriangularMatrix<2U>{{1U}, {2U, 3U}};
+  EXPECT_STREQ(matrix.display().c_str(), "|3 3|\n|6 8|");
+
+  matrix -= DiagonalMatrix<2U>{1U, 2U};
+  EXPECT_STREQ(matrix.display().c_str(), "|2 3|\n|6 6|");
+
+  matrix *= NormalMatrix<2U, 2U>{{1U, 0U}, {1U, 1U}};
+  EXPECT_STREQ(matrix.display().c_str(), "|5 3|\n|12 6|");
+
+  matrix *= 2U;
+  EXPECT_STREQ(matrix.display().c_str(), "|10 6|\n|24 12|");
+
+  // the product is written over its own operand
+  NormalMatrix<2U, 2U> fibonacci{{1U, 1U}, {1U, 0U}};
+  fibonacci *= fibonacci;
+  fibonacci *= fibonacci;
+  EXPECT_STREQ(fibonacci.display().c_str(), "|5 3|\n|3 2|");
+
+  // assignment is available now that elements are not const
+  matrix = NormalMatrix<2U, 2U>{};
+  EXPECT_STREQ(matrix.display().c_str(), "|0 0|\n|0 0|");
+
+  EXPECT_THROW((matrix += DynamicMatrix<>{{1U, 2U}}), std::invalid_argument);
+}
+
+TEST(TestingCompoundAssignment, RepeatedProductsOfNormalMatricesDoNotAllocate) {
+  // a cyclic permutation, whose fourth power is the identity
+  const NormalMatrix<4U, 4U> permutation{
+      {0U, 1U, 0U, 0U}, {0U, 0U, 1U, 0U}, {0U, 0U, 0U, 1U}, {1U, 0U, 0U, 0U}};
+  NormalMatrix<4U, 4U> matrix{{1U, 2U, 3U, 4U},
+                              {5U, 6U, 7U, 8U},
+                              {9U, 10U, 11U, 12U},
+                              {13U, 14U, 15U, 16U}};
+  const auto expected{matrix.display()};
+
+  // the first product may grow the workspace of the thread, later ones reuse
+  // it
+  matrix *= permutation;
+  const auto allocations{allocationsOfThisThread()};
+  for (std::size_t i{0U}; i < 7U; ++i) {
+    matrix *= permutation;
+  }
+  EXPECT_EQ(allocationsOfThisThread(), allocations);
+  EXPECT_EQ(matrix.display(), expected);
+}
+
+TEST(TestingTranspose, TransposeNormalMatrices) {
+  EXPECT_STREQ((NormalMatrix<2U, 3U>{{1U, 2U, 3U}, {4U, 5U, 6U}})
+                   .transpose()
+                   .display()
+                   .c_str(),
+               "|1 4|\n|2 5|\n|3 6|");
+
+  // large enough to be split recursively, and not a multiple of any tile
+  NormalMatrix<67U, 45U, float> matrix{};
+  for (std::size_t i{0U}; i < 67U; ++i) {
+    for (std::size_t j{0U}; j < 45U; ++j) {
+      matrix.rowData(i)[j] = static_cast<float>((i * 45U) + j);
+    }
+  }
+
+  const auto transposed{matrix.transpose()};
+  bool allTransposed{true};
+  for (std::size_t i{0U}; i < 67U; ++i) {
+    for (std::size_t j{0U}; j < 45U; ++j) {
+      allTransposed = allTransposed &&
+                      transposed.rowData(j)[i] == matrix.rowData(i)[j];
+    }
+  }
+  EXPECT_TRUE(allTransposed);
+}
+
+TEST(TestingTranspose, TransposeNormalMatricesInPlace) {
+  NormalMatrix<2U, 2U> small{{1U, 2U}, {3U, 4U}};
+  EXPECT_STREQ(small.transposeInPlace().display().c_str(), "|1 3|\n|2 4|");
+
+  NormalMatrix<100U, 100U> matrix{};
+  for (std::size_t i{0U}; i < 100U; ++i) {
+    for (std::size_t j{0U}; j < 100U; ++j) {
+      matrix.rowData(i)[j] = (i * 100U) + j;
+    }
+  }
+
+  matrix.transposeInPlace();
+  bool allTransposed{true};
+  for (std::size_t i{0U}; i < 100U; ++i) {
+    for (std::size_t j{0U}; j < 100U; ++j) {
+      allTransposed = allTransposed && matrix.rowData(j)[i] == (i * 100U) + j;
+    }
+  }
+  EXPECT_TRUE(allTransposed);
+
+  // a matrix added to its transpose is symmetric, spanning several tiles
+  matrix += matrix.transpose();
+  EXPECT_TRUE(matrix.isSymmetric());
+  matrix.rowData(97U)[3U] += 1U;
+  EXPECT_FALSE(matrix.isSymmetric());
+}
+
 TEST(TestingIsSymmetric, CheckSymmetricityOfNormalMatricesOfDifferentSizes) {
   // testing non-square matrices
   EXPECT_FALSE((NormalMatrix<2U, 3U>{}).isSymmetric());
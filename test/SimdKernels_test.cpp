@@ -0,0 +1,141 @@
+#include "data-structures/matrix-types/SimdKernels.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types::simd_kernels;
+
+/// @brief helper to compare every kernel supported by the running CPU
+///        against the scalar one, results are expected to be bit-exact
+/// @tparam T type of the elements
+template <typename T>
+void expectKernelsMatchScalar() {
+  // long enough to exercise full vectors of every width and a scalar tail
+  constexpr std::size_t kCount{37U};
+
+  std::vector<T> source(kCount);
+  for (std::size_t i{0U}; i < kCount; ++i) {
+    source[i] = static_cast<T>((i * 7U) % 19U) / static_cast<T>(3);
+  }
+  const std::array<T, 4U> factors{static_cast<T>(3), static_cast<T>(5) / 7,
+                                  static_cast<T>(11), static_cast<T>(2) / 3};
+
+  const auto run{[&source, &factors]() {
+    std::vector<std::vector<T>> results(4U, std::vector<T>(kCount));
+    for (std::size_t r{0U}; r < 4U; ++r) {
+      for (std::size_t i{0U}; i < kCount; ++i) {
+        results[r][i] = static_cast<T>(i + r);
+      }
+    }
+
+    multiplyAdd(factors, source.data(),
+                std::array<T*, 4U>{results[0].data(), results[1].data(),
+                                   results[2].data(), results[3].data()},
+                kCount);
+    multiplyAdd(std::array<T, 1U>{factors[1]}, source.data(),
+                std::array<T*, 1U>{results[0].data()}, kCount);
+    multiplyAddElementwise(results[1].data(), source.data(),
+                           results[2].data(), kCount);
+    return results;
+  }};
+
+  useInstructionSet(InstructionSet::kScalar);
+  const auto expected{run()};
+
+  for (const auto instructionSet : {InstructionSet::kSse42,
+                                    InstructionSet::kAvx2,
+                                    InstructionSet::kAvx512}) {
+    useInstructionSet(instructionSet);
+    EXPECT_EQ(run(), expected);
+  }
+
+  useInstructionSet(detectInstructionSet());
+}
+
+/// @brief helper to compare the transposes of every instruction set supported
+///        by the running CPU against the scalar one
+/// @tparam T type of the elements
+template <typename T>
+void expectTransposesMatchScalar() {
+  // not a multiple of any micro-transpose, so the edges are exercised too
+  constexpr std::size_t kRows{19U};
+  constexpr std::size_t kColumns{13U};
+  constexpr std::size_t kSourceStride{kColumns + 3U};
+
+  std::vector<T> source(kRows * kSourceStride);
+  for (std::size_t i{0U}; i < source.size(); ++i) {
+    source[i] = static_cast<T>(i);
+  }
+
+  const auto run{[&source]() {
+    std::vector<T> result(kColumns * kRows);
+    transposeBlock(source.data(), kSourceStride, result.data(), kRows, kRows,
+                   kColumns);
+    return result;
+  }};
+
+  useInstructionSet(InstructionSet::kScalar);
+  const auto expected{run()};
+  EXPECT_EQ(expected[(5U * kRows) + 7U], source[(7U * kSourceStride) + 5U]);
+
+  for (const auto instructionSet : {InstructionSet::kSse42,
+                                    InstructionSet::kAvx2,
+                                    InstructionSet::kAvx512}) {
+    useInstructionSet(instructionSet);
+    EXPECT_EQ(run(), expected);
+  }
+
+  useInstructionSet(detectInstructionSet());
+}
+
+TEST(TestingSimdKernels, VectorizedKernelsMatchScalarKernel) {
+  expectKernelsMatchScalar<float>();
+  expectKernelsMatchScalar<double>();
+  expectKernelsMatchScalar<std::int32_t>();
+  expectKernelsMatchScalar<std::uint64_t>();
+}
+
+TEST(TestingSimdKernels, VectorizedTransposesMatchScalarTranspose) {
+  expectTransposesMatchScalar<float>();
+  expectTransposesMatchScalar<double>();
+  expectTransposesMatchScalar<std::int32_t>();
+  expectTransposesMatchScalar<std::uint64_t>();
+}
+
+TEST(TestingSimdKernels, UnsignedKernelsWrapAround) {
+  const std::array<std::uint64_t, 1U> factor{0xFFFF'FFFF'FFFF'FFFFU};
+  const std::vector<std::uint64_t> source(9U, 0x1'0000'0003U);
+
+  for (const auto instructionSet :
+       {InstructionSet::kScalar, InstructionSet::kSse42, InstructionSet::kAvx2,
+        InstructionSet::kAvx512}) {
+    useInstructionSet(instructionSet);
+
+    std::vector<std::uint64_t> result(9U, 1U);
+    multiplyAdd(factor, source.data(),
+                std::array<std::uint64_t*, 1U>{result.data()}, result.size());
+
+    // 1 + (2^64 - 1) * (2^32 + 3) mod 2^64 = 1 - (2^32 + 3)
+    EXPECT_EQ(result, std::vector<std::uint64_t>(9U, 0xFFFF'FFFE'FFFF'FFFEU));
+  }
+
+  useInstructionSet(detectInstructionSet());
+}
+
+TEST(TestingSimdKernels, RequestingUnsupportedInstructionSetFallsBack) {
+  useInstructionSet(InstructionSet::kAvx512);
+  EXPECT_LE(selectedInstructionSet().load(), detectInstructionSet());
+
+  useInstructionSet(InstructionSet::kScalar);
+  EXPECT_EQ(selectedInstructionSet().load(), InstructionSet::kScalar);
+
+  useInstructionSet(detectInstructionSet());
+}
+
+}  // namespace data_structures_test::matrixAdt_test
@@ -0,0 +1,209 @@
+#include "data-structures/matrix-types/SparseMatrix.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "common/ThreadPool.hpp"
+#include "data-structures/MatrixAdt.hpp"
+#include "data-structures/matrix-types/SymmetricMatrix.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+TEST(TestingConstruction, ConstructingSparseMatrices) {
+  EXPECT_NO_THROW({ (CooMatrix<>{}); });
+  EXPECT_NO_THROW({ (CsrMatrix<>{}); });
+  EXPECT_NO_THROW({ (CscMatrix<>{}); });
+
+  // entries in any order, duplicates are summed up and zeros are dropped
+  const CsrMatrix<> csr(2U, 3U, {{1U, 2U, 4U}, {0U, 1U, 2U}, {1U, 2U, 1U},
+                                 {0U, 0U, 0U}});
+  EXPECT_EQ(csr.numberOfNonZeros(), 2U);
+  EXPECT_STREQ(csr.display().c_str(), "|0 2 0|\n|0 0 5|");
+  EXPECT_EQ(std::vector(csr.offsets().begin(), csr.offsets().end()),
+            (std::vector<std::size_t>{0U, 1U, 2U}));
+
+  const CscMatrix<> csc(2U, 3U, {{1U, 2U, 5U}, {0U, 1U, 2U}});
+  EXPECT_EQ(std::vector(csc.offsets().begin(), csc.offsets().end()),
+            (std::vector<std::size_t>{0U, 0U, 1U, 2U}));
+  EXPECT_STREQ(csc.display().c_str(), "|0 2 0|\n|0 0 5|");
+
+  EXPECT_THROW((CooMatrix<>(2U, 2U, {{2U, 0U, 1U}})), std::out_of_range);
+}
+
+TEST(TestingConstruction, ConstructingCompressedMatricesFromArrays) {
+  const CsrMatrix<> matrix(2U, 3U, {0U, 2U, 3U}, {0U, 2U, 1U}, {1U, 2U, 3U});
+  EXPECT_STREQ(matrix.display().c_str(), "|1 0 2|\n|0 3 0|");
+
+  // offsets not matching the number of rows
+  EXPECT_THROW((CsrMatrix<>(3U, 3U, {0U, 2U, 3U}, {0U, 2U, 1U}, {1U, 2U, 3U})),
+               std::invalid_argument);
+  // unsorted indices within a row
+  EXPECT_THROW((CsrMatrix<>(2U, 3U, {0U, 2U, 3U}, {2U, 0U, 1U}, {1U, 2U, 3U})),
+               std::invalid_argument);
+  // index outside the matrix
+  EXPECT_THROW((CsrMatrix<>(2U, 3U, {0U, 2U, 3U}, {0U, 3U, 1U}, {1U, 2U, 3U})),
+               std::invalid_argument);
+}
+
+TEST(TestingConversion, ConvertingBetweenSparseAndDenseMatrices) {
+  const NormalMatrix<2U, 3U> dense{{1U, 0U, 2U}, {0U, 3U, 0U}};
+
+  const CsrMatrix<> csr{dense};
+  const CscMatrix<> csc{csr};
+  const CooMatrix<> coo{csc};
+  EXPECT_EQ(csr.numberOfNonZeros(), 3U);
+  EXPECT_STREQ(csr.display().c_str(), dense.display().c_str());
+  EXPECT_STREQ(csc.display().c_str(), dense.display().c_str());
+  EXPECT_STREQ(coo.display().c_str(), dense.display().c_str());
+
+  // back to dense
+  EXPECT_STREQ((DynamicMatrix<>{csc}).display().c_str(),
+               dense.display().c_str());
+  EXPECT_STREQ((CsrMatrix<>{LowerTriangularMatrix<2U>{{1U}, {2U, 3U}}})
+                   .display()
+                   .c_str(),
+               "|1 0|\n|2 3|");
+}
+
+TEST(TestingRowAndColumn, ReadSparseMatricesRowsAndColumns) {
+  const CsrMatrix<> csr(2U, 3U, {{0U, 0U, 1U}, {0U, 2U, 2U}, {1U, 1U, 3U}});
+  const CscMatrix<> csc{csr};
+
+  EXPECT_EQ(csr.row(0U), (std::vector<std::size_t>{1U, 0U, 2U}));
+  EXPECT_EQ(csr.column(2U), (std::vector<std::size_t>{2U, 0U}));
+  EXPECT_EQ(csc.row(1U), (std::vector<std::size_t>{0U, 3U, 0U}));
+  EXPECT_EQ(csc.column(0U), (std::vector<std::size_t>{1U, 0U}));
+  EXPECT_EQ(csr.element(1U, 1U), 3U);
+  EXPECT_EQ(csc.element(1U, 2U), 0U);
+
+  EXPECT_THROW((void)csr.row(2U), std::out_of_range);
+  EXPECT_THROW((void)csc.column(3U), std::out_of_range);
+
+  // an empty matrix has no valid index, nor any range to report
+  EXPECT_THROW((void)CooMatrix<>{}.row(0U), std::out_of_range);
+  EXPECT_THROW((void)CooMatrix<>{}.column(0U), std::out_of_range);
+  EXPECT_THROW((void)CsrMatrix<>{}.row(0U), std::out_of_range);
+  EXPECT_THROW((void)CscMatrix<>{}.column(0U), std::out_of_range);
+
+  // views compare element by element whatever their kind
+  EXPECT_EQ(csr.rowView(0U), csc.rowView(0U));
+  EXPECT_EQ(csr.columnView(1U), csc.columnView(1U));
+
+  std::vector<std::vector<std::size_t>> rows;
+  for (const auto& row : csr.rows()) {
+    rows.emplace_back(row.begin(), row.end());
+  }
+  EXPECT_EQ(rows, (std::vector<std::vector<std::size_t>>{{1U, 0U, 2U},
+                                                         {0U, 3U, 0U}}));
+}
+
+TEST(TestingMultiplication, SparseMatrixVectorMultiplication) {
+  const CooMatrix<> coo(3U, 3U, {{0U, 0U, 1U}, {0U, 2U, 2U}, {2U, 1U, 3U}});
+  const std::vector<std::size_t> vector{1U, 2U, 3U};
+  const std::vector<std::size_t> expected{7U, 0U, 6U};
+
+  EXPECT_EQ(coo.multiplyVector(vector), expected);
+  EXPECT_EQ(CsrMatrix<>{coo}.multiplyVector(vector), expected);
+  EXPECT_EQ(CscMatrix<>{coo}.multiplyVector(vector), expected);
+
+  ::common::ThreadPool pool{2U};
+  EXPECT_EQ(CsrMatrix<>{coo}.multiplyVector(vector, pool), expected);
+
+  EXPECT_THROW((void)coo.multiplyVector(std::vector<std::size_t>{1U, 2U}),
+               std::invalid_argument);
+}
+
+TEST(TestingMultiplication, SparseMatricesMultiplication) {
+  const NormalMatrix<2U, 3U> firstDense{{1U, 0U, 2U}, {0U, 3U, 0U}};
+  const NormalMatrix<3U, 2U> secondDense{{0U, 4U}, {5U, 0U}, {6U, 0U}};
+  const auto expected{(firstDense * secondDense).display()};
+
+  // sparse by sparse keeps the format of the first operand
+  const auto csrProduct{CsrMatrix<>{firstDense} * CsrMatrix<>{secondDense}};
+  EXPECT_STREQ(csrProduct.display().c_str(), expected.c_str());
+  EXPECT_EQ(csrProduct.numberOfNonZeros(), 3U);
+
+  EXPECT_STREQ((CscMatrix<>{firstDense} * CscMatrix<>{secondDense})
+                   .display()
+                   .c_str(),
+               expected.c_str());
+  EXPECT_STREQ((CsrMatrix<>{firstDense} * CooMatrix<>{secondDense})
+                   .display()
+                   .c_str(),
+               expected.c_str());
+  EXPECT_STREQ((CooMatrix<>{firstDense} * CscMatrix<>{secondDense})
+                   .display()
+                   .c_str(),
+               expected.c_str());
+
+  // sparse by dense results in a dense matrix
+  EXPECT_STREQ((CsrMatrix<>{firstDense} * secondDense).display().c_str(),
+               expected.c_str());
+  EXPECT_STREQ((CscMatrix<>{firstDense} * DynamicMatrix<>{secondDense})
+                   .display()
+                   .c_str(),
+               expected.c_str());
+  EXPECT_STREQ((firstDense * CsrMatrix<>{secondDense}).display().c_str(),
+               expected.c_str());
+
+  // rows of a symmetric matrix are read through their mirrored elements,
+  // not as a contiguous run of the packed triangle
+  const SymmetricMatrix<3U> symmetric{{1U}, {2U, 3U}, {4U, 5U, 6U}};
+  const NormalMatrix<3U, 3U> symmetricDense{
+      {1U, 2U, 4U}, {2U, 3U, 5U}, {4U, 5U, 6U}};
+  const NormalMatrix<2U, 3U> sparseDense{{1U, 0U, 0U}, {0U, 2U, 1U}};
+  EXPECT_STREQ((CsrMatrix<>{sparseDense} * symmetric).display().c_str(),
+               (sparseDense * symmetricDense).display().c_str());
+  EXPECT_STREQ((CscMatrix<>{sparseDense} * symmetric).display().c_str(),
+               (sparseDense * symmetricDense).display().c_str());
+
+  EXPECT_THROW((void)(CsrMatrix<>{firstDense} * CsrMatrix<>{firstDense}),
+               std::invalid_argument);
+}
+
+TEST(TestingCompoundAssignment, SparseMatricesCompoundAssignment) {
+  CsrMatrix<> csr(2U, 2U, {{0U, 1U, 2U}});
+
+  csr += NormalMatrix<2U, 2U>{{1U, 0U}, {0U, 0U}};
+  EXPECT_STREQ(csr.display().c_str(), "|1 2|\n|0 0|");
+
+  // entries cancelling each other are dropped
+  csr -= CooMatrix<>(2U, 2U, {{0U, 1U, 2U}});
+  EXPECT_EQ(csr.numberOfNonZeros(), 1U);
+
+  csr *= 5U;
+  EXPECT_STREQ(csr.display().c_str(), "|5 0|\n|0 0|");
+
+  CooMatrix<> coo{csr};
+  coo.scale(0U);
+  EXPECT_EQ(coo.numberOfNonZeros(), 0U);
+
+  EXPECT_THROW((csr += CscMatrix<>(3U, 2U)), std::invalid_argument);
+}
+
+TEST(TestingIsSymmetric, CheckSymmetricityOfSparseMatrices) {
+  EXPECT_TRUE((CsrMatrix<>{}).isSymmetric());
+  EXPECT_FALSE((CsrMatrix<>(2U, 3U)).isSymmetric());
+  EXPECT_TRUE(
+      (CscMatrix<>(2U, 2U, {{0U, 1U, 2U}, {1U, 0U, 2U}})).isSymmetric());
+  EXPECT_FALSE(
+      (CooMatrix<>(2U, 2U, {{0U, 1U, 2U}, {1U, 0U, 3U}})).isSymmetric());
+  EXPECT_FALSE((CsrMatrix<>(2U, 2U, {{0U, 1U, 2U}})).isSymmetric());
+}
+
+TEST(TestingMatrixAdt, SparseMatricesInMatrixAdt) {
+  using ::data_structures::MatrixAdt;
+
+  const MatrixAdt<CsrMatrix<>> first{
+      2U, 2U, std::vector<SparseEntry<std::size_t>>{{0U, 1U, 2U}, {1U, 0U, 3U}}};
+  const MatrixAdt<NormalMatrix<2U, 2U>> second{{5U, 6U}, {7U, 8U}};
+
+  EXPECT_STREQ((first * first).display().c_str(), "|6 0|\n|0 6|");
+  EXPECT_STREQ((first * second).display().c_str(), "|14 16|\n|15 18|");
+}
+
+}  // namespace data_structures_test::matrixAdt_test
@@ -0,0 +1,75 @@
+#include "data-structures/matrix-types/SymmetricMatrix.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+TEST(TestingConstruction, ConstructingSymmetricMatrices) {
+  EXPECT_NO_THROW({ (SymmetricMatrix<1U>{}); });
+  EXPECT_NO_THROW({ (SymmetricMatrix<2U>{{1U}, {2U, 3U}}); });
+
+  // rows of the lower triangle, mirrored above the diagonal
+  const SymmetricMatrix<3U> symmetric{{1U}, {2U, 3U}, {4U, 5U, 6U, 7U}};
+  EXPECT_STREQ(symmetric.display().c_str(), "|1 2 4|\n|2 3 5|\n|4 5 6|");
+  EXPECT_EQ(symmetric.row(0U), (std::array<std::size_t, 3U>{1U, 2U, 4U}));
+  EXPECT_EQ(symmetric.column(1U), (std::array<std::size_t, 3U>{2U, 3U, 5U}));
+
+  // only the lower triangle of a dense matrix is kept
+  const NormalMatrix<3U, 3U> dense{{1U, 9U, 9U}, {2U, 3U, 9U}, {4U, 5U, 6U}};
+  EXPECT_STREQ((SymmetricMatrix<3U>{dense}).display().c_str(),
+               symmetric.display().c_str());
+  EXPECT_EQ(symmetric.rowView(2U), dense.rowView(2U));
+}
+
+TEST(TestingMultiplication, SymmetricMatricesMultiplication) {
+  const SymmetricMatrix<3U> symmetric{{1U}, {2U, 3U}, {4U, 5U, 6U}};
+  const NormalMatrix<3U, 3U> dense{{1U, 2U, 4U}, {2U, 3U, 5U}, {4U, 5U, 6U}};
+  const NormalMatrix<3U, 2U> other{{1U, 0U}, {2U, 1U}, {0U, 3U}};
+
+  EXPECT_STREQ((symmetric * other).display().c_str(),
+               (dense * other).display().c_str());
+  EXPECT_STREQ((symmetric * symmetric).display().c_str(),
+               (dense * dense).display().c_str());
+  EXPECT_STREQ((dense * symmetric).display().c_str(),
+               (dense * dense).display().c_str());
+  EXPECT_STREQ((symmetric * DynamicMatrix<>{other}).display().c_str(),
+               (dense * other).display().c_str());
+
+  EXPECT_EQ(symmetric.multiplyVector({1U, 2U, 3U}),
+            (std::array<std::size_t, 3U>{17U, 23U, 32U}));
+}
+
+TEST(TestingCompoundAssignment, SymmetricMatricesCompoundAssignment) {
+  SymmetricMatrix<2U> matrix{{1U}, {2U, 3U}};
+
+  matrix += SymmetricMatrix<2U>{{1U}, {1U, 1U}};
+  EXPECT_STREQ(matrix.display().c_str(), "|2 3|\n|3 4|");
+
+  matrix -= DiagonalMatrix<2U>{2U, 1U};
+  EXPECT_STREQ(matrix.display().c_str(), "|0 3|\n|3 3|");
+
+  matrix *= 2U;
+  EXPECT_STREQ(matrix.display().c_str(), "|0 6|\n|6 6|");
+}
+
+TEST(TestingStructure, DetectStructureOfSymmetricMatrices) {
+  const SymmetricMatrix<3U> tridiagonal{{1U}, {2U, 3U}, {0U, 5U, 6U}};
+  EXPECT_TRUE(tridiagonal.isSymmetric());
+  EXPECT_TRUE(tridiagonal.isBanded(1U));
+  EXPECT_FALSE(tridiagonal.isBanded(0U));
+  EXPECT_FALSE(tridiagonal.isLowerTriangular());
+  EXPECT_TRUE((SymmetricMatrix<2U>{{1U}, {0U, 3U}}).isDiagonal());
+
+  // bands wider than the matrix hold all of it, without wrapping bounds
+  EXPECT_TRUE(tridiagonal.isBanded(2U));
+  EXPECT_TRUE(tridiagonal.isBanded(std::numeric_limits<std::size_t>::max()));
+}
+
+}  // namespace data_structures_test::matrixAdt_test
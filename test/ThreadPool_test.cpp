@@ -0,0 +1,83 @@
+#include "common/ThreadPool.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+/// @brief namespace for threadPool_test tests
+namespace common_test::threadPool_test {
+using namespace ::common;
+
+TEST(TestingConstruction, ConstructingThreadPools) {
+  EXPECT_EQ(ThreadPool{1U}.size(), 1U);
+  EXPECT_EQ(ThreadPool{4U}.size(), 4U);
+
+  // at least one worker is started
+  EXPECT_EQ(ThreadPool{0U}.size(), 1U);
+}
+
+TEST(TestingSubmit, SubmittedTasksAreAllRunBeforeDestruction) {
+  std::atomic<std::size_t> counter{0U};
+  {
+    ThreadPool pool{3U};
+    for (auto i{0U}; i < 100U; ++i) {
+      pool.submit([&counter] { ++counter; });
+    }
+  }
+
+  EXPECT_EQ(counter.load(), 100U);
+}
+
+TEST(TestingParallelFor, EveryIndexIsRunExactlyOnce) {
+  ThreadPool pool{4U};
+
+  for (const auto count : {0U, 1U, 3U, 4U, 5U, 1000U}) {
+    std::vector<std::atomic<std::size_t>> hits(count);
+    pool.parallelFor(count, [&hits](std::size_t index) { ++hits[index]; });
+
+    for (const auto& hit : hits) {
+      EXPECT_EQ(hit.load(), 1U);
+    }
+  }
+}
+
+TEST(TestingParallelFor, NestedParallelForDoesNotDeadlock) {
+  ThreadPool pool{2U};
+  std::atomic<std::size_t> counter{0U};
+
+  pool.parallelFor(8U, [&pool, &counter](std::size_t) {
+    pool.parallelFor(8U, [&counter](std::size_t) { ++counter; });
+  });
+
+  EXPECT_EQ(counter.load(), 64U);
+}
+
+TEST(TestingParallelFor, ExceptionsArePropagatedToTheCaller) {
+  ThreadPool pool{4U};
+  std::atomic<std::size_t> counter{0U};
+
+  EXPECT_THROW(pool.parallelFor(100U,
+                                [&counter](std::size_t index) {
+                                  ++counter;
+                                  if (index == 42U) {
+                                    throw std::runtime_error{"failure"};
+                                  }
+                                }),
+               std::runtime_error);
+
+  // the remaining indices are still run
+  EXPECT_EQ(counter.load(), 100U);
+}
+
+TEST(TestingParallelFor, SerialExecutorRunsInOrder) {
+  std::vector<std::size_t> order;
+  SerialExecutor::parallelFor(
+      5U, [&order](std::size_t index) { order.push_back(index); });
+
+  EXPECT_EQ(order, (std::vector<std::size_t>{0U, 1U, 2U, 3U, 4U}));
+}
+
+}  // namespace common_test::threadPool_test
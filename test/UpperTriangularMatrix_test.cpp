@@ -0,0 +1,121 @@
+#include "data-structures/matrix-types/UpperTriangularMatrix.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "common/ThreadPool.hpp"
+#include "data-structures/matrix-types/DiagonalMatrix.hpp"
+#include "gtest/gtest.h"
+
+/// @brief namespace for matrixAdt_test tests
+namespace data_structures_test::matrixAdt_test {
+using namespace ::data_structures::matrix_types;
+
+TEST(TestingConstruction, ConstructingUpperTriangularMatrices) {
+  EXPECT_NO_THROW({ (UpperTriangularMatrix<1U>{}); });
+  EXPECT_NO_THROW({ (UpperTriangularMatrix<2U>{{1U, 2U}, {3U}}); });
+
+  // rows start at the diagonal, shorter ones are padded with zeros and extra
+  // elements of longer ones are ignored
+  EXPECT_STREQ(
+      (UpperTriangularMatrix<3U>{{1U, 2U, 3U}, {4U}, {6U, 7U}})
+          .display()
+          .c_str(),
+      "|1 2 3|\n|0 4 0|\n|0 0 6|");
+
+  // only the upper triangle of a dense matrix is kept
+  const NormalMatrix<3U, 3U> dense{{1U, 2U, 3U}, {4U, 5U, 6U}, {7U, 8U, 9U}};
+  const UpperTriangularMatrix<3U> upper{dense};
+  EXPECT_STREQ(upper.display().c_str(), "|1 2 3|\n|0 5 6|\n|0 0 9|");
+  EXPECT_EQ(upper.row(1U), (std::array<std::size_t, 3U>{0U, 5U, 6U}));
+  EXPECT_EQ(upper.column(2U), (std::array<std::size_t, 3U>{3U, 6U, 9U}));
+  EXPECT_EQ(upper.columnView(2U), dense.columnView(2U));
+  EXPECT_NE(upper.columnView(1U), dense.columnView(1U));
+}
+
+TEST(TestingMultiplication, UpperTriangularMatricesMultiplication) {
+  const UpperTriangularMatrix<3U> first{{1U, 2U, 3U}, {4U, 5U}, {6U}};
+  const UpperTriangularMatrix<3U> second{{1U, 1U, 1U}, {2U, 2U}, {3U}};
+  const NormalMatrix<3U, 3U> firstDense{
+      {1U, 2U, 3U}, {0U, 4U, 5U}, {0U, 0U, 6U}};
+  const NormalMatrix<3U, 3U> secondDense{
+      {1U, 1U, 1U}, {0U, 2U, 2U}, {0U, 0U, 3U}};
+
+  // product of upper triangular matrices stays packed
+  const auto product{first * second};
+  static_assert(
+      std::is_same_v<std::remove_const_t<decltype(product)>,
+                     UpperTriangularMatrix<3U>>);
+  EXPECT_STREQ(product.display().c_str(),
+               (firstDense * secondDense).display().c_str());
+
+  ::common::ThreadPool pool{2U};
+  EXPECT_STREQ(first.multiply(second, pool).display().c_str(),
+               product.display().c_str());
+
+  // by other matrices types the result is dense
+  EXPECT_STREQ((first * secondDense).display().c_str(),
+               (firstDense * secondDense).display().c_str());
+  EXPECT_STREQ((firstDense * second).display().c_str(),
+               (firstDense * secondDense).display().c_str());
+  EXPECT_STREQ((first * DiagonalMatrix<3U>{1U, 2U, 3U}).display().c_str(),
+               "|1 4 9|\n|0 8 15|\n|0 0 18|");
+  EXPECT_STREQ((first * DynamicMatrix<>{secondDense}).display().c_str(),
+               (firstDense * secondDense).display().c_str());
+}
+
+TEST(TestingCompoundAssignment, UpperTriangularMatricesCompoundAssignment) {
+  UpperTriangularMatrix<2U> matrix{{1U, 2U}, {3U}};
+
+  matrix += UpperTriangularMatrix<2U>{{1U, 1U}, {1U}};
+  EXPECT_STREQ(matrix.display().c_str(), "|2 3|\n|0 4|");
+
+  matrix -= DiagonalMatrix<2U>{2U, 4U};
+  EXPECT_STREQ(matrix.display().c_str(), "|0 3|\n|0 0|");
+
+  matrix *= 2U;
+  EXPECT_STREQ(matrix.display().c_str(), "|0 6|\n|0 0|");
+
+  matrix *= UpperTriangularMatrix<2U>{{1U, 1U}, {2U}};
+  EXPECT_STREQ(matrix.display().c_str(), "|0 12|\n|0 0|");
+}
+
+TEST(TestingSolve, SolveUpperTriangularSystems) {
+  const UpperTriangularMatrix<3U, double> upper{
+      {2.0, 1.0, -1.0}, {3.0, 2.0}, {4.0}};
+
+  // U x = b with x = {1, 2, 3}
+  const auto solution{upper.solve({1.0, 12.0, 12.0})};
+  EXPECT_DOUBLE_EQ(solution[0U], 1.0);
+  EXPECT_DOUBLE_EQ(solution[1U], 2.0);
+  EXPECT_DOUBLE_EQ(solution[2U], 3.0);
+
+  // transpose(U) x = b with x = {1, 2, 3}
+  const auto transposedSolution{upper.solveTransposed({2.0, 7.0, 15.0})};
+  EXPECT_DOUBLE_EQ(transposedSolution[0U], 1.0);
+  EXPECT_DOUBLE_EQ(transposedSolution[1U], 2.0);
+  EXPECT_DOUBLE_EQ(transposedSolution[2U], 3.0);
+
+  EXPECT_THROW(
+      (void)(UpperTriangularMatrix<2U, double>{{1.0, 1.0}}).solve({1.0, 1.0}),
+      std::domain_error);
+}
+
+TEST(TestingStructure, DetectStructureOfUpperTriangularMatrices) {
+  const UpperTriangularMatrix<3U> upper{{1U, 2U, 0U}, {3U, 4U}, {5U}};
+  EXPECT_FALSE(upper.isSymmetric());
+  EXPECT_TRUE(upper.isBanded(1U));
+  EXPECT_FALSE(upper.isDiagonal());
+  EXPECT_FALSE(upper.isLowerTriangular());
+  EXPECT_FALSE((UpperTriangularMatrix<3U>{{1U, 0U, 2U}}).isBanded(1U));
+  EXPECT_TRUE((UpperTriangularMatrix<2U>{{1U}, {2U}}).isLowerTriangular());
+
+  // bands wider than the matrix hold all of it, without wrapping bounds
+  EXPECT_TRUE(upper.isBanded(2U));
+  EXPECT_TRUE(upper.isBanded(std::numeric_limits<std::size_t>::max()));
+}
+
+}  // namespace data_structures_test::matrixAdt_test